@@ -0,0 +1,63 @@
+// A wire cell CLI to prepare binary cache files for large data files
+
+#include "CLI11.hpp"
+
+#include "WireCellUtil/BinaryCache.h"
+#include "WireCellUtil/Response.h"
+#include "WireCellUtil/WireSchema.h"
+
+#include <boost/filesystem.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace WireCell;
+
+int main(int argc, char** argv)
+{
+    CLI::App app{"wcbincache converts field response and wires files to binary cache files"};
+
+    std::string cachedir = BinaryCache::directory();
+    std::vector<std::string> frs, wires;
+
+    app.add_option("-o,--output", cachedir,
+                   "Cache directory (def=$WIRECELL_CACHE)"
+        )->type_size(1)->allow_extra_args(false);
+    app.add_option("-r,--field-response", frs,
+                   "A field response file to convert"
+        )->type_size(1)->allow_extra_args(false);
+    app.add_option("-w,--wires", wires,
+                   "A wires file to convert"
+        )->type_size(1)->allow_extra_args(false);
+
+    CLI11_PARSE(app, argc, argv);
+
+    if (cachedir.empty()) {
+        std::cerr << "no cache directory given and WIRECELL_CACHE is not set\n";
+        return 1;
+    }
+    // The loaders fill the cache in the directory they are told.
+    setenv("WIRECELL_CACHE", cachedir.c_str(), 1);
+
+    int errors = 0;
+    auto report = [&](const std::string& filename, const std::string& kind) {
+        const auto cpath = BinaryCache::path(filename, kind);
+        if (cpath.empty() || !boost::filesystem::exists(cpath)) {
+            std::cerr << "failed to cache " << filename << "\n";
+            ++errors;
+            return;
+        }
+        std::cerr << filename << " -> " << cpath << "\n";
+    };
+
+    for (const auto& filename : frs) {
+        Response::Schema::load(filename.c_str());
+        report(filename, "fr");
+    }
+    for (const auto& filename : wires) {
+        WireSchema::load(filename.c_str(), WireSchema::Correction::load);
+        report(filename, "wires");
+    }
+    return errors ? 1 : 0;
+}
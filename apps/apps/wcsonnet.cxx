@@ -33,7 +33,7 @@ int main(int argc, char** argv)
 {
     CLI::App app{"wcsonnet is a Wire-Cell Toolkit aware Jsonnet compiler"};
 
-    std::string filename, output="/dev/stdout";
+    std::string filename, output="/dev/stdout", cachedir;
     std::vector<std::string> load_path, extvars, extcode, tlavars, tlacode;
 
     app.add_option("-o,--output", output,
@@ -48,6 +48,8 @@ int main(int argc, char** argv)
                    "Jsonnet level argument value <name>=<string>")->type_size(1)->allow_extra_args(false);
     app.add_option("-S,--tla-code", tlacode,
                    "Jsonnet level argument code <name>=<string>")->type_size(1)->allow_extra_args(false);
+    app.add_option("-c,--cache", cachedir,
+                   "Save the result in this configuration cache directory (def=$WIRECELL_CACHE)")->type_size(1)->allow_extra_args(false);
     app.add_option("file", filename, "Jsonnet file to compile");
                     
     // app.set_help_flag();
@@ -86,6 +88,9 @@ int main(int argc, char** argv)
 
     Persist::Parser parser(load_path, m_extvars, m_extcode,
                            m_tlavars, m_tlacode);
+    if (!cachedir.empty()) {
+        parser.set_cache(cachedir);
+    }
 
     auto jdat = parser.load(filename);
     std::ofstream out(output);
@@ -0,0 +1,72 @@
+#ifndef WIRECELLAUX_COLUMNARDEPOSET
+#define WIRECELLAUX_COLUMNARDEPOSET
+
+#include "WireCellIface/IDepoSet.h"
+
+#include <mutex>
+#include <vector>
+
+namespace WireCell::Aux {
+
+    /** A depo set held as columns.
+
+        Each depo attribute is held in its own contiguous array so
+        that bulk operations, such as drifting, may loop over whole
+        columns instead of chasing one pointer per depo.
+
+        Consumers of the IDepoSet interface still see individual
+        IDepo objects.  They are made on the first call to depos() in
+        one contiguous block which all of the depos share.
+     */
+    class ColumnarDepoSet : public IDepoSet {
+      public:
+
+        /// The depo attributes, one row per depo.
+        struct Columns {
+            std::vector<double> time, x, y, z, charge, energy;
+            std::vector<double> extent_long, extent_tran;
+            std::vector<int> id, pdg;
+
+            /// Either empty or holding the prior depo of each row.
+            IDepo::vector prior;
+
+            /// Either empty or holding the row of each prior depo in
+            /// the prior set given to ColumnarDepoSet.  Used when
+            /// "prior" is empty so the priors are only made if the
+            /// depos are.
+            std::vector<size_t> prior_row;
+
+            Columns() = default;
+
+            /// Fill columns from depos, keeping their priors.
+            explicit Columns(const IDepo::vector& depos);
+
+            size_t size() const { return time.size(); }
+            void resize(size_t size);
+
+            /// Return columns holding the given rows in the given order.
+            Columns take(const std::vector<size_t>& rows) const;
+        };
+
+        /// If priors is given, the prior of each depo is found in it
+        /// via the "prior_row" column.
+        ColumnarDepoSet(int ident, Columns columns, IDepoSet::pointer priors = nullptr);
+        virtual ~ColumnarDepoSet();
+
+        virtual int ident() const { return m_ident; }
+        virtual IDepo::shared_vector depos() const;
+
+        const Columns& columns() const { return m_columns; }
+
+      private:
+        int m_ident;
+        Columns m_columns;
+        IDepoSet::pointer m_priors;
+
+        mutable std::once_flag m_once;
+        mutable IDepo::shared_vector m_depos;
+    };
+
+}  // namespace WireCell::Aux
+
+#endif
@@ -2,6 +2,11 @@
 #define WIRECELLAUX_FFTWDFT
 
 #include "WireCellIface/IDFT.h"
+#include "WireCellIface/IConfigurable.h"
+#include "WireCellIface/ITerminal.h"
+#include "WireCellAux/Logger.h"
+
+#include <string>
 
 namespace WireCell::Aux {
 
@@ -9,16 +14,34 @@ namespace WireCell::Aux {
         The FftwDFT component provides IDFT based on FFTW3.
 
         All instances share a common thread-safe plan cache.  There is
-        no benefit to using more than one instance in a process.
+        no benefit to using more than one instance in a process.  Plans
+        are keyed by array shape, in-place-ness and alignment so that
+        one plan serves all arrays that share these.
+
+        Planning rigor may be raised from the default FFTW_ESTIMATE
+        and FFTW wisdom may be loaded on configure and saved on
+        finalize so a long job pays the cost of measured planning
+        once per shape and later jobs need not pay it at all.  See
+        default_configuration() for details.
 
         See IDFT.h for important comments.
     */
-    class FftwDFT : public IDFT {
+    class FftwDFT : public Aux::Logger,
+                    public IDFT,
+                    public IConfigurable,
+                    public ITerminal {
       public:
         
         FftwDFT();
         virtual ~FftwDFT();
 
+        // IConfigurable
+        virtual void configure(const WireCell::Configuration& config);
+        virtual WireCell::Configuration default_configuration() const;
+
+        // ITerminal
+        virtual void finalize();
+
         // 1d 
 
         virtual 
@@ -44,6 +67,32 @@ namespace WireCell::Aux {
         void inv2d(const complex_t* in, complex_t* out,
                    int nrows, int ncols) const;
 
+        // real-valued, batched with fftwf_plan_many_dft_r2c/c2r().
+
+        virtual
+        void fwd1d_r2c(const scalar_t* in, complex_t* out,
+                       int size) const;
+
+        virtual
+        void inv1d_c2r(const complex_t* in, scalar_t* out,
+                       int size) const;
+
+        virtual
+        void fwd1b_r2c(const scalar_t* in, complex_t* out,
+                       int nrows, int ncols, int axis) const;
+
+        virtual
+        void inv1b_c2r(const complex_t* in, scalar_t* out,
+                       int nrows, int ncols, int axis) const;
+
+        virtual
+        void fwd2d_r2c(const scalar_t* in, complex_t* out,
+                       int nrows, int ncols) const;
+
+        virtual
+        void inv2d_c2r(const complex_t* in, scalar_t* out,
+                       int nrows, int ncols) const;
+
         virtual
         void transpose(const scalar_t* in, scalar_t* out,
                        int nrows, int ncols) const;
@@ -51,6 +100,9 @@ namespace WireCell::Aux {
         void transpose(const complex_t* in, complex_t* out,
                        int nrows, int ncols) const;
 
+      private:
+        std::string m_wisdom{""};
+        bool m_save_wisdom{true};
     };
 }
 
@@ -72,6 +72,27 @@ namespace WireCell {
         channel_list fill(Array::array_xxf& array,
                           const ITrace::vector& traces);
 
+        /// Zero-suppressed charge of traces.  The "rois" hold one
+        /// (row, tbin begin, tbin end) triple for each run of
+        /// contiguous non-zero samples, ordered by row and then by
+        /// tbin.  The "samples" hold the charge of all runs
+        /// concatenated in the same order.
+        struct roi_list {
+            std::vector<int> rois;
+            std::vector<float> samples;
+
+            /// Number of runs.
+            size_t size() const { return rois.size() / 3; }
+        };
+
+        /// Return the zero-suppressed sum of charge in the traces.
+        /// Rows are associated to channels as in fill().  Traces on
+        /// channels not in the list are ignored.  Unlike fill(), no
+        /// array spanning all channels and ticks is formed.
+        roi_list rois(const ITrace::vector& traces,
+                      channel_list::iterator ch_begin,
+                      channel_list::iterator ch_end);
+
         /// Compare the time span of a frame to a time.
         ///
         /// Return 0 if the frame time span covers the target time.
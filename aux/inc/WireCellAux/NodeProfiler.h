@@ -0,0 +1,89 @@
+/** Record calls of data flow graph nodes for later inspection.
+
+    The Pgraph and TBB engines may each be given a NodeProfiler.  The
+    engine registers each node and then records every call of the
+    node with its wall clock begin and end, the CPU time of the
+    calling thread, the depth of the node's input (and if known,
+    output) queues and the size of the payload the call consumed.
+
+    The record may be written as a Chrome/Perfetto "trace event" JSON
+    file which may be loaded into chrome://tracing or
+    https://ui.perfetto.dev.  Each node call is a "complete" event on
+    the track of the thread that made it and each node's input queue
+    depth is a counter track.
+
+    Recording is thread safe.
+ */
+
+#ifndef WIRECELLAUX_NODEPROFILER
+#define WIRECELLAUX_NODEPROFILER
+
+#include "WireCellUtil/SharedAny.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace WireCell::Aux {
+
+    class NodeProfiler {
+      public:
+        NodeProfiler();
+
+        // A point in time as seen by the calling thread.
+        struct Stamp {
+            double wall{0};  // microseconds since profiler creation
+            double cpu{0};   // microseconds of calling thread CPU time
+        };
+
+        // One call of one node.
+        struct Call {
+            size_t node{0};     // as returned by add_node()
+            size_t thread{0};   // small number in order threads were seen
+            Stamp begin, end;
+            long in_depth{-1};  // data waiting on input, -1 if unknown
+            long out_depth{-1}; // data waiting on output, -1 if unknown
+            size_t payload{0};  // see payload_size()
+        };
+
+        // Register a node by name and return its index.
+        size_t add_node(const std::string& name);
+
+        // Return the current time.
+        Stamp stamp() const;
+
+        // Record one call made by the calling thread.
+        void record(size_t node, const Stamp& begin, const Stamp& end,
+                    long in_depth = -1, long out_depth = -1, size_t payload = 0);
+
+        // Access what has been recorded.
+        const std::vector<std::string>& nodes() const { return m_nodes; }
+        std::vector<Call> calls() const;
+
+        // Write the record as Chrome trace event JSON.  Throws
+        // IOError if the file can not be opened.
+        void write(const std::string& filename) const;
+
+        // Return the number of the elements that make up the bulk of
+        // the datum: traces of a frame, depos of a depo set, blobs of
+        // a blob set, activity of a slice, slices of a slice frame,
+        // vertices of a cluster or tensors of a tensor set.  A lone
+        // depo counts one.  Other types and EOS count zero.
+        static size_t payload_size(const SharedAny& datum);
+
+      private:
+        using clock_t = std::chrono::steady_clock;
+        clock_t::time_point m_start;
+
+        mutable std::mutex m_mutex;
+        std::vector<std::string> m_nodes;
+        std::vector<Call> m_calls;
+        std::unordered_map<std::thread::id, size_t> m_threads;
+    };
+
+}  // namespace WireCell::Aux
+
+#endif
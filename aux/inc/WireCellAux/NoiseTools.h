@@ -17,6 +17,7 @@ namespace WireCell::Aux::NoiseTools {
 
 
     using real_vector_t = std::vector<float>;
+    using complex_t = std::complex<float>;
     using complex_vector_t = std::vector< std::complex<float> >;
     
     // Return size which optimizes for both spectral resolution and
@@ -226,6 +227,22 @@ namespace WireCell::Aux::NoiseTools {
 
         // Return a fluctuated, real x_n time series
         virtual real_vector_t wave(const real_vector_t& sigma) = 0;
+
+        // Fill "half" with the first sigma.size()/2+1 elements of a
+        // fluctuated spectrum.  This consumes the same randoms as
+        // spec().  The default is implemented with spec().
+        virtual void half_spec(const real_vector_t& sigma, complex_t* half);
+
+        // Return one fluctuated time series for each of the sigma
+        // spectra.  All must have the same size, nsamples.  The
+        // nsigmas time series are returned as rows of a row-major
+        // (nsigmas, nsamples) array made with a single batched
+        // inverse DFT.  Randoms are consumed as if wave() were
+        // called on each sigma in order.
+        virtual real_vector_t waves(const std::vector<const real_vector_t*>& sigmas) = 0;
+
+      protected:
+        real_vector_t batch_waves(IDFT::pointer dft, const std::vector<const real_vector_t*>& sigmas);
     };
 
     /** Generate via normal randoms:
@@ -246,6 +263,8 @@ namespace WireCell::Aux::NoiseTools {
         virtual ~GeneratorN();
         virtual complex_vector_t spec(const real_vector_t& sigma);
         virtual real_vector_t wave(const real_vector_t& sigma);
+        virtual void half_spec(const real_vector_t& sigma, complex_t* half);
+        virtual real_vector_t waves(const std::vector<const real_vector_t*>& sigmas);
 
       private:
         IDFT::pointer dft;
@@ -269,6 +288,8 @@ namespace WireCell::Aux::NoiseTools {
         virtual ~GeneratorU();
         virtual complex_vector_t spec(const real_vector_t& sigma);
         virtual real_vector_t wave(const real_vector_t& sigma);
+        virtual void half_spec(const real_vector_t& sigma, complex_t* half);
+        virtual real_vector_t waves(const std::vector<const real_vector_t*>& sigmas);
 
       private:
         IDFT::pointer dft;
@@ -1,5 +1,9 @@
 #include "WireCellIface/ICluster.h"
 #include "WireCellUtil/Graph.h"
+
+#include <memory>
+#include <mutex>
+
 namespace WireCell::Aux {
 
     class SimpleCluster : public ICluster {
@@ -13,11 +17,23 @@ namespace WireCell::Aux {
         virtual ~SimpleCluster() {}
         const cluster_graph_t& graph() const { return m_graph; }
 
+        // The CSR form is made on first access.  Modifying the graph
+        // via the non-const access after that leaves it stale.
+        const cluster_csr_t& csr() const
+        {
+            std::call_once(m_csr_once, [this]() {
+                m_csr = std::make_unique<cluster_csr_t>(m_graph);
+            });
+            return *m_csr;
+        }
+
         // Non-const access for creators
         cluster_graph_t& graph() { return m_graph; }
 
        private:
         int m_ident;
         cluster_graph_t m_graph;
+        mutable std::unique_ptr<cluster_csr_t> m_csr;
+        mutable std::once_flag m_csr_once;
     };
 }  // namespace WireCell::Aux
@@ -2,6 +2,10 @@
 #define WIRECELLAUX_SIMPLESLICE
 
 #include "WireCellIface/ISlice.h"
+#include "WireCellAux/SliceTools.h"
+
+#include <atomic>
+#include <mutex>
 
 namespace WireCell::Aux {
 
@@ -9,11 +13,25 @@ namespace WireCell::Aux {
         IFrame::pointer m_frame{nullptr};
         int m_ident{0};
         double m_start{0}, m_span{0};
-        ISlice::map_t m_activity{};
+        // Activity filled via the mutable activity() accessor.  It
+        // is moved to the compact m_dense on first const access and
+        // moved back by a later fill access.
+        mutable ISlice::map_t m_activity{};
+        mutable ISlice::dense_t m_dense{};
+        mutable std::atomic<bool> m_frozen{false};
+        mutable std::mutex m_freeze_mutex;
 
         SimpleSlice(IFrame::pointer frame, int ident, double start, double span, const ISlice::map_t& activity)
             : m_frame(frame), m_ident(ident), m_start(start), m_span(span), m_activity(activity) { }
 
+        // Construct from a dense activity which must be sorted by
+        // channel ident.
+        SimpleSlice(IFrame::pointer frame, int ident, double start, double span, ISlice::dense_t dense)
+            : m_frame(frame), m_ident(ident), m_start(start), m_span(span), m_dense(std::move(dense))
+        {
+            freeze();
+        }
+
         // Construct with no activity, user must fill in after construction.
         SimpleSlice(IFrame::pointer frame, int ident, double start, double span)
             : m_frame(frame), m_ident(ident), m_start(start), m_span(span) { }
@@ -25,8 +43,46 @@ namespace WireCell::Aux {
         int ident() const { return m_ident; }
         double start() const { return m_start; }
         double span() const { return m_span; }
-        map_t activity() const { return m_activity; }
-        map_t& activity() { return m_activity; }
+        map_t activity() const { return Aux::activity_map(dense_activity()); }
+        const dense_t& dense_activity() const { freeze(); return m_dense; }
+
+        // Fill access.  If the activity was already frozen it is
+        // first restored to the map which invalidates any reference
+        // earlier returned by dense_activity().  Not safe against
+        // concurrent reads through the ISlice interface.
+        map_t& activity() { thaw(); return m_activity; }
+
+        // Move any filled activity into its compact, sorted form.
+        void freeze() const {
+            if (m_frozen.load(std::memory_order_acquire)) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(m_freeze_mutex);
+            if (m_frozen.load(std::memory_order_relaxed)) {
+                return;
+            }
+            if (! m_activity.empty()) {
+                m_dense = Aux::dense_activity(m_activity);
+                map_t().swap(m_activity);
+            }
+            m_frozen.store(true, std::memory_order_release);
+        }
+
+        // Undo freeze() so the activity may be modified.  This
+        // releases the dense form and so invalidates any reference
+        // earlier returned by dense_activity().
+        void thaw() {
+            if (! m_frozen.load(std::memory_order_acquire)) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(m_freeze_mutex);
+            if (! m_frozen.load(std::memory_order_relaxed)) {
+                return;
+            }
+            m_activity = Aux::activity_map(m_dense);
+            dense_t().swap(m_dense);
+            m_frozen.store(false, std::memory_order_release);
+        }
     };
 }
 
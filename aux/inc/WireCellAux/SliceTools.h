@@ -28,6 +28,13 @@ namespace WireCell::Aux {
         const int nbins = 1 + round((*l-*f)/span);
         return Binning(nbins, *f, *f + nbins*span);
     }
+
+    // Return the dense form of a channel/value map, sorted by
+    // channel ident.
+    ISlice::dense_t dense_activity(const ISlice::map_t& activity);
+
+    // Return the map form of a dense activity.
+    ISlice::map_t activity_map(const ISlice::dense_t& dense);
 }
 
 #endif
@@ -55,7 +55,7 @@ std::string Aux::dumps(const IBlobSet::pointer& bs)
        << " spans "  << slices.size() << " slices, main slice:";
     auto islice = bs->slice();
     if (islice) {
-        ss << islice->ident() << " with " << islice->activity().size() << " activities, span="
+        ss << islice->ident() << " with " << islice->dense_activity().size() << " activities, span="
            << islice->start()/units::us << "+" << islice->span()/units::us << " us";
         
     }
@@ -124,7 +124,7 @@ Json::Value slice_jsoner(const cluster_node_t& n)
 
     // note: used to be SOA, now AOS.
     Json::Value jsignal = Json::arrayValue;
-    for (const auto& it : islice->activity()) {
+    for (const auto& it : islice->dense_activity()) {
         Json::Value jact = Json::objectValue;
         jact["ident"] = it.first->ident();
         const double val = it.second.value();
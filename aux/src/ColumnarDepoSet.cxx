@@ -0,0 +1,113 @@
+#include "WireCellAux/ColumnarDepoSet.h"
+#include "WireCellAux/SimpleDepo.h"
+
+using namespace WireCell;
+using WireCell::Aux::ColumnarDepoSet;
+
+ColumnarDepoSet::Columns::Columns(const IDepo::vector& depos)
+{
+    const size_t ndepos = depos.size();
+    resize(ndepos);
+    prior.resize(ndepos);
+    for (size_t ind = 0; ind < ndepos; ++ind) {
+        const auto& depo = depos[ind];
+        const auto& pos = depo->pos();
+        time[ind] = depo->time();
+        x[ind] = pos.x();
+        y[ind] = pos.y();
+        z[ind] = pos.z();
+        charge[ind] = depo->charge();
+        energy[ind] = depo->energy();
+        extent_long[ind] = depo->extent_long();
+        extent_tran[ind] = depo->extent_tran();
+        id[ind] = depo->id();
+        pdg[ind] = depo->pdg();
+        prior[ind] = depo->prior();
+    }
+}
+
+void ColumnarDepoSet::Columns::resize(size_t size)
+{
+    for (auto* col : {&time, &x, &y, &z, &charge, &energy, &extent_long, &extent_tran}) {
+        col->resize(size);
+    }
+    id.resize(size);
+    pdg.resize(size);
+    if (prior.size()) {
+        prior.resize(size);
+    }
+    if (prior_row.size()) {
+        prior_row.resize(size);
+    }
+}
+
+template <typename Vec>
+static void gather(const Vec& from, Vec& to, const std::vector<size_t>& rows)
+{
+    to.resize(rows.size());
+    for (size_t ind = 0; ind < rows.size(); ++ind) {
+        to[ind] = from[rows[ind]];
+    }
+}
+
+ColumnarDepoSet::Columns ColumnarDepoSet::Columns::take(const std::vector<size_t>& rows) const
+{
+    Columns ret;
+    gather(time, ret.time, rows);
+    gather(x, ret.x, rows);
+    gather(y, ret.y, rows);
+    gather(z, ret.z, rows);
+    gather(charge, ret.charge, rows);
+    gather(energy, ret.energy, rows);
+    gather(extent_long, ret.extent_long, rows);
+    gather(extent_tran, ret.extent_tran, rows);
+    gather(id, ret.id, rows);
+    gather(pdg, ret.pdg, rows);
+    if (prior.size()) {
+        gather(prior, ret.prior, rows);
+    }
+    if (prior_row.size()) {
+        gather(prior_row, ret.prior_row, rows);
+    }
+    return ret;
+}
+
+ColumnarDepoSet::ColumnarDepoSet(int ident, Columns columns, IDepoSet::pointer priors)
+  : m_ident(ident)
+  , m_columns(std::move(columns))
+  , m_priors(priors)
+{
+}
+
+ColumnarDepoSet::~ColumnarDepoSet() {}
+
+IDepo::shared_vector ColumnarDepoSet::depos() const
+{
+    std::call_once(m_once, [&]() {
+        const auto& c = m_columns;
+        const size_t ndepos = c.size();
+
+        IDepo::shared_vector priors;
+        if (c.prior.empty() and c.prior_row.size() and m_priors) {
+            priors = m_priors->depos();
+        }
+
+        // One allocation holds every depo.  Each IDepo::pointer
+        // shares ownership of the whole block.
+        auto block = std::make_shared<std::vector<SimpleDepo>>();
+        block->reserve(ndepos);
+        for (size_t ind = 0; ind < ndepos; ++ind) {
+            block->emplace_back(c.time[ind], Point(c.x[ind], c.y[ind], c.z[ind]), c.charge[ind],
+                                c.prior.size() ? c.prior[ind] : (priors ? priors->at(c.prior_row[ind]) : nullptr),
+                                c.extent_long[ind], c.extent_tran[ind],
+                                c.id[ind], c.pdg[ind], c.energy[ind]);
+        }
+        auto depos = std::make_shared<IDepo::vector>();
+        depos->reserve(ndepos);
+        for (auto& depo : *block) {
+            depos->push_back(IDepo::pointer(block, &depo));
+        }
+        m_depos = depos;
+    });
+    return m_depos;
+}
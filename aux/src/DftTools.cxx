@@ -23,10 +23,14 @@ DftTools::complex_vector_t DftTools::fwd(const IDFT::pointer& dft, const DftTool
 
 DftTools::complex_vector_t DftTools::fwd_r2c(const IDFT::pointer& dft, const DftTools::real_vector_t& vec)
 {
-    complex_vector_t cvec(vec.size());
-    std::transform(vec.begin(), vec.end(), cvec.begin(),
-                   [](float re) { return DftTools::complex_t(re,0.0); } );
-    return fwd(dft, cvec);
+    // r2c fills the first half, mirror fills the rest.
+    complex_vector_t ret(vec.size());
+    if (ret.empty()) {
+        return ret;
+    }
+    dft->fwd1d_r2c(vec.data(), ret.data(), ret.size());
+    hermitian_mirror(ret.begin(), ret.end());
+    return ret;
 }
 
 DftTools::complex_vector_t DftTools::inv(const IDFT::pointer& dft, const DftTools::complex_vector_t& spec)
@@ -38,14 +42,12 @@ DftTools::complex_vector_t DftTools::inv(const IDFT::pointer& dft, const DftTool
 
 DftTools::real_vector_t DftTools::inv_c2r(const IDFT::pointer& dft, const DftTools::complex_vector_t& spec)
 {
-    // fixme: in future, expand IDFT to have c2r 
-    complex_vector_t symspec(spec.size());
-    hermitian_mirror(spec.begin(), spec.end(), symspec.begin());
-
-    auto cvec = inv(dft, symspec);
-    real_vector_t rvec(cvec.size());
-    std::transform(cvec.begin(), cvec.end(), rvec.begin(),
-                   [](const DftTools::complex_t& c) { return std::real(c); });
+    // c2r reads only up to the Nyquist bin.
+    real_vector_t rvec(spec.size());
+    if (rvec.empty()) {
+        return rvec;
+    }
+    dft->inv1d_c2r(spec.data(), rvec.data(), rvec.size());
     return rvec;
 }
 
@@ -124,18 +126,47 @@ DftTools::complex_array_t DftTools::inv(const IDFT::pointer& dft, const DftTools
 }
 
 
+// The r2c/c2r array functions follow the same storage order notes as
+// fwd()/inv() above.  In column-wise storage, the half spectrum along
+// logical axis 0 is the top rows and along axis 1 is the left columns.
+
 DftTools::complex_array_t DftTools::fwd_r2c(const IDFT::pointer& dft, const DftTools::real_array_t& wave, int axis)
 {
-    complex_array_t cwave = wave.cast<complex_t>();
-    return fwd(dft, cwave, axis);
+    const int nrows = wave.rows(), ncols = wave.cols();
+    complex_array_t ret = complex_array_t::Zero(nrows, ncols);
+    if (!nrows or !ncols) {
+        return ret;
+    }
+    if (axis == 0) {
+        complex_array_t half(nrows/2+1, ncols);
+        dft->fwd1b_r2c(wave.data(), half.data(), ncols, nrows, 1);
+        ret.topRows(nrows/2+1) = half;
+    }
+    else {
+        complex_array_t half(nrows, ncols/2+1);
+        dft->fwd1b_r2c(wave.data(), half.data(), ncols, nrows, 0);
+        ret.leftCols(ncols/2+1) = half;
+    }
+    hermitian_mirror_inplace(ret, axis);
+    return ret;
 }
 
 DftTools::real_array_t DftTools::inv_c2r(const IDFT::pointer& dft, const DftTools::complex_array_t& spec, int axis)
 {
-    complex_array_t symspec = hermitian_mirror(spec, axis);
-    complex_array_t cwave = inv(dft, symspec, axis);
-    // Drops the small imaginary that is accrued due to round-off errors.
-    return cwave.real();        
+    const int nrows = spec.rows(), ncols = spec.cols();
+    real_array_t ret(nrows, ncols);
+    if (!nrows or !ncols) {
+        return ret;
+    }
+    if (axis == 0) {
+        complex_array_t half = spec.topRows(nrows/2+1);
+        dft->inv1b_c2r(half.data(), ret.data(), ncols, nrows, 1);
+    }
+    else {
+        complex_array_t half = spec.leftCols(ncols/2+1);
+        dft->inv1b_c2r(half.data(), ret.data(), ncols, nrows, 0);
+    }
+    return ret;
 }
 
 
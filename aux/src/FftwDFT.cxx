@@ -1,42 +1,77 @@
 #include "WireCellAux/FftwDFT.h"
 #include "WireCellUtil/NamedFactory.h"
+#include "WireCellUtil/Exceptions.h"
+
+#include <boost/functional/hash.hpp>
 
 #include <fftw3.h>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
 #include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
+#include <vector>
 
-WIRECELL_FACTORY(FftwDFT, WireCell::Aux::FftwDFT, WireCell::IDFT)
+WIRECELL_FACTORY(FftwDFT, WireCell::Aux::FftwDFT,
+                 WireCell::INamed,
+                 WireCell::IDFT,
+                 WireCell::IConfigurable,
+                 WireCell::ITerminal)
 
 
 using namespace WireCell;
 
-using plan_key_t = int64_t;
 using plan_type = fftwf_plan;
-using plan_map_t = std::unordered_map<plan_key_t, plan_type>;
 using plan_val_t = fftwf_complex;
 
-// Make a key by which a plan is known.  dir should be FFTW_FORWARD or
-// FFTW_BACKWARD and "axis" is -1 for all or in {0,1} for one of 2D.
-// For 1D, use the default axis=-1.
+// The key by which a plan is known.  A plan may be executed on any
+// arrays of the same shape, in-place-ness and alignment as those it
+// was made with, so we key on those and not on the array addresses.
 //
-// Imp note: The key is slightly over-specified as we keep one
-// independent cache for each of the six methods.  The "dir" is
-// thus redundant.
+// Imp note: we keep one independent cache for each method so the
+// transform direction and type need not be part of the key.
+struct PlanKey {
+    int nrows{1}, ncols{0};
+    int axis{-1};               // -1 for all or in {0,1} for one of 2D
+    bool inplace{false};
+    int ialign{0}, oalign{0};   // as given by fftwf_alignment_of()
+
+    bool operator==(const PlanKey& o) const {
+        return nrows == o.nrows && ncols == o.ncols && axis == o.axis
+            && inplace == o.inplace && ialign == o.ialign && oalign == o.oalign;
+    }
+};
+struct PlanKeyHash {
+    size_t operator()(const PlanKey& k) const {
+        size_t seed = 0;
+        boost::hash_combine(seed, k.nrows);
+        boost::hash_combine(seed, k.ncols);
+        boost::hash_combine(seed, k.axis);
+        boost::hash_combine(seed, k.inplace);
+        boost::hash_combine(seed, k.ialign);
+        boost::hash_combine(seed, k.oalign);
+        return seed;
+    }
+};
+using plan_map_t = std::unordered_map<PlanKey, plan_type, PlanKeyHash>;
+
 static
-plan_key_t make_key(const void * src, void * dst, int nrows, int ncols, int dir, int axis=-1)
+PlanKey make_key(const void * src, void * dst, int nrows, int ncols, int axis=-1)
 {
-    ++axis;                     // need three positive values, default is both axis 
-    bool inverse = dir == FFTW_BACKWARD;
-    bool inplace = (dst==src);
-    bool aligned = ( (reinterpret_cast<size_t>(src)&15) | (reinterpret_cast<size_t>(dst)&15) ) == 0;
-    int64_t key = ( ( (((int64_t)nrows) << 32)| (ncols<<5 ) | (axis<<3) | (inverse<<2) | (inplace<<1) | aligned ) << 1 ) + 1;
+    PlanKey key;
+    key.nrows = nrows;
+    key.ncols = ncols;
+    key.axis = axis;
+    key.inplace = (src == dst);
+    key.ialign = fftwf_alignment_of((float*)src);
+    key.oalign = fftwf_alignment_of((float*)dst);
     return key;
 }
 
 // Look up a plan by key or return NULL
 static
-plan_type get_plan(std::shared_mutex& mutex, plan_map_t& plans, plan_key_t key)
+plan_type get_plan(std::shared_mutex& mutex, plan_map_t& plans, const PlanKey& key)
 {
     std::shared_lock lock(mutex);
     auto it = plans.find(key);
@@ -46,18 +81,63 @@ plan_type get_plan(std::shared_mutex& mutex, plan_map_t& plans, plan_key_t key)
     return it->second;
 }
 
+// The FFTW planner is not thread safe (only fftw_execute*() are).
+// Each method has its own cache but all must share one planner lock.
+static std::mutex& planner_mutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+// The planner rigor flag is shared by all instances, as are the plans.
+static std::atomic<unsigned>& planner_rigor()
+{
+    static std::atomic<unsigned> rigor{FFTW_ESTIMATE};
+    return rigor;
+}
+
+// Any rigor beyond FFTW_ESTIMATE runs transforms while planning which
+// would overwrite the caller's arrays.  Such plans are made on scratch
+// arrays of the same alignment as the caller's, which is all a plan
+// requires of the arrays it is later executed on.
+struct ScratchArray {
+    void* base{nullptr};
+    ScratchArray(size_t nbytes) : base(fftwf_malloc(nbytes + 64)) {}
+    ~ScratchArray() { fftwf_free(base); }
+    template<typename ValueType>
+    ValueType* data(int align) { return reinterpret_cast<ValueType*>((char*)base + align); }
+};
 
 // #include <iostream>             // debugging
 
-using planner_function = std::function<plan_type()>;
+template<typename InType, typename OutType>
+using planner_function = std::function<plan_type(InType*, OutType*)>;
+
+template<typename InType, typename OutType>
+plan_type make_plan(const PlanKey& key, InType* src, OutType* dst,
+                    size_t nin, size_t nout,
+                    planner_function<InType, OutType> planner)
+{
+    if (planner_rigor() == FFTW_ESTIMATE) {
+        return planner(src, dst);
+    }
+    const size_t ibytes = nin*sizeof(InType), obytes = nout*sizeof(OutType);
+    if (key.inplace) {
+        ScratchArray sa(std::max(ibytes, obytes));
+        return planner(sa.data<InType>(key.ialign), sa.data<OutType>(key.ialign));
+    }
+    ScratchArray si(ibytes), so(obytes);
+    return planner(si.data<InType>(key.ialign), so.data<OutType>(key.oalign));
+}
 
 // This wraps plan lookup, possible plan creation and subsequent plan
-// execution so that we get thread-safe plan caching.
-template<typename ValueType>
-void doit(std::shared_mutex& mutex, plan_map_t& plans, plan_key_t key,
-          ValueType* src, ValueType* dst,
-          planner_function make_plan,
-          std::function<void(const plan_type, ValueType*, ValueType*)> exec_plan)
+// execution so that we get thread-safe plan caching.  The nin and nout
+// give the number of elements of the src and dst arrays.
+template<typename InType, typename OutType>
+void doit(std::shared_mutex& mutex, plan_map_t& plans, const PlanKey& key,
+          InType* src, OutType* dst, size_t nin, size_t nout,
+          planner_function<InType, OutType> planner,
+          std::function<void(const plan_type, InType*, OutType*)> exec_plan)
 {
     auto plan = get_plan(mutex, plans, key);
     if (!plan) {
@@ -65,19 +145,20 @@ void doit(std::shared_mutex& mutex, plan_map_t& plans, plan_key_t key,
         // Check again in case another thread snakes us.
         auto it = plans.find(key);
         if (it == plans.end()) {
-            //std::cerr << "make plan for " << key << std::endl;
-            plan = make_plan();
+            std::lock_guard<std::mutex> plock(planner_mutex());
+            plan = make_plan(key, src, dst, nin, nout, planner);
+            if (!plan) {
+                raise<ValueError>("FftwDFT: failed to plan for shape (%d,%d)", key.nrows, key.ncols);
+            }
             plans[key] = plan;
         }
         else {
             plan = it->second;
         }
     }
-    //fftwf_execute_dft(plan, src, dst);
     exec_plan(plan, src, dst);
 }
 
-
 static
 plan_val_t* pval_cast( const IDFT::complex_t * p)
 { 
@@ -92,9 +173,9 @@ void Aux::FftwDFT::fwd1d(const complex_t* in, complex_t* out, int ncols) const
     static const int dir = FFTW_FORWARD;
     auto src = pval_cast(in);
     auto dst = pval_cast(out);
-    auto key = make_key(src, dst, 1, ncols, dir);
-    doit<plan_val_t>(mutex, plans, key, src, dst, [&]( ) {
-        return fftwf_plan_dft_1d(ncols, src, dst, dir, FFTW_ESTIMATE|FFTW_PRESERVE_INPUT);
+    auto key = make_key(src, dst, 1, ncols);
+    doit<plan_val_t, plan_val_t>(mutex, plans, key, src, dst, ncols, ncols, [&](plan_val_t* pin, plan_val_t* pout) {
+        return fftwf_plan_dft_1d(ncols, pin, pout, dir, planner_rigor()|FFTW_PRESERVE_INPUT);
     }, fftwf_execute_dft);
 }
 void Aux::FftwDFT::inv1d(const complex_t* in, complex_t* out, int ncols) const
@@ -104,10 +185,10 @@ void Aux::FftwDFT::inv1d(const complex_t* in, complex_t* out, int ncols) const
     static const int dir = FFTW_BACKWARD;
     auto src = pval_cast(in);
     auto dst = pval_cast(out);
-    auto key = make_key(src, dst, 1, ncols, dir);
+    auto key = make_key(src, dst, 1, ncols);
 
-    doit<plan_val_t>(mutex, plans, key, src, dst, [&]( ) {
-        return fftwf_plan_dft_1d(ncols, src, dst, dir, FFTW_ESTIMATE|FFTW_PRESERVE_INPUT);
+    doit<plan_val_t, plan_val_t>(mutex, plans, key, src, dst, ncols, ncols, [&](plan_val_t* pin, plan_val_t* pout) {
+        return fftwf_plan_dft_1d(ncols, pin, pout, dir, planner_rigor()|FFTW_PRESERVE_INPUT);
     }, fftwf_execute_dft);
 
     // Apply 1/n normalization
@@ -117,6 +198,7 @@ void Aux::FftwDFT::inv1d(const complex_t* in, complex_t* out, int ncols) const
 }
 
 
+static
 fftwf_plan plan_1b(fftwf_complex *in, fftwf_complex *out,
                    int nrows, int ncols, int sign, int axis)
 {
@@ -135,7 +217,7 @@ fftwf_plan plan_1b(fftwf_complex *in, fftwf_complex *out,
     }
     int *inembed=&n, *onembed=&n;
 
-    unsigned int flags =  FFTW_ESTIMATE|FFTW_PRESERVE_INPUT;
+    unsigned int flags =  planner_rigor()|FFTW_PRESERVE_INPUT;
 
     return fftwf_plan_many_dft(rank, &n, howmany,
                                in, inembed,
@@ -153,10 +235,10 @@ void Aux::FftwDFT::fwd1b(const complex_t* in, complex_t* out, int nrows, int nco
     static const int dir = FFTW_FORWARD;
     auto src = pval_cast(in);
     auto dst = pval_cast(out);
-    auto key = make_key(src, dst, nrows, ncols, dir, axis);
+    auto key = make_key(src, dst, nrows, ncols, axis);
 
-    doit<plan_val_t>(mutex, plans, key, src, dst, [&]( ) {
-        return plan_1b(src, dst, nrows, ncols, dir, axis);
+    doit<plan_val_t, plan_val_t>(mutex, plans, key, src, dst, nrows*ncols, nrows*ncols, [&](plan_val_t* pin, plan_val_t* pout) {
+        return plan_1b(pin, pout, nrows, ncols, dir, axis);
     }, fftwf_execute_dft);
 }
 
@@ -168,10 +250,10 @@ void Aux::FftwDFT::inv1b(const complex_t* in, complex_t* out, int nrows, int nco
     static const int dir = FFTW_BACKWARD;
     auto src = pval_cast(in);
     auto dst = pval_cast(out);
-    auto key = make_key(src, dst, nrows, ncols, dir, axis);
+    auto key = make_key(src, dst, nrows, ncols, axis);
 
-    doit<plan_val_t>(mutex, plans, key, src, dst, [&]( ) {
-        return plan_1b(src, dst, nrows, ncols, dir, axis);
+    doit<plan_val_t, plan_val_t>(mutex, plans, key, src, dst, nrows*ncols, nrows*ncols, [&](plan_val_t* pin, plan_val_t* pout) {
+        return plan_1b(pin, pout, nrows, ncols, dir, axis);
     }, fftwf_execute_dft);
 
     // 1/n normalization
@@ -190,9 +272,9 @@ void Aux::FftwDFT::fwd2d(const complex_t* in, complex_t* out, int nrows, int nco
     static const int dir = FFTW_FORWARD;
     auto src = pval_cast(in);
     auto dst = pval_cast(out);
-    auto key = make_key(src, dst, nrows, ncols, dir);
-    doit<plan_val_t>(mutex, plans, key, src, dst, [&]( ) {
-        return fftwf_plan_dft_2d(ncols, nrows, src, dst, dir, FFTW_ESTIMATE|FFTW_PRESERVE_INPUT);
+    auto key = make_key(src, dst, nrows, ncols);
+    doit<plan_val_t, plan_val_t>(mutex, plans, key, src, dst, nrows*ncols, nrows*ncols, [&](plan_val_t* pin, plan_val_t* pout) {
+        return fftwf_plan_dft_2d(ncols, nrows, pin, pout, dir, planner_rigor()|FFTW_PRESERVE_INPUT);
     }, fftwf_execute_dft);
 }
 
@@ -204,9 +286,9 @@ void Aux::FftwDFT::inv2d(const complex_t* in, complex_t* out, int nrows, int nco
     static const int dir = FFTW_BACKWARD;
     auto src = pval_cast(in);
     auto dst = pval_cast(out);
-    auto key = make_key(src, dst, nrows, ncols, dir);
-    doit<plan_val_t>(mutex, plans, key, src, dst, [&]( ) {
-        return fftwf_plan_dft_2d(ncols, nrows, src, dst, dir, FFTW_ESTIMATE|FFTW_PRESERVE_INPUT);
+    auto key = make_key(src, dst, nrows, ncols);
+    doit<plan_val_t, plan_val_t>(mutex, plans, key, src, dst, nrows*ncols, nrows*ncols, [&](plan_val_t* pin, plan_val_t* pout) {
+        return fftwf_plan_dft_2d(ncols, nrows, pin, pout, dir, planner_rigor()|FFTW_PRESERVE_INPUT);
     }, fftwf_execute_dft);
 
     // reverse normalization
@@ -217,11 +299,154 @@ void Aux::FftwDFT::inv2d(const complex_t* in, complex_t* out, int nrows, int nco
 }
 
 
+// Real-valued transforms.
+//
+// FFTW c2r transforms destroy their input and multi-dimensional c2r
+// can not be told otherwise.  The IDFT input is const so c2r methods
+// first copy to a per-thread workspace which is reused between calls.
+
+static
+IDFT::complex_t* c2r_workspace(const IDFT::complex_t* in, size_t size)
+{
+    thread_local std::vector<IDFT::complex_t> work;
+    if (work.size() < size) {
+        work.resize(size);
+    }
+    std::copy(in, in+size, work.begin());
+    return work.data();
+}
+
+// Number of complex elements when (nrows,ncols) is halved along axis.
+static
+size_t half_size(int nrows, int ncols, int axis)
+{
+    return axis ? nrows*(ncols/2+1) : (nrows/2+1)*ncols;
+}
+
+// Make a batched r2c or c2r plan.  The real array has shape (nrows,
+// ncols) and the complex array has the transformed axis halved.
+static
+fftwf_plan plan_1b_real(float* real, fftwf_complex* cplx,
+                        int nrows, int ncols, int axis, bool forward)
+{
+    const int rank = 1;
+    int n = ncols;              // along rows
+    int howmany = nrows;
+    int rstride = 1, cstride = 1;
+    int rdist = ncols, cdist = ncols/2+1;
+    if (axis == 0) {            // along columns
+        n = nrows;
+        howmany = ncols;
+        rstride = cstride = ncols;
+        rdist = cdist = 1;
+    }
+    if (forward) {
+        return fftwf_plan_many_dft_r2c(rank, &n, howmany,
+                                       real, NULL, rstride, rdist,
+                                       cplx, NULL, cstride, cdist,
+                                       planner_rigor()|FFTW_PRESERVE_INPUT);
+    }
+    return fftwf_plan_many_dft_c2r(rank, &n, howmany,
+                                   cplx, NULL, cstride, cdist,
+                                   real, NULL, rstride, rdist,
+                                   planner_rigor()|FFTW_DESTROY_INPUT);
+}
+
+void Aux::FftwDFT::fwd1d_r2c(const scalar_t* in, complex_t* out, int ncols) const
+{
+    static std::shared_mutex mutex;
+    static plan_map_t plans;
+    auto src = const_cast<scalar_t*>(in);
+    auto dst = pval_cast(out);
+    auto key = make_key(src, dst, 1, ncols);
+    doit<float, plan_val_t>(mutex, plans, key, src, dst, ncols, ncols/2+1, [&](float* pin, plan_val_t* pout) {
+        return fftwf_plan_dft_r2c_1d(ncols, pin, pout, planner_rigor()|FFTW_PRESERVE_INPUT);
+    }, fftwf_execute_dft_r2c);
+}
+
+void Aux::FftwDFT::inv1d_c2r(const complex_t* in, scalar_t* out, int ncols) const
+{
+    static std::shared_mutex mutex;
+    static plan_map_t plans;
+    auto src = pval_cast(c2r_workspace(in, ncols/2+1));
+    auto dst = out;
+    auto key = make_key(src, dst, 1, ncols);
+    doit<plan_val_t, float>(mutex, plans, key, src, dst, ncols/2+1, ncols, [&](plan_val_t* pin, float* pout) {
+        return fftwf_plan_dft_c2r_1d(ncols, pin, pout, planner_rigor()|FFTW_DESTROY_INPUT);
+    }, fftwf_execute_dft_c2r);
+
+    for (int ind=0; ind<ncols; ++ind) {
+        out[ind] /= ncols;
+    }
+}
+
+void Aux::FftwDFT::fwd1b_r2c(const scalar_t* in, complex_t* out, int nrows, int ncols, int axis) const
+{
+    static std::shared_mutex mutex;
+    static plan_map_t plans;
+    const size_t nhalf = half_size(nrows, ncols, axis);
+    auto src = const_cast<scalar_t*>(in);
+    auto dst = pval_cast(out);
+    auto key = make_key(src, dst, nrows, ncols, axis);
+    doit<float, plan_val_t>(mutex, plans, key, src, dst, nrows*ncols, nhalf, [&](float* pin, plan_val_t* pout) {
+        return plan_1b_real(pin, pout, nrows, ncols, axis, true);
+    }, fftwf_execute_dft_r2c);
+}
+
+void Aux::FftwDFT::inv1b_c2r(const complex_t* in, scalar_t* out, int nrows, int ncols, int axis) const
+{
+    static std::shared_mutex mutex;
+    static plan_map_t plans;
+    const size_t nhalf = half_size(nrows, ncols, axis);
+    auto src = pval_cast(c2r_workspace(in, nhalf));
+    auto dst = out;
+    auto key = make_key(src, dst, nrows, ncols, axis);
+    doit<plan_val_t, float>(mutex, plans, key, src, dst, nhalf, nrows*ncols, [&](plan_val_t* pin, float* pout) {
+        return plan_1b_real(pout, pin, nrows, ncols, axis, false);
+    }, fftwf_execute_dft_c2r);
+
+    const int norm = axis ? ncols : nrows;
+    const int ntot = ncols*nrows;
+    for (int ind=0; ind<ntot; ++ind) {
+        out[ind] /= norm;
+    }
+}
+
+void Aux::FftwDFT::fwd2d_r2c(const scalar_t* in, complex_t* out, int nrows, int ncols) const
+{
+    static std::shared_mutex mutex;
+    static plan_map_t plans;
+    auto src = const_cast<scalar_t*>(in);
+    auto dst = pval_cast(out);
+    auto key = make_key(src, dst, nrows, ncols);
+    doit<float, plan_val_t>(mutex, plans, key, src, dst, nrows*ncols, nrows*(ncols/2+1), [&](float* pin, plan_val_t* pout) {
+        return fftwf_plan_dft_r2c_2d(nrows, ncols, pin, pout, planner_rigor()|FFTW_PRESERVE_INPUT);
+    }, fftwf_execute_dft_r2c);
+}
+
+void Aux::FftwDFT::inv2d_c2r(const complex_t* in, scalar_t* out, int nrows, int ncols) const
+{
+    static std::shared_mutex mutex;
+    static plan_map_t plans;
+    auto src = pval_cast(c2r_workspace(in, nrows*(ncols/2+1)));
+    auto dst = out;
+    auto key = make_key(src, dst, nrows, ncols);
+    doit<plan_val_t, float>(mutex, plans, key, src, dst, nrows*(ncols/2+1), nrows*ncols, [&](plan_val_t* pin, float* pout) {
+        return fftwf_plan_dft_c2r_2d(nrows, ncols, pin, pout, planner_rigor()|FFTW_DESTROY_INPUT);
+    }, fftwf_execute_dft_c2r);
+
+    const int ntot = ncols*nrows;
+    for (int ind=0; ind<ntot; ++ind) {
+        out[ind] /= ntot;
+    }
+}
+
+
 // based on example from fftw3 faq
 static
 plan_type transpose_plan_complex(plan_val_t *in, plan_val_t *out, int rows, int cols)
 {
-    const unsigned flags = FFTW_ESTIMATE; /* other flags are possible */
+    const unsigned flags = planner_rigor();
     fftw_iodim howmany_dims[2];
 
     howmany_dims[0].n  = rows;
@@ -241,19 +466,18 @@ void Aux::FftwDFT::transpose(const complex_t* in, complex_t* out,
 {
     static std::shared_mutex mutex;
     static plan_map_t plans;
-    static const int dir = 0;
     auto src = pval_cast(in);
     auto dst = pval_cast(out);
-    auto key = make_key(src, dst, nrows, ncols, dir);
-    doit<plan_val_t>(mutex, plans, key, src, dst, [&]( ) {
-        return transpose_plan_complex(src, dst, nrows, ncols);
+    auto key = make_key(src, dst, nrows, ncols);
+    doit<plan_val_t, plan_val_t>(mutex, plans, key, src, dst, nrows*ncols, nrows*ncols, [&](plan_val_t* pin, plan_val_t* pout) {
+        return transpose_plan_complex(pin, pout, nrows, ncols);
     }, fftwf_execute_dft);
 }
 
 static
 plan_type transpose_plan_real(float *in, float *out, int rows, int cols)
 {
-    const unsigned flags = FFTW_ESTIMATE; /* other flags are possible */
+    const unsigned flags = planner_rigor();
     fftw_iodim howmany_dims[2];
 
     howmany_dims[0].n  = rows;
@@ -273,19 +497,88 @@ void Aux::FftwDFT::transpose(const scalar_t* in, scalar_t* out,
 {
     static std::shared_mutex mutex;
     static plan_map_t plans;
-    static const int dir = 0;
     auto src = const_cast<scalar_t*>(in);
     auto dst = out;
-    auto key = make_key(src, dst, nrows, ncols, dir);
-    doit<float>(mutex, plans, key, src, dst, [&]( ) {
-        return transpose_plan_real(src, dst, nrows, ncols);
+    auto key = make_key(src, dst, nrows, ncols);
+    doit<float, float>(mutex, plans, key, src, dst, nrows*ncols, nrows*ncols, [&](float* pin, float* pout) {
+        return transpose_plan_real(pin, pout, nrows, ncols);
     }, fftwf_execute_r2r);
 }
 
 Aux::FftwDFT::FftwDFT()
+    : Aux::Logger("FftwDFT", "aux")
 {
 }
 Aux::FftwDFT::~FftwDFT()
 {
 }
 
+WireCell::Configuration Aux::FftwDFT::default_configuration() const
+{
+    Configuration cfg;
+
+    // The FFTW planner rigor, one of "estimate", "measure",
+    // "patient" or "exhaustive".  Beyond "estimate", planning a new
+    // shape runs and times candidate transforms.  This may take
+    // seconds for large shapes but the resulting plans are faster.
+    // As plans are shared by all FftwDFT instances in the process so
+    // is this setting.  It applies to plans made after configuration.
+    cfg["planning"] = "estimate";
+
+    // If not empty, name a file of FFTW "wisdom".  If the file exists
+    // it is loaded on configure so that plans for shapes it already
+    // knows cost nothing to make.  Accumulated wisdom is saved back
+    // on finalize if "save_wisdom" is true.
+    cfg["wisdom"] = "";
+    cfg["save_wisdom"] = true;
+
+    return cfg;
+}
+
+void Aux::FftwDFT::configure(const WireCell::Configuration& cfg)
+{
+    const std::string planning = get<std::string>(cfg, "planning", "estimate");
+    unsigned rigor = FFTW_ESTIMATE;
+    if (planning == "measure") {
+        rigor = FFTW_MEASURE;
+    }
+    else if (planning == "patient") {
+        rigor = FFTW_PATIENT;
+    }
+    else if (planning == "exhaustive") {
+        rigor = FFTW_EXHAUSTIVE;
+    }
+    else if (planning != "estimate") {
+        raise<ValueError>("FftwDFT: unknown planning \"%s\"", planning);
+    }
+    planner_rigor() = rigor;
+
+    m_wisdom = get<std::string>(cfg, "wisdom", "");
+    m_save_wisdom = get<bool>(cfg, "save_wisdom", true);
+    if (m_wisdom.empty() or !std::filesystem::exists(m_wisdom)) {
+        log->debug("planning: {}, no wisdom loaded", planning);
+        return;
+    }
+    std::lock_guard<std::mutex> plock(planner_mutex());
+    if (fftwf_import_wisdom_from_filename(m_wisdom.c_str())) {
+        log->debug("planning: {}, loaded wisdom from {}", planning, m_wisdom);
+    }
+    else {
+        log->warn("failed to load wisdom from {}", m_wisdom);
+    }
+}
+
+void Aux::FftwDFT::finalize()
+{
+    if (m_wisdom.empty() or !m_save_wisdom) {
+        return;
+    }
+    std::lock_guard<std::mutex> plock(planner_mutex());
+    if (fftwf_export_wisdom_to_filename(m_wisdom.c_str())) {
+        log->debug("saved wisdom to {}", m_wisdom);
+    }
+    else {
+        log->warn("failed to save wisdom to {}", m_wisdom);
+    }
+}
+
@@ -235,6 +235,61 @@ Aux::channel_list Aux::fill(Array::array_xxf& array,
 }
 
 
+Aux::roi_list Aux::rois(const ITrace::vector& traces, channel_list::iterator chit,
+                        channel_list::iterator chend)
+{
+    std::unordered_map<int, int> index;
+    for (int ind = 0; chit != chend; ++ind, ++chit) {
+        index[*chit] = ind;
+    }
+    std::vector<ITrace::vector> byrow(index.size());
+    for (const auto& trace : traces) {
+        auto it = index.find(trace->channel());
+        if (it == index.end()) {
+            continue;
+        }
+        byrow[it->second].push_back(trace);
+    }
+
+    roi_list ret;
+    std::vector<float> span;
+    for (int irow = 0; irow < (int) byrow.size(); ++irow) {
+        const auto& rtraces = byrow[irow];
+        if (rtraces.empty()) {
+            continue;
+        }
+
+        // Sum overlapping traces on one channel.
+        const auto tbinmm = tbin_range(rtraces);
+        span.assign(tbinmm.second - tbinmm.first, 0);
+        for (const auto& trace : rtraces) {
+            const auto& charge = trace->charge();
+            const int off = trace->tbin() - tbinmm.first;
+            for (size_t ind = 0; ind < charge.size(); ++ind) {
+                span[off + ind] += charge[ind];
+            }
+        }
+
+        const int nticks = span.size();
+        int itick = 0;
+        while (itick < nticks) {
+            if (span[itick] == 0) {
+                ++itick;
+                continue;
+            }
+            const int beg = itick;
+            while (itick < nticks and span[itick] != 0) {
+                ++itick;
+            }
+            ret.rois.push_back(irow);
+            ret.rois.push_back(tbinmm.first + beg);
+            ret.rois.push_back(tbinmm.first + itick);
+            ret.samples.insert(ret.samples.end(), span.begin() + beg, span.begin() + itick);
+        }
+    }
+    return ret;
+}
+
 std::string Aux::taginfo(const WireCell::IFrame::pointer& frame)
 {
     if (! frame) {
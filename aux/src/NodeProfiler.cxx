@@ -0,0 +1,164 @@
+#include "WireCellAux/NodeProfiler.h"
+#include "WireCellAux/ColumnarDepoSet.h"
+
+#include "WireCellIface/IFrame.h"
+#include "WireCellIface/IDepo.h"
+#include "WireCellIface/IDepoSet.h"
+#include "WireCellIface/IBlobSet.h"
+#include "WireCellIface/ISlice.h"
+#include "WireCellIface/ISliceFrame.h"
+#include "WireCellIface/ICluster.h"
+#include "WireCellIface/ITensorSet.h"
+#include "WireCellUtil/Exceptions.h"
+
+#include <ctime>
+#include <fstream>
+
+using namespace WireCell;
+
+Aux::NodeProfiler::NodeProfiler()
+  : m_start(clock_t::now())
+{
+}
+
+size_t Aux::NodeProfiler::add_node(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_nodes.push_back(name);
+    return m_nodes.size() - 1;
+}
+
+Aux::NodeProfiler::Stamp Aux::NodeProfiler::stamp() const
+{
+    Stamp ret;
+    ret.wall = std::chrono::duration<double, std::micro>(clock_t::now() - m_start).count();
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0) {
+        ret.cpu = ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+    }
+    return ret;
+}
+
+void Aux::NodeProfiler::record(size_t node, const Stamp& begin, const Stamp& end,
+                               long in_depth, long out_depth, size_t payload)
+{
+    const auto tid = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_threads.find(tid);
+    if (it == m_threads.end()) {
+        it = m_threads.emplace(tid, m_threads.size()).first;
+    }
+    m_calls.push_back(Call{node, it->second, begin, end, in_depth, out_depth, payload});
+}
+
+std::vector<Aux::NodeProfiler::Call> Aux::NodeProfiler::calls() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_calls;
+}
+
+// Node names are generally safe but be sure.
+static std::string json_string(const std::string& str)
+{
+    std::string ret = "\"";
+    for (char c : str) {
+        if (c == '"' or c == '\\') {
+            ret += '\\';
+            ret += c;
+        }
+        else if ((unsigned char) c < 0x20) {
+            ret += ' ';
+        }
+        else {
+            ret += c;
+        }
+    }
+    ret += '"';
+    return ret;
+}
+
+void Aux::NodeProfiler::write(const std::string& filename) const
+{
+    std::ofstream out(filename);
+    if (!out) {
+        raise<IOError>("NodeProfiler: failed to open %s", filename);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Events are written as they are made instead of through
+    // Json::Value as there can be very many.
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"wire-cell\"}}";
+    for (size_t ind = 0; ind < m_threads.size(); ++ind) {
+        out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << ind
+            << ",\"args\":{\"name\":\"thread " << ind << "\"}}";
+    }
+
+    std::vector<std::string> names;
+    for (const auto& node : m_nodes) {
+        names.push_back(json_string(node));
+    }
+
+    out.precision(12);
+    for (const auto& call : m_calls) {
+        const auto& name = names[call.node];
+        out << ",\n{\"name\":" << name << ",\"cat\":\"node\",\"ph\":\"X\",\"pid\":1"
+            << ",\"tid\":" << call.thread << ",\"ts\":" << call.begin.wall
+            << ",\"dur\":" << call.end.wall - call.begin.wall << ",\"args\":{\"cpu_us\":" << call.end.cpu - call.begin.cpu
+            << ",\"payload\":" << call.payload;
+        if (call.in_depth >= 0) {
+            out << ",\"in_depth\":" << call.in_depth;
+        }
+        if (call.out_depth >= 0) {
+            out << ",\"out_depth\":" << call.out_depth;
+        }
+        out << "}}";
+        if (call.in_depth >= 0) {
+            out << ",\n{\"name\":" << name << ",\"cat\":\"queue\",\"ph\":\"C\",\"pid\":1"
+                << ",\"ts\":" << call.begin.wall << ",\"args\":{\"depth\":" << call.in_depth << "}}";
+        }
+    }
+    out << "\n]}\n";
+}
+
+size_t Aux::NodeProfiler::payload_size(const SharedAny& datum)
+{
+    if (!datum.pointer()) {
+        return 0;
+    }
+    if (datum.is<IFrame>()) {
+        auto traces = datum.as<IFrame::pointer>()->traces();
+        return traces ? traces->size() : 0;
+    }
+    if (datum.is<IDepoSet>()) {
+        auto ds = datum.as<IDepoSet::pointer>();
+        // Counting must not make the depos of a columnar set.
+        auto cds = std::dynamic_pointer_cast<const ColumnarDepoSet>(ds);
+        if (cds) {
+            return cds->columns().size();
+        }
+        auto depos = ds->depos();
+        return depos ? depos->size() : 0;
+    }
+    if (datum.is<IDepo>()) {
+        return 1;
+    }
+    if (datum.is<IBlobSet>()) {
+        return datum.as<IBlobSet::pointer>()->blobs().size();
+    }
+    if (datum.is<ISlice>()) {
+        return datum.as<ISlice::pointer>()->dense_activity().size();
+    }
+    if (datum.is<ISliceFrame>()) {
+        return datum.as<ISliceFrame::pointer>()->slices().size();
+    }
+    if (datum.is<ICluster>()) {
+        return boost::num_vertices(datum.as<ICluster::pointer>()->graph());
+    }
+    if (datum.is<ITensorSet>()) {
+        auto tensors = datum.as<ITensorSet::pointer>()->tensors();
+        return tensors ? tensors->size() : 0;
+    }
+    return 0;
+}
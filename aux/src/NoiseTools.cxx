@@ -2,6 +2,7 @@
 #include "WireCellUtil/Waveform.h"
 #include "WireCellUtil/Spectrum.h"
 #include "WireCellUtil/Interpolate.h"
+#include "WireCellUtil/Exceptions.h"
 
 #include <cmath>
 
@@ -163,6 +164,34 @@ Generator::~Generator()
 {
 }
 
+void Generator::half_spec(const real_vector_t& sigmas, complex_t* half)
+{
+    auto full = spec(sigmas);
+    std::copy(full.begin(), full.begin() + full.size()/2+1, half);
+}
+
+real_vector_t
+Generator::batch_waves(IDFT::pointer dft, const std::vector<const real_vector_t*>& sigmas)
+{
+    const size_t nrows = sigmas.size();
+    if (!nrows) {
+        return real_vector_t();
+    }
+    const size_t nsamples = sigmas[0]->size();
+    const size_t nhalf = nsamples/2+1;
+    complex_vector_t halfs(nrows*nhalf);
+    for (size_t irow=0; irow<nrows; ++irow) {
+        if (sigmas[irow]->size() != nsamples) {
+            raise<ValueError>("noise generator: sigma size %d, expected %d",
+                              sigmas[irow]->size(), nsamples);
+        }
+        half_spec(*sigmas[irow], halfs.data() + irow*nhalf);
+    }
+    real_vector_t ret(nrows*nsamples);
+    dft->inv1b_c2r(halfs.data(), ret.data(), nrows, nsamples, 1);
+    return ret;
+}
+
 //
 // GeneratorN
 //
@@ -175,30 +204,39 @@ GeneratorN::~GeneratorN()
 {
 }
 
-complex_vector_t
-GeneratorN::spec(const real_vector_t& sigmas)
+void
+GeneratorN::half_spec(const real_vector_t& sigmas, complex_t* half)
 {
     const size_t nsamples = sigmas.size();
     // nsamples: even->1, odd->0
     const size_t nextra = (nsamples+1)%2;
     const size_t nhalf = nsamples / 2;
-            
-    complex_vector_t spec(nsamples, 0);
 
     auto normals = normal(2*(nhalf+nextra)+1);
 
-    // The zero-frequency bin must be real and may be negative.
-    for (size_t ind=0; ind <= nhalf+nextra; ++ind) {
+    // The zero-frequency bin must be real and may be negative.  For
+    // even nsamples, the randoms also cover one bin past Nyquist
+    // which the Hermitian mirror would overwrite.
+    for (size_t ind=0; ind <= nhalf; ++ind) {
         float mode = sigmas.at(ind);
-        spec.at(ind) = std::complex(mode*normals.at(ind),
-                                    mode*normals.at(ind+nhalf));
+        half[ind] = std::complex(mode*normals.at(ind),
+                                 mode*normals.at(ind+nhalf));
     }
     // DC bin must be real
-    spec[0] = std::abs(spec[0]);
+    half[0] = std::abs(half[0]);
     if (nextra) {               // and same for Nyquist if we have one
-        spec[nhalf] = std::abs(spec[nhalf]);
+        half[nhalf] = std::abs(half[nhalf]);
     }        
+}
 
+complex_vector_t
+GeneratorN::spec(const real_vector_t& sigmas)
+{
+    complex_vector_t spec(sigmas.size(), 0);
+    if (spec.empty()) {
+        return spec;
+    }
+    half_spec(sigmas, spec.data());
     hermitian_mirror(spec.begin(), spec.end());
     return spec;
 }
@@ -209,6 +247,12 @@ GeneratorN::wave(const real_vector_t& sigmas)
     return inv_c2r(dft, spec(sigmas));
 }
 
+real_vector_t
+GeneratorN::waves(const std::vector<const real_vector_t*>& sigmas)
+{
+    return batch_waves(dft, sigmas);
+}
+
 
 //
 // GeneratorU
@@ -222,31 +266,41 @@ GeneratorU::~GeneratorU()
 {
 }
 
-complex_vector_t
-GeneratorU::spec(const real_vector_t& sigmas)
+void
+GeneratorU::half_spec(const real_vector_t& sigmas, complex_t* half)
 {
     const size_t nsamples = sigmas.size();
     // nsamples: even->1, odd->0
     const size_t nextra = (nsamples+1)%2;
     const size_t nhalf = nsamples / 2;
-            
-    complex_vector_t spec(nsamples, 0);
+
+    std::fill(half, half + nhalf+1, 0);
 
     auto uniforms = uniform(nsamples);
 
     // The zero-frequency bin must be real and may be negative.
-    spec.at(0).real(sigmas.at(0)*sqrt(-2*log(uniforms.at(0))));
+    half[0].real(sigmas.at(0)*sqrt(-2*log(uniforms.at(0))));
 
     for (size_t ind=1; ind < nhalf; ++ind) {
         float mode = sigmas.at(ind);
         float rad = mode*sqrt(-2*log(uniforms.at(ind)));
         float ang = 2 * 3.141592653589793 * uniforms.at(ind+nhalf);
-        spec.at(ind) = std::polar(rad, ang);
+        half[ind] = std::polar(rad, ang);
     }
     if (nextra) {       // have Nyquist bin
         // Must be real, can be negative.
-        spec.at(nhalf).real(sigmas.at(nhalf)*sqrt(-2*log(uniforms.at(nhalf))));
+        half[nhalf].real(sigmas.at(nhalf)*sqrt(-2*log(uniforms.at(nhalf))));
     }
+}
+
+complex_vector_t
+GeneratorU::spec(const real_vector_t& sigmas)
+{
+    complex_vector_t spec(sigmas.size(), 0);
+    if (spec.empty()) {
+        return spec;
+    }
+    half_spec(sigmas, spec.data());
     hermitian_mirror(spec.begin(), spec.end());
     return spec;
 }
@@ -256,3 +310,9 @@ GeneratorU::wave(const real_vector_t& sigmas)
 {
     return inv_c2r(dft, spec(sigmas));
 }
+
+real_vector_t
+GeneratorU::waves(const std::vector<const real_vector_t*>& sigmas)
+{
+    return batch_waves(dft, sigmas);
+}
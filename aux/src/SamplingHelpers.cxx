@@ -199,7 +199,7 @@ void Aux::add_ctpc(PointCloud::Tree::Points::node_t& root, const WireCell::IBlob
             // auto& slice = std::get<slice_t>(cgnode.ptr);
             ++nslices;
             const auto slice_index = slice->start()/tick;
-            const auto& activity = slice->activity();
+            const auto& activity = slice->dense_activity();
             for (const auto& [ichan, charge] : activity) {
                 if(charge.uncertainty() > dead_threshold) {
                     // if (charge.value() >0)
@@ -286,7 +286,7 @@ void Aux::add_dead_winds(PointCloud::Tree::Points::node_t& root, const IBlobSet:
         const auto& slice = ibs->slice();
         {
             // const auto& slice_index = slice->start()/tick;
-            const auto& activity = slice->activity();
+            const auto& activity = slice->dense_activity();
             for (const auto& [ichan, charge] : activity) {
                 if(charge.uncertainty() < dead_threshold) continue;
                 const auto& wires = ichan->wires();
@@ -6,3 +6,20 @@ Binning Aux::binning(const ISlice::vector& slices, double span)
 {
     return Aux::binning(slices.begin(), slices.end(), span);
 }
+
+ISlice::dense_t Aux::dense_activity(const ISlice::map_t& activity)
+{
+    ISlice::dense_t ret(activity.begin(), activity.end());
+    std::sort(ret.begin(), ret.end(), [](const auto& a, const auto& b) {
+        return a.first->ident() < b.first->ident();
+    });
+    return ret;
+}
+
+ISlice::map_t Aux::activity_map(const ISlice::dense_t& dense)
+{
+    ISlice::map_t ret;
+    ret.reserve(dense.size());
+    ret.insert(dense.begin(), dense.end());
+    return ret;
+}
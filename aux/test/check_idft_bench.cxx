@@ -61,6 +61,45 @@ void doit(Stopwatch& sw, const std::string& name, int nrows, int ncols, transfor
         });
 }
 
+// Real-valued transforms are out-of-place only.  Buffers are sized
+// for the full complex array so one function may time both a native
+// r2c/c2r and the complex path it replaces.
+using real_function = std::function<void(const float* rin, complex_t* cbuf, float* rout)>;
+
+void doit_real(Stopwatch& sw, const std::string& name, int nrows, int ncols, real_function func)
+{
+    const int size = nrows*ncols;
+    const int ntimes = std::max(1, nominal / size);
+    std::cerr << name << ": (" << nrows << "," << ncols << ") x "<<ntimes<<"\n";
+
+    std::vector<float> rin(size), rout(size);
+    std::vector<complex_t> cbuf(size);
+
+    sw([&](){func(rin.data(), cbuf.data(), rout.data());}, {
+            {"nrows",nrows}, {"ncols",ncols}, {"func",name}, {"ntimes",1}, {"first",true}, {"in-place",false},
+        });
+
+    sw([&](){
+        for (int count=0; count<ntimes+1; ++count) {
+            func(rin.data(), cbuf.data(), rout.data());
+        }}, {
+            {"nrows",nrows}, {"ncols",ncols}, {"func",name}, {"ntimes",ntimes}, {"first",false}, {"in-place",false},
+        });
+}
+
+// The r2c/c2r benchmark of the prior path: copy real to complex, do
+// the complex transform in-place and take the real part.
+void r2c_via_c2c(const float* rin, complex_t* cbuf, int size, std::function<void(complex_t*)> c2c)
+{
+    std::copy(rin, rin+size, cbuf);
+    c2c(cbuf);
+}
+void c2r_via_c2c(complex_t* cbuf, float* rout, int size, std::function<void(complex_t*)> c2c)
+{
+    c2c(cbuf);
+    std::transform(cbuf, cbuf+size, rout, [](const complex_t& c) { return std::real(c); });
+}
+
 
 int main(int argc, char* argv[])
 {
@@ -97,6 +136,19 @@ int main(int argc, char* argv[])
         doit(sw, "inv1d", 1, size, [&](const complex_t* in, complex_t* out) {
             idft->inv1d(in, out, size);
         });
+
+        doit_real(sw, "fwd1d_r2c", 1, size, [&](const float* rin, complex_t* cbuf, float* rout) {
+            idft->fwd1d_r2c(rin, cbuf, size);
+        });
+        doit_real(sw, "fwd1d_r2c_via_c2c", 1, size, [&](const float* rin, complex_t* cbuf, float* rout) {
+            r2c_via_c2c(rin, cbuf, size, [&](complex_t* c) { idft->fwd1d(c, c, size); });
+        });
+        doit_real(sw, "inv1d_c2r", 1, size, [&](const float* rin, complex_t* cbuf, float* rout) {
+            idft->inv1d_c2r(cbuf, rout, size);
+        });
+        doit_real(sw, "inv1d_c2r_via_c2c", 1, size, [&](const float* rin, complex_t* cbuf, float* rout) {
+            c2r_via_c2c(cbuf, rout, size, [&](complex_t* c) { idft->inv1d(c, c, size); });
+        });
     }
 
     // channel count from some detectors plus powers of 2
@@ -127,6 +179,34 @@ int main(int argc, char* argv[])
         doit(sw, "inv1b1", nrows, ncols, [&](const complex_t* in, complex_t* out) {
             idft->inv1b(in, out, nrows, ncols, 1);
         });
+
+        for (int axis : {0, 1}) {
+            const std::string sax = std::to_string(axis);
+            doit_real(sw, "fwd1b"+sax+"_r2c", nrows, ncols, [&](const float* rin, complex_t* cbuf, float* rout) {
+                idft->fwd1b_r2c(rin, cbuf, nrows, ncols, axis);
+            });
+            doit_real(sw, "fwd1b"+sax+"_r2c_via_c2c", nrows, ncols, [&](const float* rin, complex_t* cbuf, float* rout) {
+                r2c_via_c2c(rin, cbuf, nrows*ncols, [&](complex_t* c) { idft->fwd1b(c, c, nrows, ncols, axis); });
+            });
+            doit_real(sw, "inv1b"+sax+"_c2r", nrows, ncols, [&](const float* rin, complex_t* cbuf, float* rout) {
+                idft->inv1b_c2r(cbuf, rout, nrows, ncols, axis);
+            });
+            doit_real(sw, "inv1b"+sax+"_c2r_via_c2c", nrows, ncols, [&](const float* rin, complex_t* cbuf, float* rout) {
+                c2r_via_c2c(cbuf, rout, nrows*ncols, [&](complex_t* c) { idft->inv1b(c, c, nrows, ncols, axis); });
+            });
+        }
+        doit_real(sw, "fwd2d_r2c", nrows, ncols, [&](const float* rin, complex_t* cbuf, float* rout) {
+            idft->fwd2d_r2c(rin, cbuf, nrows, ncols);
+        });
+        doit_real(sw, "fwd2d_r2c_via_c2c", nrows, ncols, [&](const float* rin, complex_t* cbuf, float* rout) {
+            r2c_via_c2c(rin, cbuf, nrows*ncols, [&](complex_t* c) { idft->fwd2d(c, c, nrows, ncols); });
+        });
+        doit_real(sw, "inv2d_c2r", nrows, ncols, [&](const float* rin, complex_t* cbuf, float* rout) {
+            idft->inv2d_c2r(cbuf, rout, nrows, ncols);
+        });
+        doit_real(sw, "inv2d_c2r_via_c2c", nrows, ncols, [&](const float* rin, complex_t* cbuf, float* rout) {
+            c2r_via_c2c(cbuf, rout, nrows*ncols, [&](complex_t* c) { idft->inv2d(c, c, nrows, ncols); });
+        });
     }
     
     sw.save(fname);
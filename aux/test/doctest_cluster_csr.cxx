@@ -0,0 +1,83 @@
+#include "WireCellAux/SimpleCluster.h"
+#include "WireCellAux/SimpleChannel.h"
+#include "WireCellAux/SimpleMeasure.h"
+#include "WireCellAux/SimpleSlice.h"
+#include "WireCellUtil/doctest.h"
+
+#include <memory>
+
+using namespace WireCell;
+
+// Interleave node types so the CSR must regroup them.
+static cluster_graph_t make_graph()
+{
+    cluster_graph_t g;
+    auto m0 = boost::add_vertex(IMeasure::pointer(std::make_shared<Aux::SimpleMeasure>(0)), g);
+    auto c0 = boost::add_vertex(IChannel::pointer(std::make_shared<Aux::SimpleChannel>(10, 0)), g);
+    auto s0 = boost::add_vertex(ISlice::pointer(std::make_shared<Aux::SimpleSlice>(nullptr, 0, 0, 1)), g);
+    auto c1 = boost::add_vertex(IChannel::pointer(std::make_shared<Aux::SimpleChannel>(11, 1)), g);
+    auto m1 = boost::add_vertex(IMeasure::pointer(std::make_shared<Aux::SimpleMeasure>(1)), g);
+    boost::add_edge(m0, c0, g);
+    boost::add_edge(m1, c1, g);
+    boost::add_edge(m0, s0, g);
+    boost::add_edge(m1, s0, g);
+    boost::add_edge(c0, c1, g);
+    return g;
+}
+
+TEST_CASE("aux cluster csr ranges and neighbors")
+{
+    const auto g = make_graph();
+    cluster_csr_t csr(g);
+    REQUIRE(csr.num_vertices() == boost::num_vertices(g));
+    REQUIRE(csr.num_edges() == boost::num_edges(g));
+
+    CHECK(csr.range('c') == std::make_pair(0u, 2u));
+    CHECK(csr.range('w').first == csr.range('w').second);
+    CHECK(csr.range('s') == std::make_pair(2u, 3u));
+    CHECK(csr.range('m') == std::make_pair(3u, 5u));
+    CHECK(csr.range('x').first == csr.range('x').second);
+
+    for (cluster_csr_t::index_t vtx = 0; vtx < csr.num_vertices(); ++vtx) {
+        const auto desc = csr.descriptor(vtx);
+        CHECK(csr.index(desc) == vtx);
+        CHECK(csr.code(vtx) == g[desc].code());
+        CHECK(csr.node(vtx) == g[desc]);
+        CHECK(csr.neighbors(vtx).size() == boost::out_degree(desc, g));
+    }
+
+    // The slice connects to both measures and nothing else.
+    const auto sidx = csr.range('s').first;
+    CHECK(csr.neighbors(sidx, 'm').size() == 2);
+    CHECK(csr.neighbors(sidx, 'c').empty());
+    for (auto midx : csr.neighbors(sidx, 'm')) {
+        CHECK(csr.code(midx) == 'm');
+        CHECK(csr.neighbors(midx, 'c').size() == 1);
+    }
+    CHECK(csr.channel(0)->ident() == 10);
+    CHECK(csr.slice(sidx)->ident() == 0);
+}
+
+TEST_CASE("aux cluster csr round trip")
+{
+    const auto g = make_graph();
+    cluster_csr_t csr(g);
+    const auto g2 = csr.graph();
+    REQUIRE(boost::num_vertices(g2) == boost::num_vertices(g));
+    REQUIRE(boost::num_edges(g2) == boost::num_edges(g));
+    for (auto edge : boost::make_iterator_range(boost::edges(g))) {
+        const auto tail = csr.index(boost::source(edge, g));
+        const auto head = csr.index(boost::target(edge, g));
+        CHECK(g2[tail] == g[boost::source(edge, g)]);
+        CHECK(boost::edge(tail, head, g2).second);
+    }
+}
+
+TEST_CASE("aux simple cluster csr")
+{
+    Aux::SimpleCluster cluster(make_graph(), 7);
+    const ICluster& icluster = cluster;
+    const auto& csr = icluster.csr();
+    CHECK(&csr == &icluster.csr());
+    CHECK(csr.num_vertices() == boost::num_vertices(icluster.graph()));
+}
@@ -0,0 +1,41 @@
+#include "WireCellAux/FrameTools.h"
+#include "WireCellAux/SimpleTrace.h"
+
+#include "WireCellUtil/doctest.h"
+
+#include <vector>
+
+using namespace WireCell;
+
+TEST_CASE("aux frame rois")
+{
+    ITrace::vector traces;
+    traces.push_back(std::make_shared<Aux::SimpleTrace>(5, 10, ITrace::ChargeSequence{0, 0, 1, 2, 0, 0, 3, 0}));
+    traces.push_back(std::make_shared<Aux::SimpleTrace>(3, 12, ITrace::ChargeSequence{0, 0, 0}));
+    // overlaps the trace on channel 5
+    traces.push_back(std::make_shared<Aux::SimpleTrace>(5, 16, ITrace::ChargeSequence{4, 5}));
+    traces.push_back(std::make_shared<Aux::SimpleTrace>(7, 0, ITrace::ChargeSequence{1}));
+    // not in the channel list
+    traces.push_back(std::make_shared<Aux::SimpleTrace>(9, 0, ITrace::ChargeSequence{1}));
+
+    Aux::channel_list channels{3, 5, 7};
+    auto rl = Aux::rois(traces, channels.begin(), channels.end());
+
+    REQUIRE(rl.size() == 3);
+    CHECK(rl.rois == std::vector<int>{1, 12, 14, 1, 16, 18, 2, 0, 1});
+    CHECK(rl.samples == std::vector<float>{1, 2, 7, 5, 1});
+
+    // The dense fill agrees over the runs and is zero elsewhere.
+    Array::array_xxf arr = Array::array_xxf::Zero(channels.size(), 20);
+    Aux::fill(arr, traces, channels.begin(), channels.end(), 0);
+    size_t isample = 0;
+    for (size_t iroi = 0; iroi < rl.size(); ++iroi) {
+        const int row = rl.rois[3 * iroi];
+        for (int tbin = rl.rois[3 * iroi + 1]; tbin < rl.rois[3 * iroi + 2]; ++tbin) {
+            CHECK(arr(row, tbin) == rl.samples[isample]);
+            arr(row, tbin) = 0;
+            ++isample;
+        }
+    }
+    CHECK(arr.abs().sum() == 0);
+}
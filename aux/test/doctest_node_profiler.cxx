@@ -0,0 +1,95 @@
+#include "WireCellAux/NodeProfiler.h"
+#include "WireCellAux/ColumnarDepoSet.h"
+#include "WireCellAux/SimpleFrame.h"
+#include "WireCellAux/SimpleTrace.h"
+#include "WireCellUtil/doctest.h"
+
+#include <json/json.h>
+
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace WireCell;
+
+TEST_CASE("aux node profiler payload")
+{
+    CHECK(Aux::NodeProfiler::payload_size(SharedAny()) == 0);
+    CHECK(Aux::NodeProfiler::payload_size(IFrame::pointer()) == 0);
+    CHECK(Aux::NodeProfiler::payload_size(std::make_shared<int>(42)) == 0);
+
+    ITrace::vector traces;
+    for (int ch = 0; ch < 3; ++ch) {
+        traces.push_back(std::make_shared<Aux::SimpleTrace>(ch, 0, 10));
+    }
+    IFrame::pointer frame = std::make_shared<Aux::SimpleFrame>(0, 0, traces);
+    CHECK(Aux::NodeProfiler::payload_size(frame) == 3);
+
+    // Counted from the columns without making depos.
+    Aux::ColumnarDepoSet::Columns columns;
+    columns.resize(5);
+    IDepoSet::pointer ds = std::make_shared<Aux::ColumnarDepoSet>(0, columns);
+    CHECK(Aux::NodeProfiler::payload_size(ds) == 5);
+}
+
+TEST_CASE("aux node profiler record and write")
+{
+    Aux::NodeProfiler prof;
+    const size_t src = prof.add_node("src");
+    const size_t dst = prof.add_node("dst \"quoted\"");
+    REQUIRE(prof.nodes().size() == 2);
+
+    const size_t nthreads = 4, ncalls = 100;
+    std::vector<std::thread> threads;
+    for (size_t ith = 0; ith < nthreads; ++ith) {
+        threads.emplace_back([&]() {
+            for (size_t ind = 0; ind < ncalls; ++ind) {
+                auto beg = prof.stamp();
+                auto end = prof.stamp();
+                prof.record(src, beg, end);
+                prof.record(dst, beg, end, ind, 0, 1);
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    auto calls = prof.calls();
+    REQUIRE(calls.size() == 2 * nthreads * ncalls);
+    for (const auto& call : calls) {
+        REQUIRE(call.thread < nthreads);
+        REQUIRE(call.end.wall >= call.begin.wall);
+        REQUIRE(call.end.cpu >= call.begin.cpu);
+    }
+
+    const std::string fname = "doctest_node_profiler.json";
+    prof.write(fname);
+
+    Json::Value top;
+    {
+        std::ifstream fin(fname);
+        Json::CharReaderBuilder rb;
+        std::string errs;
+        REQUIRE(Json::parseFromStream(rb, fin, &top, &errs));
+    }
+    std::remove(fname.c_str());
+
+    size_t ncomplete = 0, ncounter = 0, nmeta = 0;
+    for (const auto& ev : top["traceEvents"]) {
+        const std::string ph = ev["ph"].asString();
+        if (ph == "X") {
+            ++ncomplete;
+        }
+        else if (ph == "C") {
+            ++ncounter;
+            REQUIRE(ev["name"].asString() == "dst \"quoted\"");
+        }
+        else if (ph == "M") {
+            ++nmeta;
+        }
+    }
+    CHECK(ncomplete == 2 * nthreads * ncalls);
+    CHECK(ncounter == nthreads * ncalls);  // only dst has known depth
+    CHECK(nmeta == 1 + nthreads);
+}
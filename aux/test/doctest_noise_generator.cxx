@@ -0,0 +1,59 @@
+#include "WireCellAux/NoiseTools.h"
+#include "WireCellAux/FftwDFT.h"
+#include "WireCellUtil/doctest.h"
+
+#include <cmath>
+
+using namespace WireCell;
+using namespace WireCell::Aux::NoiseTools;
+
+// A deterministic stand-in for a random source so that two
+// generators may be compared.
+static std::function<real_vector_t(size_t)> make_counter(float offset)
+{
+    auto count = std::make_shared<size_t>(0);
+    return [=](size_t n) {
+        real_vector_t ret(n);
+        for (auto& r : ret) {
+            r = offset + 0.5f * std::sin(0.7 * (*count)++);
+        }
+        return ret;
+    };
+}
+
+static void check_batch(Generator& one, Generator& batch, size_t nsamples, size_t nwaves)
+{
+    std::vector<real_vector_t> sigmas(nwaves, real_vector_t(nsamples));
+    std::vector<const real_vector_t*> psigmas;
+    for (size_t iwave = 0; iwave < nwaves; ++iwave) {
+        for (size_t ind = 0; ind < nsamples; ++ind) {
+            sigmas[iwave][ind] = 1.0 + iwave + 0.1 * ind;
+        }
+        psigmas.push_back(&sigmas[iwave]);
+    }
+
+    auto waves = batch.waves(psigmas);
+    REQUIRE(waves.size() == nwaves * nsamples);
+    for (size_t iwave = 0; iwave < nwaves; ++iwave) {
+        auto wave = one.wave(sigmas[iwave]);
+        REQUIRE(wave.size() == nsamples);
+        for (size_t ind = 0; ind < nsamples; ++ind) {
+            CHECK(waves[iwave * nsamples + ind] == doctest::Approx(wave[ind]).epsilon(1e-4));
+        }
+    }
+}
+
+TEST_CASE("aux noise generator batch")
+{
+    auto dft = std::make_shared<Aux::FftwDFT>();
+    for (size_t nsamples : {7, 8, 100}) {
+        GeneratorN one(dft, make_counter(0)), batch(dft, make_counter(0));
+        check_batch(one, batch, nsamples, 5);
+    }
+    for (size_t nsamples : {7, 8, 100}) {
+        GeneratorU one(dft, make_counter(0.5)), batch(dft, make_counter(0.5));
+        check_batch(one, batch, nsamples, 5);
+    }
+    GeneratorN gen(dft, make_counter(0));
+    CHECK(gen.waves({}).empty());
+}
@@ -0,0 +1,60 @@
+#include "WireCellAux/SimpleSlice.h"
+#include "WireCellAux/SimpleChannel.h"
+#include "WireCellAux/SliceTools.h"
+#include "WireCellUtil/doctest.h"
+
+#include <memory>
+
+using namespace WireCell;
+
+static ISlice::map_t make_activity()
+{
+    ISlice::map_t activity;
+    for (int ch : {7, 3, 11, 5}) {
+        auto ich = std::make_shared<Aux::SimpleChannel>(ch, ch);
+        activity[ich] = ISlice::value_t(ch, 0.5 * ch);
+    }
+    return activity;
+}
+
+TEST_CASE("aux slice dense activity is sorted")
+{
+    auto activity = make_activity();
+    auto dense = Aux::dense_activity(activity);
+    REQUIRE(dense.size() == activity.size());
+    for (size_t ind = 1; ind < dense.size(); ++ind) {
+        CHECK(dense[ind - 1].first->ident() < dense[ind].first->ident());
+    }
+    auto back = Aux::activity_map(dense);
+    CHECK(back.size() == activity.size());
+    for (const auto& [ich, val] : activity) {
+        CHECK(back.at(ich).value() == val.value());
+    }
+}
+
+TEST_CASE("aux simple slice dense activity")
+{
+    ISlice::pointer islice = std::make_shared<Aux::SimpleSlice>(nullptr, 0, 0, 1, make_activity());
+    const auto& dense = islice->dense_activity();
+    CHECK(dense.size() == 4);
+    CHECK(dense.front().first->ident() == 3);
+    CHECK(dense.back().first->ident() == 11);
+    // Repeated access returns the same storage.
+    CHECK(&islice->dense_activity() == &dense);
+    CHECK(islice->activity().size() == 4);
+
+    // Fill via the mutable accessor prior to first read.
+    auto sslice = std::make_shared<Aux::SimpleSlice>(nullptr, 1, 0, 1);
+    auto ich = std::make_shared<Aux::SimpleChannel>(42, 0);
+    sslice->activity()[ich] = ISlice::value_t(1.0, 1.0);
+    ISlice::pointer filled = sslice;
+    REQUIRE(filled->dense_activity().size() == 1);
+    CHECK(filled->dense_activity()[0].first->ident() == 42);
+
+    // Fill after a read restores the prior activity.
+    auto ich2 = std::make_shared<Aux::SimpleChannel>(41, 1);
+    sslice->activity()[ich2] = ISlice::value_t(2.0, 1.0);
+    REQUIRE(filled->dense_activity().size() == 2);
+    CHECK(filled->dense_activity()[0].first->ident() == 41);
+    CHECK(filled->dense_activity()[1].first->ident() == 42);
+}
@@ -19,6 +19,7 @@ struct FakeSlice : public ISlice {
     virtual double start() const { THROW (RuntimeError()); }
     virtual double span() const { THROW (RuntimeError()); }
     virtual map_t activity() const { THROW (RuntimeError()); }
+    virtual const dense_t& dense_activity() const { THROW (RuntimeError()); }
 };
 
 struct FakeBlob : public IBlob {
@@ -130,6 +130,95 @@ void test_1b_impulse(IDFT::pointer dft, int axis, int nrows=128, int ncols=128)
     assert_impulse_at_index(inback, 0);
 }
 
+// A real test signal with no special symmetry and values in [-1,1].
+static std::vector<IDFT::scalar_t> real_signal(int size)
+{
+    std::vector<IDFT::scalar_t> ret(size);
+    for (int ind=0; ind<size; ++ind) {
+        ret[ind] = std::sin(0.1*ind*ind);
+    }
+    return ret;
+}
+
+// Compare up to float round-off relative to the scale of the values.
+static void assert_close(IDFT::complex_t a, IDFT::complex_t b, float scale=1.0)
+{
+    assert_small(std::abs(a-b)/scale, 1e-5);
+}
+
+// The r2c half spectrum must match the first half of c2c and c2r must
+// bring it back.
+static
+void test_1d_r2c(IDFT::pointer dft, int size)
+{
+    std::cerr << "1d r2c size="<<size<<"\n";
+    auto wave = real_signal(size);
+    std::vector<IDFT::complex_t> cwave(wave.begin(), wave.end()), cspec(size);
+    dft->fwd1d(cwave.data(), cspec.data(), size);
+
+    const int nhalf = size/2+1;
+    std::vector<IDFT::complex_t> half(nhalf);
+    dft->fwd1d_r2c(wave.data(), half.data(), size);
+    for (int ind=0; ind<nhalf; ++ind) {
+        assert_close(half[ind], cspec[ind], size);
+    }
+
+    std::vector<IDFT::scalar_t> back(size);
+    dft->inv1d_c2r(half.data(), back.data(), size);
+    for (int ind=0; ind<size; ++ind) {
+        assert_close(back[ind], wave[ind]);
+    }
+}
+
+static
+void test_1b_r2c(IDFT::pointer dft, int axis, int nrows, int ncols)
+{
+    std::cerr << "1b r2c axis="<<axis << " nrows="<<nrows<<" ncols="<<ncols<<"\n";
+    const int size = nrows*ncols;
+    auto wave = real_signal(size);
+    std::vector<IDFT::complex_t> cwave(wave.begin(), wave.end()), cspec(size);
+    dft->fwd1b(cwave.data(), cspec.data(), nrows, ncols, axis);
+
+    const int hrows = axis ? nrows : nrows/2+1;
+    const int hcols = axis ? ncols/2+1 : ncols;
+    std::vector<IDFT::complex_t> half(hrows*hcols);
+    dft->fwd1b_r2c(wave.data(), half.data(), nrows, ncols, axis);
+    for (int irow=0; irow<hrows; ++irow) {
+        for (int icol=0; icol<hcols; ++icol) {
+            assert_close(half[irow*hcols+icol], cspec[irow*ncols+icol], size);
+        }
+    }
+
+    std::vector<IDFT::scalar_t> back(size);
+    dft->inv1b_c2r(half.data(), back.data(), nrows, ncols, axis);
+    for (int ind=0; ind<size; ++ind) {
+        assert_close(back[ind], wave[ind]);
+    }
+}
+
+static
+void test_2d_r2c(IDFT::pointer dft, int nrows, int ncols)
+{
+    std::cerr << "2d r2c nrows="<<nrows<<" ncols="<<ncols<<"\n";
+    const int size = nrows*ncols;
+    const int hcols = ncols/2+1;
+
+    // impulse gives flat half spectrum
+    std::vector<IDFT::scalar_t> imp(size, 0);
+    imp[0] = 1.0;
+    std::vector<IDFT::complex_t> half(nrows*hcols);
+    dft->fwd2d_r2c(imp.data(), half.data(), nrows, ncols);
+    assert_flat_value(half);
+
+    auto wave = real_signal(size);
+    dft->fwd2d_r2c(wave.data(), half.data(), nrows, ncols);
+    std::vector<IDFT::scalar_t> back(size);
+    dft->inv2d_c2r(half.data(), back.data(), nrows, ncols);
+    for (int ind=0; ind<size; ++ind) {
+        assert_close(back[ind], wave[ind]);
+    }
+}
+
 void fwdrev(IDFT::pointer dft, int id, int ntimes, int size)
 {
     int stride=size, nstrides=size;
@@ -219,6 +308,19 @@ int main(int argc, char* argv[])
     test_1b_impulse(idft, 0, 8, 2);
     test_1b_impulse(idft, 1, 8, 2);
 
+    for (int size : {1, 2, 7, 8, 1000, 1024}) {
+        test_1d_r2c(idft, size);
+    }
+    for (int axis : {0, 1}) {
+        test_1b_r2c(idft, axis, 2, 8);
+        test_1b_r2c(idft, axis, 8, 2);
+        test_1b_r2c(idft, axis, 7, 10);
+        test_1b_r2c(idft, axis, 10, 7);
+    }
+    test_2d_r2c(idft, 8, 8);
+    test_2d_r2c(idft, 7, 10);
+    test_2d_r2c(idft, 10, 7);
+
     test_2d_transpose<IDFT::scalar_t>(idft, 2, 8);
     test_2d_transpose<IDFT::scalar_t>(idft, 8, 2);
     test_2d_transpose<IDFT::complex_t>(idft, 2, 8);
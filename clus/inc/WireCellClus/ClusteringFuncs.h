@@ -189,10 +189,13 @@ namespace WireCell::PointCloud::Facade {
 
     // clustering_regular.cxx
     // third function 
+    //
+    // If nthreads is nonzero, pairs are judged on up to that many threads.
     void clustering_regular(Grouping& live_clusters,
                             cluster_set_t& cluster_connected_dead,            // in/out
                             const double length_cut = 45*units::cm,                                       //
-                            bool flag_enable_extend = true                                       //
+                            bool flag_enable_extend = true,                                       //
+                            const int nthreads = 0
     );
     class ClusteringRegular {
        public:
@@ -201,16 +204,18 @@ namespace WireCell::PointCloud::Facade {
             // FIXME: throw if not found?
             length_cut_ = get(config, "length_cut", 45*units::cm);
             flag_enable_extend_ = get(config, "flag_enable_extend", true);
+            nthreads_ = get(config, "nthreads", 0);
         }
 
         void operator()(Grouping& live_clusters, Grouping& dead_clusters, cluster_set_t& cluster_connected_dead) const
         {
-            clustering_regular(live_clusters, cluster_connected_dead, length_cut_, flag_enable_extend_);
+            clustering_regular(live_clusters, cluster_connected_dead, length_cut_, flag_enable_extend_, nthreads_);
         }
 
        private:
         double length_cut_{45*units::cm};
         bool flag_enable_extend_{true};
+        int nthreads_{0};
     };
 
     bool Clustering_1st_round(const Cluster& cluster1,
@@ -221,9 +226,12 @@ namespace WireCell::PointCloud::Facade {
 			      bool flag_enable_extend = true);
 
     // clustering_parallel_prolong.cxx:
+    //
+    // If nthreads is nonzero, pairs are judged on up to that many threads.
     void clustering_parallel_prolong(Grouping& live_clusters,
                                      cluster_set_t& cluster_connected_dead, // in/out
-                                     const double length_cut = 35*units::cm
+                                     const double length_cut = 35*units::cm,
+                                     const int nthreads = 0
     );
     class ClusteringParallelProlong {
        public:
@@ -231,15 +239,17 @@ namespace WireCell::PointCloud::Facade {
         {
             // FIXME: throw if not found?
             length_cut_ = get(config, "length_cut", 35*units::cm);
+            nthreads_ = get(config, "nthreads", 0);
         }
 
         void operator()(Grouping& live_clusters, Grouping& dead_clusters, cluster_set_t& cluster_connected_dead) const
         {
-            clustering_parallel_prolong(live_clusters, cluster_connected_dead, length_cut_);
+            clustering_parallel_prolong(live_clusters, cluster_connected_dead, length_cut_, nthreads_);
         }
 
        private:
         double length_cut_{35*units::cm};
+        int nthreads_{0};
     };
 
     bool Clustering_2nd_round(const Cluster& cluster1,
@@ -281,23 +291,29 @@ namespace WireCell::PointCloud::Facade {
     //                          std::map<int, std::pair<double, double>>& dead_v_index,
     //                          std::map<int, std::pair<double, double>>& dead_w_index);
 
+    //
+    // If nthreads is nonzero, clusters are judged for separation on up to
+    // that many threads.  Separation itself is serial.
     void clustering_separate(Grouping& live_grouping,
-                             const bool use_ctpc);
+                             const bool use_ctpc,
+                             const int nthreads = 0);
     class ClusteringSeparate {
        public:
         ClusteringSeparate(const WireCell::Configuration& config)
         {
             // FIXME: throw if not found?
             use_ctpc_ = get(config, "use_ctpc", true);
+            nthreads_ = get(config, "nthreads", 0);
         }
 
         void operator()(Grouping& live_clusters, Grouping& dead_clusters, cluster_set_t& cluster_connected_dead) const
         {
-            clustering_separate(live_clusters, use_ctpc_);
+            clustering_separate(live_clusters, use_ctpc_, nthreads_);
         }
 
        private:
         double use_ctpc_{true};
+        int nthreads_{0};
     };
 
     void clustering_connect1(Grouping& live_grouping);
@@ -372,19 +388,23 @@ namespace WireCell::PointCloud::Facade {
     };
 
 
-    void clustering_examine_x_boundary(Grouping& live_grouping);
+    // If nthreads is nonzero, clusters are examined on up to that many
+    // threads.  Separation itself is serial.
+    void clustering_examine_x_boundary(Grouping& live_grouping, const int nthreads = 0);
     class ClusteringExamineXBoundary {
        public:
         ClusteringExamineXBoundary(const WireCell::Configuration& config)
         {
+            nthreads_ = get(config, "nthreads", 0);
         }
 
         void operator()(Grouping& live_clusters, Grouping& dead_clusters, cluster_set_t& cluster_connected_dead) const
         {
-            clustering_examine_x_boundary(live_clusters);
+            clustering_examine_x_boundary(live_clusters, nthreads_);
         }
 
        private:
+        int nthreads_{0};
     };
 
     void clustering_protect_overclustering(Grouping& live_grouping);
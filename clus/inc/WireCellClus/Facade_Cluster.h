@@ -17,6 +17,8 @@
 #include "WireCellClus/Facade_Util.h"
 #include "WireCellClus/Facade_Blob.h"
 
+#include <mutex>
+
 
 // using namespace WireCell;  NO!  do not open up namespaces in header files!
 
@@ -375,6 +377,12 @@ namespace WireCell::PointCloud::Facade {
         Flash get_flash() const;
 
        private:
+        // Guards filling the lazy values below and the scoped views so that
+        // const methods may be called on one cluster from several threads.
+        // The graph and shortest path state are not guarded as they depend
+        // on the order of calls.
+        mutable std::recursive_mutex m_lazy_mutex;
+
         mutable time_blob_map_t m_time_blob_map;  // lazy, do not access directly.
         mutable std::map<const Blob*, std::vector<int>> m_map_mcell_indices; // lazy, do not access directly.
 
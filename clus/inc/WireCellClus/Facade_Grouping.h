@@ -8,6 +8,7 @@
 #include "WireCellUtil/PointCloudDataset.h"
 #include "WireCellUtil/PointTree.h"
 #include "WireCellUtil/Point.h"
+#include "WireCellUtil/BoundingBox.h"
 #include "WireCellUtil/Units.h"
 #include "WireCellUtil/Spdlog.h"
 #include "WireCellUtil/Graph.h"
@@ -16,6 +17,8 @@
 
 #include "WireCellClus/Facade_Util.h"
 
+#include <mutex>
+
 
 // using namespace WireCell;  NO!  do not open up namespaces in header files!
 
@@ -31,6 +34,36 @@ namespace WireCell::PointCloud::Facade {
 
     };
 
+    // A broad-phase spatial index over the axis-aligned bounding boxes of the
+    // 3D points of a set of clusters.  The distance between two boxes (or a box
+    // and a point) is never more than that between any points they contain.
+    // A pairwise judgment which requires points closer than some cut thus
+    // need only be made on the candidates returned here.  Indices are into
+    // the vector of clusters given on construction.
+    class ClusterBoxes {
+       public:
+        explicit ClusterBoxes(const std::vector<Cluster*>& clusters);
+
+        size_t size() const { return m_boxes.size(); }
+        const BoundingBox& box(size_t index) const { return m_boxes[index]; }
+
+        // The smallest distance between two boxes or a box and a point, zero
+        // if overlapping.  A cluster without points is near everything.
+        double distance(size_t one, size_t two) const;
+        double distance(size_t index, const geo_point_t& point) const;
+
+        // Return, for each cluster, the ascending indices of the other
+        // clusters with boxes no farther than the distance.
+        std::vector<std::vector<size_t>> neighbors(double distance) const;
+
+        // Return the ascending indices of the clusters with boxes no farther
+        // than the distance from the point.
+        std::vector<size_t> near(const geo_point_t& point, double distance) const;
+
+       private:
+        std::vector<BoundingBox> m_boxes;
+    };
+
     // Give a node "Grouping" semantics.  A grouping node's children are cluster
     // nodes that are related in some way.
     class Grouping : public NaryTree::FacadeParent<Cluster, points_t>, public Mixin<Grouping, GroupingCache> {
@@ -55,6 +88,10 @@ namespace WireCell::PointCloud::Facade {
         // Return a value representing the content of this grouping.
         size_t hash() const;
 
+        // Return a broad-phase index over the current child clusters.  It
+        // is not updated as clusters change.
+        ClusterBoxes cluster_boxes() const;
+
         const mapfp_t< std::map<int, std::pair<double, double>> >& all_dead_winds() const {
             // this is added in order that we may dump it in json_summary() for debugging.
             return m_dead_winds;
@@ -63,6 +100,7 @@ namespace WireCell::PointCloud::Facade {
         std::map<int, std::pair<double, double>>& get_dead_winds(const int face, const int pind) const
         {
             // make one if not exist
+            std::lock_guard<std::mutex> lock(m_lazy_mutex);
             return m_dead_winds[face][pind];
 
             // This is utter garbage.  #381.
@@ -145,6 +183,10 @@ namespace WireCell::PointCloud::Facade {
         // This "cache" is utterly abused.  Someone else fix it.  #381.
         mutable mapfp_t< std::map<int, std::pair<double, double>> > m_dead_winds;
 
+        // Guards creating dead winds entries and filling the scoped views
+        // so that clusters in different threads may query this grouping.
+        mutable std::mutex m_lazy_mutex;
+
        protected:
         // Receive notification when this facade is created on a node. #381.
         virtual void on_construct(node_type* node);
@@ -18,6 +18,9 @@
 
 #include "WCPQuickhull/QuickHull.h"
 
+#include <atomic>
+#include <mutex>
+
 // extern int global_counter_get_closest_wcpoint;
 
 
@@ -36,11 +39,16 @@ namespace WireCell::PointCloud::Facade {
     /// caching mechanism.  See comments on cache() and fill_cache() and
     /// clear_cache().  Note, using the cache mechanism does not preclude facade
     /// doing DIY caching.
+    ///
+    /// The cache may be filled from several threads at once.  Clearing it
+    /// must not be concurrent with any access.
     template<typename SelfType, typename CacheType=DummyCache>
     class Mixin {
         SelfType& self;
         std::string scalar_pc_name, ident_array_name;
         mutable std::unique_ptr<CacheType> m_cache;
+        mutable std::atomic<bool> m_cache_filled{false};
+        mutable std::mutex m_cache_mutex;
     public:
         Mixin(SelfType& self, const std::string& scalar_pc_name, const std::string& ident_array_name = "ident")
             : self(self)
@@ -55,9 +63,14 @@ namespace WireCell::PointCloud::Facade {
         /// Cache rule 1: The SelfType may call this to access a full and const cache.
         const CacheType& cache() const
         {
-            if (! m_cache) {
-                m_cache = std::make_unique<CacheType>();
-                fill_cache(* const_cast<CacheType*>(m_cache.get()));
+            if (! m_cache_filled.load(std::memory_order_acquire)) {
+                std::lock_guard<std::mutex> lock(m_cache_mutex);
+                if (! m_cache) {
+                    auto cache = std::make_unique<CacheType>();
+                    fill_cache(*cache);
+                    m_cache = std::move(cache);
+                }
+                m_cache_filled.store(true, std::memory_order_release);
             }
             return *m_cache.get();
         }
@@ -79,6 +92,8 @@ namespace WireCell::PointCloud::Facade {
         /// clear_cache() called in response to a tree notification.
         virtual void clear_cache() const
         {
+            std::lock_guard<std::mutex> lock(m_cache_mutex);
+            m_cache_filled.store(false, std::memory_order_release);
             m_cache = nullptr;
         }
 
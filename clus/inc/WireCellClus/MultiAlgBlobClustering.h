@@ -91,6 +91,17 @@ namespace WireCell::Clus {
          */
         bool m_dump_json{false};
 
+        /** Config: "nthreads"
+         *
+         * If zero (default), clustering functions run serially.
+         * Otherwise it is given as "nthreads" to each entry of
+         * "func_cfgs" that does not set its own.  Functions that
+         * support it then spread their per-cluster work over this many
+         * threads.  The functions themselves still run in order and
+         * the result does not depend on the number of threads.
+         */
+        int m_nthreads{0};
+
         // configurable parameters for dead-live clustering
         int m_dead_live_overlap_offset{2};
 
@@ -57,6 +57,7 @@ const Grouping* Cluster::grouping() const { return this->m_node->parent->value.t
 
 
 void Cluster::clear_cache() const {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
 
     // For now, this facade does its own cache management but we forward-call
     // the Mixin just to be proper.  Since our ClusterCache is the null-struct,
@@ -153,6 +154,7 @@ std::string Cluster::dump_graph() const{
 
 const Cluster::time_blob_map_t& Cluster::time_blob_map() const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     if (m_time_blob_map.empty()) {
         for (const Blob* blob : children()) {
             m_time_blob_map[blob->slice_index_min()].insert(blob);
@@ -510,9 +512,15 @@ bool Cluster::construct_skeleton(const bool use_ctpc)
     return true;
 }
 
+// The scoped views fill their selections, k-d tree points and k-d tree
+// index lazily.  All are forced while locked so later queries on the
+// view only read.
 const Cluster::sv2d_t& Cluster::sv2d(const size_t plane) const {
-    return m_node->value.scoped_view(scope2ds[plane]);
-    }
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
+    const auto& sv = m_node->value.scoped_view(scope2ds[plane]);
+    sv.kd().prepare();
+    return sv;
+}
 
 const Cluster::kd2d_t& Cluster::kd2d(const size_t plane) const
 {
@@ -617,16 +625,22 @@ std::pair<geo_point_t, double> Cluster::get_closest_point_along_vec(geo_point_t&
     return std::make_pair(min_point, min_dis1);
 }
 
-const Cluster::sv3d_t& Cluster::sv3d() const { return m_node->value.scoped_view(scope); }
+const Cluster::sv3d_t& Cluster::sv3d() const
+{
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
+    const auto& sv = m_node->value.scoped_view(scope);
+    sv.kd().prepare();
+    return sv;
+}
 
 const Cluster::kd3d_t& Cluster::kd3d() const
 {
-    const auto& sv = m_node->value.scoped_view(scope);
+    const auto& sv = sv3d();
     return sv.kd();
 }
 const Cluster::kd3d_t& Cluster::kd() const
 {
-    const auto& sv = m_node->value.scoped_view(scope);
+    const auto& sv = sv3d();
     return sv.kd();
 }
 geo_point_t Cluster::point3d(size_t point_index) const { return kd3d().point3d(point_index); }
@@ -635,6 +649,7 @@ geo_point_t Cluster::point(size_t point_index) const { return point3d(point_inde
 const Cluster::points_type& Cluster::points() const { return kd3d().points(); }
 int Cluster::npoints() const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     if (!m_npoints) {
         const auto& sv = sv3d();
         m_npoints = sv.npoints();
@@ -652,6 +667,7 @@ size_t Cluster::nbpoints() const
 
 const Cluster::wire_indices_t& Cluster::wire_indices() const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     const auto& sv = m_node->value.scoped_view<int_t>(scope_wire_index);
     const auto& skd = sv.kd();
     const auto& points = skd.points();
@@ -1311,6 +1327,7 @@ std::tuple<int, int, int, int> Cluster::get_uvwt_range() const
 
 double Cluster::get_length() const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     if (m_length == 0) {  // invalidates when a new node is set
         const auto& tp = grouping()->get_params();
 
@@ -1587,6 +1604,7 @@ size_t Cluster::hash() const
 
 std::vector<int> Cluster::get_blob_indices(const Blob* blob) const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     if (m_map_mcell_indices.empty()) {
         const auto& skd = kd3d();
         for (size_t ind = 0; ind < skd.npoints(); ++ind) {
@@ -3469,6 +3487,7 @@ void Cluster::organize_path_points(std::vector<geo_point_t>& path_points, double
 
 std::vector<geo_point_t> Cluster::get_hull() const 
 {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     // add cached ...
     if (m_hull_calculated) {
         return m_hull_points;
@@ -3504,6 +3523,7 @@ std::vector<geo_point_t> Cluster::get_hull() const
 
 void Cluster::Calc_PCA() const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     if (m_pca_calculated) return;
 
     m_center.set(0, 0, 0);
@@ -3561,6 +3581,7 @@ void Cluster::Calc_PCA() const
 
 void Cluster::Calc_PCA(std::vector<geo_point_t>& points) const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     // Reset center
     m_center.set(0, 0, 0);
     int nsum = 0;
@@ -3686,12 +3707,14 @@ geo_vector_t Cluster::calc_pca_dir(const geo_point_t& center, const std::vector<
 
 
 geo_point_t Cluster::get_center() const {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     if (!m_pca_calculated) {
         Calc_PCA();
     }
     return m_center;
 }
 geo_vector_t Cluster::get_pca_axis(int axis) const {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     if (!m_pca_calculated) {
         Calc_PCA();
     }
@@ -3699,6 +3722,7 @@ geo_vector_t Cluster::get_pca_axis(int axis) const {
     return m_pca_axis[axis];
 }
 double Cluster::get_pca_value(int axis) const {
+    std::lock_guard<std::recursive_mutex> lock(m_lazy_mutex);
     if (!m_pca_calculated) {
         Calc_PCA();
     }
@@ -3,6 +3,9 @@
 #include "WireCellClus/Facade_Grouping.h"
 #include <boost/container_hash/hash.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 using namespace WireCell;
 using namespace WireCell::PointCloud;
 using namespace WireCell::PointCloud::Facade;
@@ -128,6 +131,123 @@ void Grouping::set_params(const WireCell::Configuration& cfg) {
     m_tp.FV_zmax_margin = get(cfg, "FV_zmax_margin", m_tp.FV_zmax_margin);
 }
 
+ClusterBoxes::ClusterBoxes(const std::vector<Cluster*>& clusters)
+{
+    m_boxes.reserve(clusters.size());
+    for (const Cluster* cluster : clusters) {
+        BoundingBox bb;
+        const auto& points = cluster->points();
+        const size_t npoints = points[0].size();
+        for (size_t ind = 0; ind < npoints; ++ind) {
+            bb(geo_point_t(points[0][ind], points[1][ind], points[2][ind]));
+        }
+        m_boxes.push_back(bb);
+    }
+}
+
+// The separation along one axis of two intervals, zero if overlapping.
+static double axis_gap(double lo1, double hi1, double lo2, double hi2)
+{
+    if (lo2 > hi1) return lo2 - hi1;
+    if (lo1 > hi2) return lo1 - hi2;
+    return 0;
+}
+
+double ClusterBoxes::distance(size_t one, size_t two) const
+{
+    const auto& b1 = m_boxes[one];
+    const auto& b2 = m_boxes[two];
+    if (b1.empty() or b2.empty()) {
+        return 0;
+    }
+    const auto& r1 = b1.bounds();
+    const auto& r2 = b2.bounds();
+    double sum = 0;
+    for (int axis = 0; axis < 3; ++axis) {
+        const double gap = axis_gap(r1.first[axis], r1.second[axis], r2.first[axis], r2.second[axis]);
+        sum += gap * gap;
+    }
+    return std::sqrt(sum);
+}
+
+double ClusterBoxes::distance(size_t index, const geo_point_t& point) const
+{
+    const auto& bb = m_boxes[index];
+    if (bb.empty()) {
+        return 0;
+    }
+    const auto& r = bb.bounds();
+    double sum = 0;
+    for (int axis = 0; axis < 3; ++axis) {
+        const double gap = axis_gap(r.first[axis], r.second[axis], point[axis], point[axis]);
+        sum += gap * gap;
+    }
+    return std::sqrt(sum);
+}
+
+std::vector<std::vector<size_t>> ClusterBoxes::neighbors(double distance) const
+{
+    const size_t nboxes = m_boxes.size();
+    std::vector<std::vector<size_t>> ret(nboxes);
+
+    // Sweep and prune along x.  Empty boxes neighbor everything.
+    std::vector<size_t> order, empties;
+    for (size_t ind = 0; ind < nboxes; ++ind) {
+        if (m_boxes[ind].empty()) {
+            empties.push_back(ind);
+        }
+        else {
+            order.push_back(ind);
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return m_boxes[a].bounds().first.x() < m_boxes[b].bounds().first.x();
+    });
+    for (size_t ii = 0; ii < order.size(); ++ii) {
+        const size_t one = order[ii];
+        const double xmax = m_boxes[one].bounds().second.x() + distance;
+        for (size_t jj = ii + 1; jj < order.size(); ++jj) {
+            const size_t two = order[jj];
+            if (m_boxes[two].bounds().first.x() > xmax) {
+                break;
+            }
+            if (this->distance(one, two) <= distance) {
+                ret[one].push_back(two);
+                ret[two].push_back(one);
+            }
+        }
+    }
+    for (size_t empty : empties) {
+        for (size_t ind = 0; ind < nboxes; ++ind) {
+            if (ind == empty) continue;
+            ret[ind].push_back(empty);
+            if (!m_boxes[ind].empty()) {
+                ret[empty].push_back(ind);
+            }
+        }
+    }
+    for (auto& one : ret) {
+        std::sort(one.begin(), one.end());
+    }
+    return ret;
+}
+
+std::vector<size_t> ClusterBoxes::near(const geo_point_t& point, double distance) const
+{
+    std::vector<size_t> ret;
+    for (size_t ind = 0; ind < m_boxes.size(); ++ind) {
+        if (this->distance(ind, point) <= distance) {
+            ret.push_back(ind);
+        }
+    }
+    return ret;
+}
+
+ClusterBoxes Grouping::cluster_boxes() const
+{
+    return ClusterBoxes(children());
+}
+
 size_t Grouping::hash() const
 {
     std::size_t h = 0;
@@ -150,9 +270,13 @@ const Grouping::kd2d_t& Grouping::kd2d(const int face, const int pind) const
 {
     const auto sname = String::format("ctpc_f%dp%d", face, pind);
     Tree::Scope scope = {sname, {"x", "y"}, 1};
+    std::lock_guard<std::mutex> lock(m_lazy_mutex);
     const auto& sv = m_node->value.scoped_view(scope);
     // std::cout << "sname: " << sname << " npoints: " << sv.kd().npoints() << std::endl;
-    return sv.kd();
+    // Build the index while locked so concurrent queries only read.
+    const auto& kd = sv.kd();
+    kd.prepare();
+    return kd;
 }
 
 
@@ -357,6 +481,7 @@ std::pair<double,double> Grouping::convert_time_ch_2Dpoint(const int timeslice,
 size_t Grouping::get_num_points(const int face, const int pind) const {
     const auto sname = String::format("ctpc_f%dp%d", face, pind);
     Tree::Scope scope = {sname, {"x", "y"}, 1};
+    std::lock_guard<std::mutex> lock(m_lazy_mutex);
     const auto& sv = m_node->value.scoped_view(scope);
     return sv.npoints();
 }
@@ -478,6 +603,7 @@ void Grouping::clear_cache() const
 
 
     // This is utterly broken.  #381.
+    std::lock_guard<std::mutex> lock(m_lazy_mutex);
     m_dead_winds.clear(); 
 
 }
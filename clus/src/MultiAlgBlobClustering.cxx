@@ -77,7 +77,18 @@ void MultiAlgBlobClustering::configure(const WireCell::Configuration& cfg)
     // m_x_boundary_low_limit = get(cfg, "x_boundary_low_limit", m_x_boundary_low_limit);
     // m_x_boundary_high_limit = get(cfg, "x_boundary_high_limit", m_x_boundary_high_limit);
 
+    m_nthreads = get(cfg, "nthreads", m_nthreads);
+    if (m_nthreads < 0) {
+        std::string msg = "nthreads must not be negative";
+        log->error(msg);
+        THROW(ValueError() << errmsg{"MultiAlgBlobClustering: " + msg});
+    }
     m_func_cfgs = cfg["func_cfgs"];
+    for (auto& func_cfg : m_func_cfgs) {
+        if (! func_cfg.isMember("nthreads")) {
+            func_cfg["nthreads"] = m_nthreads;
+        }
+    }
 
 
     m_perf = get(cfg, "perf", m_perf);
@@ -117,6 +128,8 @@ WireCell::Configuration MultiAlgBlobClustering::default_configuration() const
     cfg["subRunNo"] = m_subRunNo;
     cfg["eventNo"] = m_eventNo;
 
+    cfg["nthreads"] = m_nthreads;
+
     return cfg;
 }
 
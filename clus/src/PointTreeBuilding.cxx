@@ -308,7 +308,7 @@ void PointTreeBuilding::add_ctpc(Points::node_ptr& root, const WireCell::ICluste
             auto& slice = std::get<slice_t>(cgnode.ptr);
             ++nslices;
             const auto& slice_index = slice->start()/tp.tick;
-            const auto& activity = slice->activity();
+            const auto& activity = slice->dense_activity();
             for (const auto& [ichan, charge] : activity) {
                 if(charge.uncertainty() > m_dead_threshold) {
                     // if (charge.value() >0)
@@ -386,7 +386,7 @@ void PointTreeBuilding::add_dead_winds(Points::node_ptr& root, const WireCell::I
         if (cgnode.code() != 's') continue;
         auto& slice = std::get<slice_t>(cgnode.ptr);
         // const auto& slice_index = slice->start()/m_tick;
-        const auto& activity = slice->activity();
+        const auto& activity = slice->dense_activity();
         for (const auto& [ichan, charge] : activity) {
             if(charge.uncertainty() < m_dead_threshold) continue;
             // log->debug("m_dead_threshold {} charge.uncertainty() {}", m_dead_threshold, charge.uncertainty());
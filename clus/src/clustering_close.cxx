@@ -34,11 +34,16 @@ void WireCell::PointCloud::Facade::clustering_close(
     ilive2desc[ilive] = boost::add_vertex(ilive, g);
   }
 
+  // Clustering_3rd_round() needs the clusters within the larger of
+  // 2cm and length_cut so only such candidates are judged.
+  const auto neighbors = live_grouping.cluster_boxes().neighbors(std::max(2*units::cm, length_cut));
+
   for (size_t i=0;i!=live_clusters.size();i++){
     auto cluster_1 = live_clusters.at(i);
     if (cluster_1->get_length() < 1.5*units::cm) continue;
     if (used_clusters.find(cluster_1)!=used_clusters.end()) continue;
-    for (size_t j=i+1;j<live_clusters.size();j++){
+    for (size_t j : neighbors[i]){
+      if (j <= i) continue;
       auto cluster_2 = live_clusters.at(j);
       if (used_clusters.find(cluster_2)!=used_clusters.end()) continue;
       if (cluster_2->get_length() < 1.5*units::cm) continue;
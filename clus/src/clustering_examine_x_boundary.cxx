@@ -1,5 +1,7 @@
 #include <WireCellClus/ClusteringFuncs.h>
 
+#include "WireCellUtil/Parallel.h"
+
 using namespace WireCell;
 using namespace WireCell::Clus;
 using namespace WireCell::Aux;
@@ -8,7 +10,8 @@ using namespace WireCell::PointCloud::Facade;
 using namespace WireCell::PointCloud::Tree;
 
 void WireCell::PointCloud::Facade::clustering_examine_x_boundary(
-    Grouping& live_grouping
+    Grouping& live_grouping,
+    const int nthreads
     )
 {
     std::vector<Cluster *> live_clusters = live_grouping.children();  // copy
@@ -24,29 +27,44 @@ void WireCell::PointCloud::Facade::clustering_examine_x_boundary(
     // std::vector<PR3DCluster *> new_clusters;
     // std::vector<PR3DCluster *> del_clusters;
 
-    for (size_t i = 0; i != live_clusters.size(); i++) {
+    // Examining only reads a cluster so all are examined first, possibly
+    // in parallel.  Separating changes the grouping and is done after, in
+    // order.
+    std::vector<std::vector<int>> b2groupids(live_clusters.size());
+    auto examine = [&](size_t i) {
         Cluster *cluster = live_clusters.at(i);
         // only examine big clusters ...
         if (cluster->get_length() > 5 * units::cm && cluster->get_length() < 150 * units::cm) {
             // cluster->Create_point_cloud();
             // std::cout << "Cluster " << i << " old pointer " << cluster << " nchildren " << cluster->nchildren() << std::endl;
-            auto b2groupid = cluster->examine_x_boundary(tp.FV_xmin - tp.FV_xmin_margin, tp.FV_xmax + tp.FV_xmax_margin);
-            if (b2groupid.empty()) {
-                continue;
-            }
-            live_grouping.separate(cluster, b2groupid, true);
-            assert(cluster == nullptr);
-
+            b2groupids[i] = cluster->examine_x_boundary(tp.FV_xmin - tp.FV_xmin_margin, tp.FV_xmax + tp.FV_xmax_margin);
+        }
+    };
+    if (nthreads == 0) {
+        for (size_t i = 0; i != live_clusters.size(); i++) examine(i);
+    }
+    else {
+        Parallel::for_each(live_clusters.size(), examine, nthreads);
+    }
 
-            // std::cout << "Cluster " << i << " is seperated into " << id2clusters.size() << " clusters" << std::endl;
-            // for (auto [id, ncluster] : id2clusters) {
-            //     std::cout << "id " << id << " new pointer " << ncluster << " nchildren " << ncluster->nchildren() << std::endl;
-            // }
-            // if (clusters.size() != 0) {
-            //     del_clusters.push_back(cluster);
-            //     std::copy(clusters.begin(), clusters.end(), std::back_inserter(new_clusters));
-            // }
+    for (size_t i = 0; i != live_clusters.size(); i++) {
+        Cluster *cluster = live_clusters.at(i);
+        const auto& b2groupid = b2groupids[i];
+        if (b2groupid.empty()) {
+            continue;
         }
+        live_grouping.separate(cluster, b2groupid, true);
+        assert(cluster == nullptr);
+
+
+        // std::cout << "Cluster " << i << " is seperated into " << id2clusters.size() << " clusters" << std::endl;
+        // for (auto [id, ncluster] : id2clusters) {
+        //     std::cout << "id " << id << " new pointer " << ncluster << " nchildren " << ncluster->nchildren() << std::endl;
+        // }
+        // if (clusters.size() != 0) {
+        //     del_clusters.push_back(cluster);
+        //     std::copy(clusters.begin(), clusters.end(), std::back_inserter(new_clusters));
+        // }
     }
 
     // for (auto it = new_clusters.begin(); it != new_clusters.end(); it++) {
@@ -48,6 +48,14 @@ void WireCell::PointCloud::Facade::clustering_extend(
   int length_1_cut = 40*units::cm + num_try * 10*units::cm;
 
   if (flag==1) length_1_cut = 20*units::cm + num_try*10*units::cm; //prolong case
+
+  // Each Clustering_4th_*() needs the other cluster to be within some
+  // distance of a point or of the first cluster so only such candidates
+  // are judged.  The prolonged and parallel cases query around a point.
+  const auto boxes = live_grouping.cluster_boxes();
+  std::vector<std::vector<size_t>> neighbors;
+  if (flag==3) neighbors = boxes.neighbors(2*length_cut);
+  if (flag==4) neighbors = boxes.neighbors(std::max(80*units::cm, length_cut));
   
   for (size_t i=0;i!=live_clusters.size();i++){
     auto cluster_1 = live_clusters.at(i);
@@ -97,7 +105,7 @@ void WireCell::PointCloud::Facade::clustering_extend(
 	if (angle1 <5./180.*3.1415926 || angle2 < 5./180.*3.1415926 || angle3 < 5./180.*3.1415926){
 	  // flag_prol = true;
 	  
-	  for (size_t j=0;j!=live_clusters.size();j++){
+	  for (size_t j : boxes.near(earliest_p, length_cut)){
 	    auto cluster_2 = live_clusters.at(j);
 	    if (used_clusters.find(cluster_2)!=used_clusters.end()) continue;
 	    if (cluster_2==cluster_1) continue;
@@ -117,7 +125,7 @@ void WireCell::PointCloud::Facade::clustering_extend(
 	if (angle4<5./180.*3.1415926 || angle5 < 5./180.*3.1415926 || angle6 < 5./180.*3.1415926){
 
 	  // flag_prol = true;
-	  for (size_t j=0;j!=live_clusters.size();j++){
+	  for (size_t j : boxes.near(latest_p, length_cut)){
 	    auto cluster_2 = live_clusters.at(j);
 	    if (used_clusters.find(cluster_2)!=used_clusters.end()) continue;
 	    if (cluster_2==cluster_1) continue;
@@ -144,7 +152,7 @@ void WireCell::PointCloud::Facade::clustering_extend(
 	 if (fabs(dir_highp.angle(drift_dir)-3.1415926/2.)<5/180.*3.1415926){ 
 	   // flag_para = true; 
 
-	   for (size_t j=0;j!=live_clusters.size();j++){
+	   for (size_t j : boxes.near(highest_p, length_cut)){
 	     auto cluster_2 = live_clusters.at(j);
 	     if (used_clusters.find(cluster_2)!=used_clusters.end()) continue;
 	     if (cluster_2==cluster_1) continue;
@@ -165,7 +173,7 @@ void WireCell::PointCloud::Facade::clustering_extend(
 	 if (fabs(dir_lowp.angle(drift_dir)-3.1415926/2.)<5/180.*3.1415926 ){ 
 	   // flag_para = true; 
 
-	   for (size_t j=0;j!=live_clusters.size();j++){
+	   for (size_t j : boxes.near(lowest_p, length_cut)){
 	     auto cluster_2 = live_clusters.at(j);
 	     if (cluster_2==cluster_1) continue;
 	     if (Clustering_4th_para(*cluster_1,*cluster_2,cluster_1->get_length(),cluster_2->get_length(),lowest_p,dir_lowp,length_cut)){
@@ -193,7 +201,7 @@ void WireCell::PointCloud::Facade::clustering_extend(
 	  second_p = el_ps.second;
 	}
 
-	for (size_t j=0;j!=live_clusters.size();j++){
+	for (size_t j : neighbors[i]){
 	  auto cluster_2 = live_clusters.at(j);
 	  if (used_clusters.find(cluster_2)!=used_clusters.end()) continue;
 	  if (cluster_2==cluster_1) continue;
@@ -223,7 +231,7 @@ void WireCell::PointCloud::Facade::clustering_extend(
       }else if (flag==4){
 	if (cluster_connected_dead.find(cluster_1)!=cluster_connected_dead.end()){
 	  used_clusters.insert(cluster_1);
-	  for (size_t j=0;j!=live_clusters.size();j++){
+	  for (size_t j : neighbors[i]){
 	    auto cluster_2 = live_clusters.at(j);
 	    if (cluster_2->get_length() < length_2_cut) continue;
 	    if (used_clusters.find(cluster_2)!=used_clusters.end()) continue;
@@ -1,5 +1,7 @@
 #include <WireCellClus/ClusteringFuncs.h>
 
+#include "WireCellUtil/Parallel.h"
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wparentheses"
 
@@ -12,7 +14,8 @@ using namespace WireCell::PointCloud::Tree;
 void WireCell::PointCloud::Facade::clustering_parallel_prolong(
     Grouping& live_grouping,
     cluster_set_t& cluster_connected_dead,     // in/out
-    const double length_cut                    //
+    const double length_cut,                   //
+    const int nthreads                         //
 )
 {
   // prepare graph ...
@@ -32,22 +35,40 @@ void WireCell::PointCloud::Facade::clustering_parallel_prolong(
   // original algorithm ... (establish edges ... )
 
 
-  for (size_t i=0;i!=live_clusters.size();i++){
+  // Clustering_2nd_round() needs the clusters within the larger of
+  // 80cm and length_cut so only such candidates are judged.
+  const auto neighbors = live_grouping.cluster_boxes().neighbors(std::max(80*units::cm, length_cut));
+
+  // Each pair is judged independently.  The partners of cluster i are
+  // collected in order so the edges are added as if judged serially.
+  std::vector<std::vector<size_t>> partners(live_clusters.size());
+  auto judge = [&](size_t i) {
     auto cluster_1 = live_clusters.at(i);
-    for (size_t j=i+1;j<live_clusters.size();j++){
+    for (size_t j : neighbors[i]){
+      if (j <= i) continue;
       auto cluster_2 = live_clusters.at(j);
       if (Clustering_2nd_round(*cluster_1,*cluster_2, cluster_1->get_length(), cluster_2->get_length(), length_cut)){
 
 		// // debug ...
         // std::cout << cluster_1->get_length()/units::cm << " " << cluster_2->get_length()/units::cm << std::endl;
 
-		//to_be_merged_pairs.insert(std::make_pair(cluster_1,cluster_2));
-		boost::add_edge(ilive2desc[map_cluster_index[cluster_1]],
-			ilive2desc[map_cluster_index[cluster_2]], g);
-
-
+		partners[i].push_back(j);
       }
     }
+  };
+  if (nthreads == 0) {
+    for (size_t i=0;i!=live_clusters.size();i++) judge(i);
+  }
+  else {
+    Parallel::for_each(live_clusters.size(), judge, nthreads);
+  }
+
+  for (size_t i=0;i!=live_clusters.size();i++){
+    for (size_t j : partners[i]){
+      //to_be_merged_pairs.insert(std::make_pair(cluster_1,cluster_2));
+      boost::add_edge(ilive2desc[map_cluster_index[live_clusters[i]]],
+                      ilive2desc[map_cluster_index[live_clusters[j]]], g);
+    }
   }
 
   // new function to  merge clusters ...
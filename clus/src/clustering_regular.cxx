@@ -1,5 +1,7 @@
 #include <WireCellClus/ClusteringFuncs.h>
 
+#include "WireCellUtil/Parallel.h"
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wparentheses"
 
@@ -13,7 +15,8 @@ void WireCell::PointCloud::Facade::clustering_regular(
     Grouping& live_grouping,
     cluster_set_t& cluster_connected_dead,            // in/out
     const double length_cut,                                       //
-    bool flag_enable_extend                                        //
+    bool flag_enable_extend,                                       //
+    const int nthreads                                             //
 )
 {
   double internal_length_cut = 10 *units::cm;
@@ -38,10 +41,18 @@ void WireCell::PointCloud::Facade::clustering_regular(
   // original algorithm ... (establish edges ... )
 
 
-  for (size_t i=0;i!=live_clusters.size();i++){
+  // Clustering_1st_round() needs the clusters within length_cut so
+  // only such candidates are judged.
+  const auto neighbors = live_grouping.cluster_boxes().neighbors(length_cut);
+
+  // Each pair is judged independently.  The partners of cluster i are
+  // collected in order so the edges are added as if judged serially.
+  std::vector<std::vector<size_t>> partners(live_clusters.size());
+  auto judge = [&](size_t i) {
     auto cluster_1 = live_clusters.at(i);
-    if (cluster_1->get_length() < internal_length_cut) continue;
-    for (size_t j=i+1;j<live_clusters.size();j++){
+    if (cluster_1->get_length() < internal_length_cut) return;
+    for (size_t j : neighbors[i]){
+      if (j <= i) continue;
       auto cluster_2 = live_clusters.at(j);
       if (cluster_2->get_length() < internal_length_cut) continue;
 
@@ -50,11 +61,23 @@ void WireCell::PointCloud::Facade::clustering_regular(
         // debug ...
         //std::cout << cluster_1->get_length()/units::cm << " " << cluster_2->get_length()/units::cm << std::endl;
 
-	      //	to_be_merged_pairs.insert(std::make_pair(cluster_1,cluster_2));
-	      boost::add_edge(ilive2desc[map_cluster_index[cluster_1]],
-			  ilive2desc[map_cluster_index[cluster_2]], g);
+        partners[i].push_back(j);
       }
     }
+  };
+  if (nthreads == 0) {
+    for (size_t i=0;i!=live_clusters.size();i++) judge(i);
+  }
+  else {
+    Parallel::for_each(live_clusters.size(), judge, nthreads);
+  }
+
+  for (size_t i=0;i!=live_clusters.size();i++){
+    for (size_t j : partners[i]){
+      //	to_be_merged_pairs.insert(std::make_pair(cluster_1,cluster_2));
+      boost::add_edge(ilive2desc[map_cluster_index[live_clusters[i]]],
+                      ilive2desc[map_cluster_index[live_clusters[j]]], g);
+    }
   }
 
   // new function to  merge clusters ...
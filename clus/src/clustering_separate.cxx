@@ -1,5 +1,7 @@
 #include <WireCellClus/ClusteringFuncs.h>
 
+#include "WireCellUtil/Parallel.h"
+
 // The original developers do not care.
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wparentheses"
@@ -15,7 +17,8 @@ using namespace WireCell::PointCloud::Tree;
 
 
 void WireCell::PointCloud::Facade::clustering_separate(Grouping& live_grouping,
-                                   const bool use_ctpc)
+                                   const bool use_ctpc,
+                                   const int nthreads)
 {
     std::map<int, std::pair<double, double>>& dead_u_index = live_grouping.get_dead_winds(0, 0);
     std::map<int, std::pair<double, double>>& dead_v_index = live_grouping.get_dead_winds(0, 1);
@@ -42,6 +45,35 @@ void WireCell::PointCloud::Facade::clustering_separate(Grouping& live_grouping,
     std::vector<Cluster *> new_clusters;
     std::vector<Cluster *> del_clusters;
 
+    // The first judgments only read a cluster so are made for all clusters
+    // first, possibly in parallel.  Separating changes the grouping and is
+    // done after, in order.
+    struct Judgment {
+        bool flag_proceed{false};
+        bool flag_dec_1{false};
+        std::vector<geo_point_t> boundary_points;
+        std::vector<geo_point_t> independent_points;
+    };
+    std::vector<Judgment> judgments(live_clusters.size());
+    auto judge = [&](size_t i) {
+        const Cluster *cluster = live_clusters.at(i);
+        if (cluster->get_length() <= 100 * units::cm) {
+            return;
+        }
+        auto& judged = judgments[i];
+        judged.flag_proceed = JudgeSeparateDec_2(cluster, drift_dir, judged.boundary_points,
+                                                 judged.independent_points, cluster->get_length());
+        if (!judged.flag_proceed) {
+            judged.flag_dec_1 = JudgeSeparateDec_1(cluster, drift_dir, cluster->get_length(), live_time_slice_width);
+        }
+    };
+    if (nthreads == 0) {
+        for (size_t i = 0; i != live_clusters.size(); i++) judge(i);
+    }
+    else {
+        Parallel::for_each(live_clusters.size(), judge, nthreads);
+    }
+
     for (size_t i = 0; i != live_clusters.size(); i++) {
         Cluster *cluster = live_clusters.at(i);
         // FIXME: remove this after debugging
@@ -63,11 +95,10 @@ void WireCell::PointCloud::Facade::clustering_separate(Grouping& live_grouping,
         // }
 
         if (cluster->get_length() > 100 * units::cm) {
-            std::vector<geo_point_t> boundary_points;
-            std::vector<geo_point_t> independent_points;
+            std::vector<geo_point_t>& boundary_points = judgments[i].boundary_points;
+            std::vector<geo_point_t>& independent_points = judgments[i].independent_points;
 
-            bool flag_proceed =
-                JudgeSeparateDec_2(cluster, drift_dir, boundary_points, independent_points, cluster->get_length());
+            bool flag_proceed = judgments[i].flag_proceed;
             // if (flag_debug_porting) {
             //     std::cout
             //     << " flag_proceed " << flag_proceed
@@ -80,7 +111,7 @@ void WireCell::PointCloud::Facade::clustering_separate(Grouping& live_grouping,
 
 
             if (!flag_proceed && cluster->get_length() > 100 * units::cm &&
-                JudgeSeparateDec_1(cluster, drift_dir, cluster->get_length(), live_time_slice_width) &&
+                judgments[i].flag_dec_1 &&
                 independent_points.size() > 0) {
                 bool flag_top = false;
                 for (size_t j = 0; j != independent_points.size(); j++) {
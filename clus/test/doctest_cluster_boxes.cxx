@@ -0,0 +1,196 @@
+#include "WireCellUtil/PointTesting.h"
+#include "WireCellUtil/doctest.h"
+#include "WireCellUtil/Logging.h"
+
+#include "WireCellClus/ClusteringFuncs.h"
+
+#include <random>
+
+using namespace WireCell;
+using namespace WireCell::PointTesting;
+using namespace WireCell::PointCloud;
+using namespace WireCell::PointCloud::Tree;
+using namespace WireCell::PointCloud::Facade;
+using fa_float_t = WireCell::PointCloud::Facade::float_t;
+using fa_int_t = WireCell::PointCloud::Facade::int_t;
+using spdlog::debug;
+
+// A blob node sampling a short track segment.
+static Points make_blob(const Ray& seg)
+{
+    const auto center = 0.5 * (seg.first + seg.second);
+    return Points({
+        {"scalar", Dataset({
+            {"charge", Array({(fa_float_t)1.0})},
+            {"center_x", Array({(fa_float_t)center.x()})},
+            {"center_y", Array({(fa_float_t)center.y()})},
+            {"center_z", Array({(fa_float_t)center.z()})},
+            {"npoints", Array({(fa_int_t)10})},
+            {"slice_index_min", Array({(fa_int_t)0})},
+            {"slice_index_max", Array({(fa_int_t)1})},
+            {"u_wire_index_min", Array({(fa_int_t)0})},
+            {"u_wire_index_max", Array({(fa_int_t)1})},
+            {"v_wire_index_min", Array({(fa_int_t)0})},
+            {"v_wire_index_max", Array({(fa_int_t)1})},
+            {"w_wire_index_min", Array({(fa_int_t)0})},
+            {"w_wire_index_max", Array({(fa_int_t)1})},
+            {"max_wire_interval", Array({(fa_int_t)1})},
+            {"min_wire_interval", Array({(fa_int_t)1})},
+            {"max_wire_type", Array({(fa_int_t)0})},
+            {"min_wire_type", Array({(fa_int_t)0})},
+        })},
+        {"3d", make_janky_track(seg, 0.3 * units::cm)}});
+}
+
+// A grouping of straight track clusters, each made of 2cm blobs, some
+// touching, some nearby and some far apart.
+static void make_grouping(Points::node_t& root, size_t nclusters, size_t seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> pos(0, 150 * units::cm);
+    std::uniform_real_distribution<double> len(3 * units::cm, 80 * units::cm);
+    std::uniform_real_distribution<double> cth(-1, 1), phi(0, 2 * M_PI);
+
+    for (size_t icl = 0; icl < nclusters; ++icl) {
+        Point start(pos(rng), pos(rng), pos(rng));
+        if (icl % 3 == 1) {
+            // Start near the end of the previous track.
+            start = root.children().back()->value.facade<Cluster>()->get_earliest_latest_points().first;
+            start += Point(1 * units::cm, 0, 0);
+        }
+        const double c = cth(rng), s = std::sqrt(1 - c * c), p = phi(rng);
+        const Point dir(s * std::cos(p), s * std::sin(p), c);
+        const double length = len(rng);
+
+        auto cnode = std::make_unique<Points::node_t>();
+        for (double at = 0; at < length; at += 2 * units::cm) {
+            const double end = std::min(length, at + 2 * units::cm);
+            cnode->insert(make_blob(Ray(start + at * dir, start + end * dir)));
+        }
+        root.insert(std::move(cnode));
+    }
+}
+
+// The smallest distance between any points of two clusters.
+static double point_distance(const Cluster& one, const Cluster& two)
+{
+    const auto& p1 = one.points();
+    double best = 1e9;
+    for (size_t ind = 0; ind < p1[0].size(); ++ind) {
+        const Point pt(p1[0][ind], p1[1][ind], p1[2][ind]);
+        best = std::min(best, (two.get_closest_point_blob(pt).first - pt).magnitude());
+    }
+    return best;
+}
+
+TEST_CASE("clus cluster boxes index")
+{
+    Points::node_t root;
+    Grouping* grouping = root.value.facade<Grouping>();
+    make_grouping(root, 30, 1);
+    const auto& clusters = grouping->children();
+    REQUIRE(clusters.size() == 30);
+
+    const auto boxes = grouping->cluster_boxes();
+    REQUIRE(boxes.size() == clusters.size());
+
+    for (size_t one = 0; one < clusters.size(); ++one) {
+        for (size_t two = one + 1; two < clusters.size(); ++two) {
+            CHECK(boxes.distance(one, two) == boxes.distance(two, one));
+            CHECK(boxes.distance(one, two) <= point_distance(*clusters[one], *clusters[two]));
+        }
+        const auto pt = clusters[one]->point3d(0);
+        CHECK(boxes.distance(one, pt) == 0);
+    }
+
+    for (double cut : {0.0, 1 * units::cm, 10 * units::cm, 50 * units::cm, 1000 * units::cm}) {
+        const auto neighbors = boxes.neighbors(cut);
+        REQUIRE(neighbors.size() == clusters.size());
+        for (size_t one = 0; one < clusters.size(); ++one) {
+            std::vector<size_t> want;
+            for (size_t two = 0; two < clusters.size(); ++two) {
+                if (two != one and boxes.distance(one, two) <= cut) {
+                    want.push_back(two);
+                }
+            }
+            CHECK(neighbors[one] == want);
+
+            const auto pt = clusters[one]->point3d(0);
+            want.clear();
+            for (size_t two = 0; two < clusters.size(); ++two) {
+                if (boxes.distance(two, pt) <= cut) {
+                    want.push_back(two);
+                }
+            }
+            CHECK(boxes.near(pt, cut) == want);
+        }
+    }
+}
+
+// Every pair a judge would merge must be among the candidates offered
+// with the distance cut its clustering pass uses.  Then the merge
+// graph and thus the merge result is identical to the all-pairs one.
+TEST_CASE("clus cluster boxes candidates")
+{
+    Points::node_t root;
+    Grouping* grouping = root.value.facade<Grouping>();
+    make_grouping(root, 30, 2);
+    const auto& clusters = grouping->children();
+    const auto boxes = grouping->cluster_boxes();
+
+    auto is_neighbor = [](const std::vector<size_t>& cands, size_t ind) {
+        return std::find(cands.begin(), cands.end(), ind) != cands.end();
+    };
+
+    const double cut1 = 15 * units::cm, cut2 = 35 * units::cm, cut3 = 1 * units::cm, cut4 = 15 * units::cm;
+    const auto nn1 = boxes.neighbors(cut1);
+    const auto nn2 = boxes.neighbors(std::max(80 * units::cm, cut2));
+    const auto nn3 = boxes.neighbors(std::max(2 * units::cm, cut3));
+    const auto nn4reg = boxes.neighbors(2 * cut4);
+    const auto nn4dead = boxes.neighbors(std::max(80 * units::cm, cut4));
+
+    size_t nmerge = 0;
+    for (size_t one = 0; one < clusters.size(); ++one) {
+        const Cluster& c1 = *clusters[one];
+        const double l1 = c1.get_length();
+        const auto [earliest_p, latest_p] = c1.get_earliest_latest_points();
+        geo_point_t early = earliest_p;
+        geo_point_t dir_early = c1.vhough_transform(early, 60 * units::cm);
+        const auto near_early = boxes.near(early, cut4);
+
+        for (size_t two = 0; two < clusters.size(); ++two) {
+            if (two == one) continue;
+            const Cluster& c2 = *clusters[two];
+            const double l2 = c2.get_length();
+
+            if (one < two) {
+                if (Clustering_1st_round(c1, c2, l1, l2, cut1)) {
+                    ++nmerge;
+                    CHECK(is_neighbor(nn1[one], two));
+                }
+                if (Clustering_2nd_round(c1, c2, l1, l2, cut2)) {
+                    ++nmerge;
+                    CHECK(is_neighbor(nn2[one], two));
+                }
+                if (Clustering_3rd_round(c1, c2, l1, l2, cut3)) {
+                    ++nmerge;
+                    CHECK(is_neighbor(nn3[one], two));
+                }
+            }
+            if (Clustering_4th_reg(c1, c2, l1, l2, early, cut4)) {
+                ++nmerge;
+                CHECK(is_neighbor(nn4reg[one], two));
+            }
+            if (Clustering_4th_dead(c1, c2, l1, l2, cut4)) {
+                ++nmerge;
+                CHECK(is_neighbor(nn4dead[one], two));
+            }
+            if (Clustering_4th_prol(c1, c2, l2, early, dir_early, cut4)) {
+                ++nmerge;
+                CHECK(is_neighbor(near_early, two));
+            }
+        }
+    }
+    debug("{} merging judgments", nmerge);
+    CHECK(nmerge > 0);
+}
@@ -0,0 +1,120 @@
+#include "WireCellUtil/PointTesting.h"
+#include "WireCellUtil/doctest.h"
+#include "WireCellUtil/Logging.h"
+#include "WireCellUtil/Parallel.h"
+
+#include "WireCellClus/Facade_Cluster.h"
+#include "WireCellClus/Facade_Grouping.h"
+
+#include <random>
+
+using namespace WireCell;
+using namespace WireCell::PointTesting;
+using namespace WireCell::PointCloud;
+using namespace WireCell::PointCloud::Tree;
+using namespace WireCell::PointCloud::Facade;
+using fa_float_t = WireCell::PointCloud::Facade::float_t;
+using fa_int_t = WireCell::PointCloud::Facade::int_t;
+using spdlog::debug;
+
+// A blob node sampling a short track segment in one time slice.
+static Points make_blob(const Ray& seg, int slice)
+{
+    const auto center = 0.5 * (seg.first + seg.second);
+    return Points({
+        {"scalar", Dataset({
+            {"charge", Array({(fa_float_t)1.0})},
+            {"center_x", Array({(fa_float_t)center.x()})},
+            {"center_y", Array({(fa_float_t)center.y()})},
+            {"center_z", Array({(fa_float_t)center.z()})},
+            {"npoints", Array({(fa_int_t)10})},
+            {"slice_index_min", Array({(fa_int_t)slice})},
+            {"slice_index_max", Array({(fa_int_t)(slice + 1)})},
+            {"u_wire_index_min", Array({(fa_int_t)slice})},
+            {"u_wire_index_max", Array({(fa_int_t)(slice + 1)})},
+            {"v_wire_index_min", Array({(fa_int_t)slice})},
+            {"v_wire_index_max", Array({(fa_int_t)(slice + 1)})},
+            {"w_wire_index_min", Array({(fa_int_t)slice})},
+            {"w_wire_index_max", Array({(fa_int_t)(slice + 1)})},
+            {"max_wire_interval", Array({(fa_int_t)1})},
+            {"min_wire_interval", Array({(fa_int_t)1})},
+            {"max_wire_type", Array({(fa_int_t)0})},
+            {"min_wire_type", Array({(fa_int_t)0})},
+        })},
+        {"3d", make_janky_track(seg, 0.3 * units::cm)}});
+}
+
+static void make_grouping(Points::node_t& root, size_t nclusters)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> pos(0, 100 * units::cm);
+    for (size_t icl = 0; icl < nclusters; ++icl) {
+        const Point start(pos(rng), pos(rng), pos(rng));
+        const Point end(pos(rng), pos(rng), pos(rng));
+        const Vector step = (end - start) / 10.0;
+        auto cnode = std::make_unique<Points::node_t>();
+        for (int ind = 0; ind < 10; ++ind) {
+            cnode->insert(make_blob(Ray(start + double(ind) * step, start + double(ind + 1) * step), ind));
+        }
+        root.insert(std::move(cnode));
+    }
+}
+
+// What a clustering function may lazily fill on a cluster.
+struct Summary {
+    double length{0};
+    int npoints{0};
+    size_t nslices{0}, nhull{0};
+    geo_point_t center;
+    double pca0{0};
+    size_t nnear{0};
+};
+
+static Summary summarize(const Cluster& cluster)
+{
+    Summary s;
+    s.length = cluster.get_length();
+    s.npoints = cluster.npoints();
+    s.nslices = cluster.get_num_time_slices();
+    s.nhull = cluster.get_hull().size();
+    s.center = cluster.get_center();
+    s.pca0 = cluster.get_pca_value(0);
+    s.nnear = cluster.kd_radius(5 * units::cm, cluster.point3d(0)).size();
+    return s;
+}
+
+TEST_CASE("clus cluster concurrent cache fill")
+{
+    const size_t nclusters = 8;
+
+    Points::node_t serial_root;
+    make_grouping(serial_root, nclusters);
+    const auto& serial = serial_root.value.facade<Grouping>()->children();
+    std::vector<Summary> want;
+    for (const auto* cluster : serial) {
+        want.push_back(summarize(*cluster));
+    }
+
+    // Many jobs share each cluster so its caches are filled concurrently.
+    Points::node_t root;
+    make_grouping(root, nclusters);
+    const auto& clusters = root.value.facade<Grouping>()->children();
+    const size_t njobs = 16 * nclusters;
+    std::vector<Summary> got(njobs);
+    Parallel::for_each(njobs, [&](size_t job) {
+        got[job] = summarize(*clusters[job % nclusters]);
+    }, 8);
+
+    for (size_t job = 0; job < njobs; ++job) {
+        const auto& w = want[job % nclusters];
+        const auto& g = got[job];
+        CHECK(g.length == w.length);
+        CHECK(g.npoints == w.npoints);
+        CHECK(g.nslices == w.nslices);
+        CHECK(g.nhull == w.nhull);
+        CHECK(g.center == w.center);
+        CHECK(g.pca0 == w.pca0);
+        CHECK(g.nnear == w.nnear);
+    }
+    debug("{} clusters summarized by {} jobs", nclusters, njobs);
+}
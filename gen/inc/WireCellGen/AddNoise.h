@@ -9,6 +9,8 @@
 
 #include "WireCellGen/Noise.h"
 
+#include "WireCellAux/NoiseTools.h"
+
 #include "WireCellIface/IFrameFilter.h"
 #include "WireCellIface/IChannelSpectrum.h"
 #include "WireCellIface/IGroupSpectrum.h"
@@ -27,6 +29,12 @@ namespace WireCell::Gen {
 
         /// IFrameFilter
         virtual bool operator()(const input_pointer& inframe, output_pointer& outframe);
+
+      private:
+
+        // Add noise to traces using batched DFTs.
+        ITrace::vector add_batched(const ITrace::vector& traces,
+                                   Aux::NoiseTools::Generator& gen);
     };
 
     class CoherentAddNoise : public NoiseBaseT<IGroupSpectrum>,
@@ -39,6 +47,12 @@ namespace WireCell::Gen {
 
         /// IFrameFilter
         virtual bool operator()(const input_pointer& inframe, output_pointer& outframe);
+
+      private:
+
+        // Add noise to traces using batched DFTs.
+        ITrace::vector add_batched(const ITrace::vector& traces,
+                                   Aux::NoiseTools::Generator& gen);
     };
 
 
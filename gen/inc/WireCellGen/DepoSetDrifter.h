@@ -4,8 +4,9 @@
 // extra work to keep its output in time order where as we could do
 // better by ignoring order during drifting and do a final sort().
 //
-// Further improvements would drift depos as a block and utilize SIMD.
-// See gen-kokkos for smarter smarts.
+// Setting "columnar" to true instead drifts the depos as a block
+// with Gen::Drifter::drift() and produces an Aux::ColumnarDepoSet
+// fully ordered by drifted time.  See gen-kokkos for smarter smarts.
 //
 // The only practical reason to use this is it will speed up Pgrapher
 // (less so, TbbFlow) compared to using a bare per depo drifter.
@@ -21,6 +22,8 @@
 
 namespace WireCell::Gen {
 
+    class Drifter;
+
     class DepoSetDrifter : public Aux::Logger,
                            public IDepoSetFilter, public IConfigurable {     
       public:
@@ -38,6 +41,9 @@ namespace WireCell::Gen {
       private:
 
         IDrifter::pointer m_drifter{nullptr};
+
+        // Set if drifting as a block.
+        std::shared_ptr<Drifter> m_columnar{nullptr};
         size_t m_count{0};
 
     };
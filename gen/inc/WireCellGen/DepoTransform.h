@@ -14,6 +14,7 @@
 #include "WireCellIface/IAnodePlane.h"
 #include "WireCellIface/WirePlaneId.h"
 #include "WireCellIface/IDepo.h"
+#include "WireCellIface/ITrace.h"
 
 #include <algorithm>
 #include <vector>
@@ -38,6 +39,11 @@ namespace WireCell {
             virtual IDepo::pointer modify_depo(WirePlaneId wpid, IDepo::pointer depo) { return depo; }
 
            private:
+            // Return the traces of one plane given its face's depos.
+            ITrace::vector plane_traces(IWirePlane::pointer plane, int iplane,
+                                        const IDepo::vector& face_depos,
+                                        IRandom::pointer rng);
+
             IAnodePlane::pointer m_anode;
             IRandom::pointer m_rng;
             IDFT::pointer m_dft;
@@ -50,6 +56,7 @@ namespace WireCell {
             double m_nsigma;
             int m_frame_count;
             size_t m_count{0};
+            int m_nthreads{0};
 
 	    std::vector<int> m_process_planes {0,1,2};
         };
@@ -3,6 +3,7 @@
 
 #include "WireCellAux/Logger.h"
 #include "WireCellIface/IDrifter.h"
+#include "WireCellIface/IDepoSet.h"
 #include "WireCellIface/IConfigurable.h"
 #include "WireCellIface/IRandom.h"
 #include "WireCellUtil/Units.h"
@@ -120,6 +121,15 @@ namespace WireCell {
             // Return the "proper time" for a deposition
             double proper_time(IDepo::pointer depo);
 
+            /// Drift a whole set of depos column by column.  The
+            /// depos are as from the per-depo interface but ordered
+            /// by their drifted time and held in an
+            /// Aux::ColumnarDepoSet.  An input ColumnarDepoSet is
+            /// read through its columns and its depos, which are the
+            /// priors of the output, are made only if the output
+            /// depos are.  The per-depo buffers are not used.
+            IDepoSet::pointer drift(const IDepoSet::pointer& in, int ident);
+
             bool insert(const input_pointer& depo);
             void flush(output_queue& outq);
             void flush_ripe(output_queue& outq, double now);
@@ -17,7 +17,7 @@
 
 namespace WireCell {
 
-    typedef std::queue<boost::any> Pipe;
+    typedef std::queue<SharedAny> Pipe;
 
     // Base class for something that executes as a thunk.
     class Proc {
@@ -98,7 +98,7 @@ namespace WireCell {
             if (iq.empty()) {
                 return false;
             }
-            boost::any anyout;
+            SharedAny anyout;
             bool ok = (*node)(iq.front(), anyout);
             if (!ok) return false;
             iq.pop();
@@ -147,7 +147,7 @@ namespace WireCell {
 
         virtual bool operator()()
         {
-            boost::any anyout;
+            SharedAny anyout;
             bool ok = (*node)(anyout);
             if (!ok) return false;
             oq.push(anyout);
@@ -189,7 +189,7 @@ namespace WireCell {
         node_pointer_t node;
     };
 
-    typedef std::deque<boost::any> queuedany;
+    typedef std::deque<SharedAny> queuedany;
 
     // A proc which pops an input element, feeds it to a node, assumes the
     // node is a queuedany, iterates over it and feeds individual elements
@@ -36,6 +36,10 @@ namespace WireCell::Gen {
         size_t m_count{0};
 
         double m_bug202{0.0};   // non-zero emulates issue #202
+
+        // Number of noise waveforms per batched inverse DFT, 0 for
+        // one DFT per waveform.
+        size_t m_batch{0};
     };
 
     /// Incoherent and coherent noise each have their own type of
@@ -0,0 +1,68 @@
+/**
+   Gen::PhiloxRandom is an IRandom based on the counter-based Philox
+   generator (see WireCellUtil/Philox.h).
+
+   Compared to Gen::Random it provides fast bulk "fill" methods and
+   cheap substreams.  A substream is determined only by the
+   configuration and its key so that work split over threads or
+   objects, each with its own substream, is reproducible regardless of
+   scheduling.  A single instance is not safe to share across threads.
+
+   Multinomial sampling replaces binomials of variance larger than
+   "normal_threshold" by their normal approximation.  The total count
+   remains exact.
+
+   Note, "exponential()" interprets its argument as a rate, as does
+   Gen::Random.
+ */
+
+#ifndef WIRECELLGEN_PHILOXRANDOM
+#define WIRECELLGEN_PHILOXRANDOM
+
+#include "WireCellIface/IRandom.h"
+#include "WireCellIface/IConfigurable.h"
+#include "WireCellUtil/Philox.h"
+
+#include <vector>
+
+namespace WireCell::Gen {
+
+    class PhiloxRandom : public IRandom, public IConfigurable {
+      public:
+        PhiloxRandom(const std::vector<unsigned int> seeds = {0, 0, 0, 0, 0}, uint64_t stream = 0);
+        virtual ~PhiloxRandom();
+
+        // IConfigurable interface
+        virtual void configure(const WireCell::Configuration& config);
+        virtual WireCell::Configuration default_configuration() const;
+
+        // IRandom interface
+        virtual int binomial(int max, double prob);
+        virtual int poisson(double mean);
+        virtual double normal(double mean, double sigma);
+        virtual double uniform(double begin, double end);
+        virtual double exponential(double mean);
+        virtual int range(int first, int last);
+
+        virtual void fill_normal(double* out, size_t n, double mean, double sigma);
+        virtual void fill_uniform(double* out, size_t n, double begin, double end);
+        virtual void fill_binomial(int* out, size_t n, const int* max, const double* prob);
+        virtual void fill_multinomial(int* out, size_t n, int total, const double* prob);
+        virtual IRandom::pointer substream(uint64_t key);
+
+      private:
+        std::vector<unsigned int> m_seeds;
+        uint64_t m_stream;
+        double m_normal_threshold{100};
+        Philox m_engine;
+
+        // Second value of the last Box-Muller pair, if any.
+        double m_spare{0};
+        bool m_have_spare{false};
+
+        double unit_normal();
+    };
+
+}  // namespace WireCell::Gen
+
+#endif
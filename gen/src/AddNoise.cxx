@@ -8,6 +8,7 @@
 #include "WireCellAux/FrameTools.h"
 
 
+#include <deque>
 #include <unordered_map>
 
 WIRECELL_FACTORY(IncoherentAddNoise, WireCell::Gen::IncoherentAddNoise,
@@ -28,6 +29,8 @@ using WireCell::Aux::SimpleFrame;
 using namespace WireCell::Aux::RandTools;
 using namespace WireCell::Aux::NoiseTools;
 
+static const float sqrt2opi = sqrt(2.0/3.141592);
+
 Gen::IncoherentAddNoise::IncoherentAddNoise()
     : Gen::NoiseBaseT<IChannelSpectrum>("IncoherentAddNoise")
 {
@@ -58,61 +61,64 @@ bool Gen::IncoherentAddNoise::operator()(const input_pointer& inframe, output_po
     auto rn = Normals::make_recycling(m_rng, 2*m_nsamples, BUG, 1, 2*m_rep_percent);
     GeneratorN rwgen(m_dft, rn);
 
-    // Limit number of warnings below
-    static bool warned = false;
-    static bool warned2 = false;
+    ITrace::vector outtraces;
+    if (m_batch) {
+        outtraces = add_batched(*inframe->traces(), rwgen);
+    }
+    else {
+        // Limit number of warnings below
+        static bool warned = false;
+        static bool warned2 = false;
 
-    // Make waveforms of size nsample from each model, adding only
-    // ncharge of their element to the trace charge.  This
-    // full-nsample followed by ncharge-truncation may CPU-wasteful in
-    // the sparse traces case.
+        // Make waveforms of size nsample from each model, adding only
+        // ncharge of their element to the trace charge.  This
+        // full-nsample followed by ncharge-truncation may CPU-wasteful in
+        // the sparse traces case.
 
-    const float sqrt2opi = sqrt(2.0/3.141592);
+        for (const auto& intrace : *inframe->traces()) {
 
-    ITrace::vector outtraces;
-    for (const auto& intrace : *inframe->traces()) {
+            const int chid = intrace->channel();
+            auto charge = intrace->charge(); // copies
+            const size_t ncharge = charge.size();
 
-        const int chid = intrace->channel();
-        auto charge = intrace->charge(); // copies
-        const size_t ncharge = charge.size();
+            for (auto& [mtn, model] : m_models) {
+                const auto& spec = model->channel_spectrum(chid);
+                const size_t nspec = spec.size();
 
-        for (auto& [mtn, model] : m_models) {
-            const auto& spec = model->channel_spectrum(chid);
-            const size_t nspec = spec.size();
+                if (! nspec) {
+                    continue;       // channel not in model
+                }
 
-            if (! nspec) {
-                continue;       // channel not in model
-            }
+                // The model spec size may differ than expected nsamples.
+                // We could interpolate to correct for that which would
+                // slow things down.  Better to correct the model(s) code
+                // and configuration.
+                if (not warned and nspec != m_nsamples) {
+                    log->warn("model {} produced {} samples instead of expected {}, future warnings muted",
+                              mtn, nspec, m_nsamples);
+                    warned = true;
+                }
 
-            // The model spec size may differ than expected nsamples.
-            // We could interpolate to correct for that which would
-            // slow things down.  Better to correct the model(s) code
-            // and configuration.
-            if (not warned and nspec != m_nsamples) {
-                log->warn("model {} produced {} samples instead of expected {}, future warnings muted",
-                          mtn, nspec, m_nsamples);
-                warned = true;
-            }
+                const size_t nsigmas = nspec;
+                // const nsigmas = m_nsamples;
+                real_vector_t sigmas(nsigmas);
+                for (size_t ind=0; ind < nsigmas; ++ind) {
+                    sigmas[ind] = spec[ind]*sqrt2opi;
+                }
 
-            const size_t nsigmas = nspec;
-            // const nsigmas = m_nsamples;
-            real_vector_t sigmas(nsigmas);
-            for (size_t ind=0; ind < nsigmas; ++ind) {
-                sigmas[ind] = spec[ind]*sqrt2opi;
-            }
+                auto wave = rwgen.wave(sigmas);
+                if (not warned2 and wave.size() < ncharge) {
+                    log->warn("undersized noise {} for input waveform {}, future warnings muted", wave.size(), ncharge);
+                    warned2 = true;
+                }
+                wave.resize(ncharge);
+                Waveform::increase(charge, wave);
 
-            auto wave = rwgen.wave(sigmas);
-            if (not warned2 and wave.size() < ncharge) {
-                log->warn("undersized noise {} for input waveform {}, future warnings muted", wave.size(), ncharge);
-                warned2 = true;
             }
-            wave.resize(ncharge);
-            Waveform::increase(charge, wave);
 
+            auto trace = make_shared<SimpleTrace>(chid, intrace->tbin(), charge);
+            outtraces.push_back(trace);
         }
-
-        auto trace = make_shared<SimpleTrace>(chid, intrace->tbin(), charge);
-        outtraces.push_back(trace);
     }
     outframe = make_shared<SimpleFrame>(inframe->ident(), inframe->time(), outtraces, inframe->tick());
     log->debug("call={} frame={} {} traces",
@@ -142,68 +148,246 @@ bool Gen::CoherentAddNoise::operator()(const input_pointer& inframe, output_poin
     auto rn = Normals::make_recycling(m_rng, 2*m_nsamples, BUG, 1, 2*m_rep_percent);
     GeneratorN rwgen(m_dft, rn);
 
-    // Look up the generated wave for a group.
-    using group_wave_lu = std::unordered_map<int, real_vector_t>;
-    // Models may not be coherent across their groups so we have a LU
-    // per model.
-    std::unordered_map<std::string, group_wave_lu> model_group_waves;
+    ITrace::vector outtraces;
+    if (m_batch) {
+        outtraces = add_batched(*inframe->traces(), rwgen);
+    }
+    else {
+        // Look up the generated wave for a group.
+        using group_wave_lu = std::unordered_map<int, real_vector_t>;
+        // Models may not be coherent across their groups so we have a LU
+        // per model.
+        std::unordered_map<std::string, group_wave_lu> model_group_waves;
+
+        // Limit number of warnings below
+        static bool warned = false;
+
+        // Make waveforms of size nsample from each model, adding only
+        // ncharge of their element to the trace charge.  This
+        // full-nsample followed by ncharge-truncation may CPU-wasteful in
+        // the sparse traces case.
+
+        for (const auto& intrace : *inframe->traces()) {
+
+            const int chid = intrace->channel();
+            auto charge = intrace->charge(); // copies
+            const size_t ncharge = charge.size();
+
+            for (auto& [mtn, model] : m_models) {
+                auto& gwlu = model_group_waves[mtn];
+                int grpid = model->groupid(chid);
+                if (gwlu.find(grpid) == gwlu.end()) {
+                    const auto& spec = model->group_spectrum(grpid);
+                
+                    if (spec.empty()) {
+                        continue;       // channel not in model
+                    }
+
+                    // The model spec size may differ than expected nsamples.
+                    // We could interpolate to correct for that which would
+                    // slow things down.  Better to correct the model(s) code
+                    // and configuration.
+                    if (not warned and spec.size() != m_nsamples) {
+                        log->warn("model {} produced {} samples instead of expected {}, future warnings muted",
+                                  mtn, spec.size(), m_nsamples);
+                        warned = true;
+                    }
+                    real_vector_t sigmas(m_nsamples);
+                    for (size_t ind=0; ind<m_nsamples; ++ind) {
+                        sigmas[ind] = spec[ind]*sqrt2opi;
+                    }
+                    auto wave = rwgen.wave(sigmas);
+                    wave.resize(ncharge);
+                    gwlu[grpid] = wave;
+                }
+                Waveform::increase(charge, gwlu[grpid]);
+            }
+
+            auto trace = make_shared<SimpleTrace>(chid, intrace->tbin(), charge);
+            outtraces.push_back(trace);
+        }
+    }
+    outframe = make_shared<SimpleFrame>(inframe->ident(), inframe->time(), outtraces, inframe->tick());
+
+    log->debug("input : {}", Aux::taginfo(inframe));
+    log->debug("output: {}", Aux::taginfo(outframe));
+
+    ++m_count;
+    return true;
+}
+
+
+
+static real_vector_t sigmas(const IChannelSpectrum::amplitude_t& spec)
+{
+    real_vector_t ret(spec.size());
+    for (size_t ind=0; ind < ret.size(); ++ind) {
+        ret[ind] = spec[ind]*sqrt2opi;
+    }
+    return ret;
+}
+
+// The batched versions follow the unbatched loops above but defer the
+// inverse DFTs.  Randoms are drawn in the same order.
 
-    // Limit number of warnings below
+ITrace::vector Gen::IncoherentAddNoise::add_batched(const ITrace::vector& intraces,
+                                                    Generator& gen)
+{
     static bool warned = false;
+    static bool warned2 = false;
+
+    const size_t ntraces = intraces.size();
+    std::vector<ITrace::ChargeSequence> charges(ntraces);
 
-    const float sqrt2opi = sqrt(2.0/3.141592);
+    // Pending rows of one batch and which trace each adds to.
+    std::deque<real_vector_t> scratch;
+    std::vector<const real_vector_t*> rows;
+    std::vector<size_t> row_traces;
 
-    // Make waveforms of size nsample from each model, adding only
-    // ncharge of their element to the trace charge.  This
-    // full-nsample followed by ncharge-truncation may CPU-wasteful in
-    // the sparse traces case.
+    auto add_wave = [&](const float* wave, size_t nwave, size_t itrace) {
+        auto& charge = charges[itrace];
+        if (not warned2 and nwave < charge.size()) {
+            log->warn("undersized noise {} for input waveform {}, future warnings muted", nwave, charge.size());
+            warned2 = true;
+        }
+        const size_t n = std::min(nwave, charge.size());
+        for (size_t ind=0; ind<n; ++ind) {
+            charge[ind] += wave[ind];
+        }
+    };
+    auto flush = [&]() {
+        if (rows.empty()) {
+            return;
+        }
+        const size_t nsamples = rows[0]->size();
+        auto waves = gen.waves(rows);
+        for (size_t irow=0; irow<rows.size(); ++irow) {
+            add_wave(waves.data() + irow*nsamples, nsamples, row_traces[irow]);
+        }
+        rows.clear();
+        row_traces.clear();
+        scratch.clear();
+    };
+
+    for (size_t itrace=0; itrace<ntraces; ++itrace) {
+        const auto& intrace = intraces[itrace];
+        const int chid = intrace->channel();
+        charges[itrace] = intrace->charge(); // copies
+
+        for (auto& [mtn, model] : m_models) {
+            const auto& spec = model->channel_spectrum(chid);
+            const size_t nspec = spec.size();
+
+            if (! nspec) {
+                continue;       // channel not in model
+            }
+            if (not warned and nspec != m_nsamples) {
+                log->warn("model {} produced {} samples instead of expected {}, future warnings muted",
+                          mtn, nspec, m_nsamples);
+                warned = true;
+            }
+
+            if (nspec != m_nsamples) {
+                // Keep order of randoms: finish pending then do this one.
+                flush();
+                auto wave = gen.wave(sigmas(spec));
+                add_wave(wave.data(), wave.size(), itrace);
+                continue;
+            }
+            // Deque elements stay put as more are added.
+            scratch.push_back(sigmas(spec));
+            rows.push_back(&scratch.back());
+            row_traces.push_back(itrace);
+            if (rows.size() == m_batch) {
+                flush();
+            }
+        }
+    }
+    flush();
 
     ITrace::vector outtraces;
-    for (const auto& intrace : *inframe->traces()) {
+    outtraces.reserve(ntraces);
+    for (size_t itrace=0; itrace<ntraces; ++itrace) {
+        const auto& intrace = intraces[itrace];
+        outtraces.push_back(make_shared<SimpleTrace>(intrace->channel(), intrace->tbin(), charges[itrace]));
+    }
+    return outtraces;
+}
+
+ITrace::vector Gen::CoherentAddNoise::add_batched(const ITrace::vector& intraces,
+                                                  Generator& gen)
+{
+    static bool warned = false;
 
+    // A group wave is made on the first trace of the group and
+    // truncated to that trace's size.
+    struct GroupWave {
+        real_vector_t sigmas;
+        size_t ncharge{0};
+        real_vector_t wave;
+    };
+    std::unordered_map<std::string, std::unordered_map<int, size_t>> model_group_index;
+    std::vector<GroupWave> gws;
+
+    // The group waves to add to each trace.
+    std::vector<std::vector<size_t>> trace_gws(intraces.size());
+
+    for (size_t itrace=0; itrace<intraces.size(); ++itrace) {
+        const auto& intrace = intraces[itrace];
         const int chid = intrace->channel();
-        auto charge = intrace->charge(); // copies
-        const size_t ncharge = charge.size();
 
         for (auto& [mtn, model] : m_models) {
-            auto& gwlu = model_group_waves[mtn];
+            auto& gi = model_group_index[mtn];
             int grpid = model->groupid(chid);
-            if (gwlu.find(grpid) == gwlu.end()) {
+            auto it = gi.find(grpid);
+            if (it == gi.end()) {
                 const auto& spec = model->group_spectrum(grpid);
-                
                 if (spec.empty()) {
                     continue;       // channel not in model
                 }
-
-                // The model spec size may differ than expected nsamples.
-                // We could interpolate to correct for that which would
-                // slow things down.  Better to correct the model(s) code
-                // and configuration.
                 if (not warned and spec.size() != m_nsamples) {
                     log->warn("model {} produced {} samples instead of expected {}, future warnings muted",
                               mtn, spec.size(), m_nsamples);
                     warned = true;
                 }
-                real_vector_t sigmas(m_nsamples);
+                GroupWave gw;
+                gw.sigmas.resize(m_nsamples);
                 for (size_t ind=0; ind<m_nsamples; ++ind) {
-                    sigmas[ind] = spec[ind]*sqrt2opi;
+                    gw.sigmas[ind] = spec[ind]*sqrt2opi;
                 }
-                auto wave = rwgen.wave(sigmas);
-                wave.resize(ncharge);
-                gwlu[grpid] = wave;
+                gw.ncharge = intrace->charge().size();
+                it = gi.emplace(grpid, gws.size()).first;
+                gws.push_back(std::move(gw));
             }
-            Waveform::increase(charge, gwlu[grpid]);
+            trace_gws[itrace].push_back(it->second);
         }
-
-        auto trace = make_shared<SimpleTrace>(chid, intrace->tbin(), charge);
-        outtraces.push_back(trace);
     }
-    outframe = make_shared<SimpleFrame>(inframe->ident(), inframe->time(), outtraces, inframe->tick());
 
-    log->debug("input : {}", Aux::taginfo(inframe));
-    log->debug("output: {}", Aux::taginfo(outframe));
+    // Group waves in first-seen order and in batches.
+    for (size_t beg=0; beg<gws.size(); beg += m_batch) {
+        const size_t end = std::min(gws.size(), beg + m_batch);
+        std::vector<const real_vector_t*> rows;
+        for (size_t ind=beg; ind<end; ++ind) {
+            rows.push_back(&gws[ind].sigmas);
+        }
+        auto waves = gen.waves(rows);
+        for (size_t ind=beg; ind<end; ++ind) {
+            auto& gw = gws[ind];
+            auto wbeg = waves.begin() + (ind-beg)*m_nsamples;
+            gw.wave.assign(wbeg, wbeg + m_nsamples);
+            gw.wave.resize(gw.ncharge);
+        }
+    }
 
-    ++m_count;
-    return true;
+    ITrace::vector outtraces;
+    outtraces.reserve(intraces.size());
+    for (size_t itrace=0; itrace<intraces.size(); ++itrace) {
+        const auto& intrace = intraces[itrace];
+        auto charge = intrace->charge(); // copies
+        for (size_t igw : trace_gws[itrace]) {
+            Waveform::increase(charge, gws[igw].wave);
+        }
+        outtraces.push_back(make_shared<SimpleTrace>(intrace->channel(), intrace->tbin(), charge));
+    }
+    return outtraces;
 }
-
@@ -1,6 +1,8 @@
 #include "WireCellGen/DepoSetDrifter.h"
+#include "WireCellGen/Drifter.h"
 #include "WireCellUtil/NamedFactory.h"
 #include "WireCellAux/SimpleDepoSet.h"
+#include "WireCellAux/ColumnarDepoSet.h"
 
 WIRECELL_FACTORY(DepoSetDrifter, WireCell::Gen::DepoSetDrifter,
                  WireCell::INamed,
@@ -23,6 +25,9 @@ WireCell::Configuration DepoSetDrifter::default_configuration() const
     Configuration cfg;
     // The typename of the drifter to do the real work.
     cfg["drifter"] = "Drifter";
+    // If true, drift each set as a block.  The drifter must then be
+    // a Drifter.
+    cfg["columnar"] = false;
     return cfg;
 }
 
@@ -30,6 +35,13 @@ void DepoSetDrifter::configure(const WireCell::Configuration& cfg)
 {
     auto name = get<std::string>(cfg, "drifter", "Drifter");
     m_drifter = Factory::find_tn<IDrifter>(name);
+    m_columnar = nullptr;
+    if (get<bool>(cfg, "columnar", false)) {
+        m_columnar = std::dynamic_pointer_cast<Drifter>(m_drifter);
+        if (!m_columnar) {
+            THROW(ValueError() << errmsg{"DepoSetDrifter: columnar drifting requires a Drifter, got " + name});
+        }
+    }
 }
 
 bool DepoSetDrifter::operator()(const input_pointer& in, output_pointer& out)
@@ -40,6 +52,28 @@ bool DepoSetDrifter::operator()(const input_pointer& in, output_pointer& out)
         return true;
     }
 
+    if (m_columnar) {
+        out = m_columnar->drift(in, m_count);
+        const auto& cols = std::dynamic_pointer_cast<const Aux::ColumnarDepoSet>(out)->columns();
+        double charge_in = 0, charge_out = 0;
+        if (auto cin = std::dynamic_pointer_cast<const Aux::ColumnarDepoSet>(in)) {
+            for (double q : cin->columns().charge) {
+                charge_in += q;
+            }
+        }
+        else {
+            for (const auto& depo : *in->depos()) {
+                charge_in += depo->charge();
+            }
+        }
+        for (double q : cols.charge) {
+            charge_out += q;
+        }
+        log->debug("call={} drifted ndepos={} Qout={} ({}%)", m_count, cols.size(), charge_out, 100.0*charge_out/charge_in);
+        ++m_count;
+        return true;
+    }
+
     // make a copy so we can append an EOS to flush the per depo
     // drifter.
     IDepo::vector in_depos(in->depos()->begin(), in->depos()->end());
@@ -40,6 +40,7 @@
 #include "WireCellGen/DepoTransform.h"
 #include "WireCellGen/ImpactTransform.h"
 #include "WireCellGen/BinnedDiffusion_transform.h"
+#include "WireCellGen/Random.h"
 
 #include "WireCellAux/SimpleTrace.h"
 #include "WireCellAux/SimpleFrame.h"
@@ -51,8 +52,10 @@
 #include "WireCellUtil/Units.h"
 #include "WireCellUtil/Point.h"
 #include "WireCellUtil/NamedFactory.h"
+#include "WireCellUtil/Parallel.h"
 
 #include <algorithm>
+#include <limits>
 #include <vector>
 
 WIRECELL_FACTORY(DepoTransform, WireCell::Gen::DepoTransform, WireCell::IDepoFramer, WireCell::IConfigurable)
@@ -96,6 +99,13 @@ void Gen::DepoTransform::configure(const WireCell::Configuration& cfg)
     m_drift_speed = get<double>(cfg, "drift_speed", m_drift_speed);
     m_frame_count = get<int>(cfg, "first_frame_number", m_frame_count);
 
+    m_nthreads = get<int>(cfg, "nthreads", m_nthreads);
+    if (m_nthreads < 0) {
+        std::string msg = "nthreads must not be negative";
+        log->error(msg);
+        THROW(ValueError() << errmsg{"Gen::DepoTransform: " + msg});
+    }
+
     m_process_planes = {0,1,2};
 
     if (cfg["process_planes"].isArray()) {
@@ -160,6 +170,16 @@ WireCell::Configuration Gen::DepoTransform::default_configuration() const
     // type-name for the DFT to use
     cfg["dft"] = "FftwDFT";
 
+    /// If zero, process faces and planes serially in the calling
+    /// thread.  Otherwise, process each (face, plane) as a job run on
+    /// up to this many threads.  In this mode, if "fluctuate" is true
+    /// then each job is given its own random stream seeded in a fixed
+    /// order from "rng" so that the output does not depend on the
+    /// thread count (though it differs from that of the zero mode).
+    /// A value of one runs these jobs serially in the calling thread.
+    /// Note, modify_depo() is then called from multiple threads.
+    cfg["nthreads"] = m_nthreads;
+
     // Need to REMOVE this otherwise [] will be the default
     // NOTE: People doing similar things should be aware of this!!!
     // Ref: https://github.com/LArSoft/larwirecell/pull/55
@@ -168,6 +188,46 @@ WireCell::Configuration Gen::DepoTransform::default_configuration() const
     return cfg;
 }
 
+ITrace::vector Gen::DepoTransform::plane_traces(IWirePlane::pointer plane, int iplane,
+                                               const IDepo::vector& face_depos,
+                                               IRandom::pointer rng)
+{
+    ITrace::vector traces;
+
+    const Pimpos* pimpos = plane->pimpos();
+
+    Binning tbins(m_readout_time / m_tick, m_start_time, m_start_time + m_readout_time);
+
+    Gen::BinnedDiffusion_transform bindiff(*pimpos, tbins, m_nsigma, rng);
+    for (auto depo : face_depos) {
+        depo = modify_depo(plane->planeid(), depo);
+        bindiff.add(depo, depo->extent_long() / m_drift_speed, depo->extent_tran());
+    }
+
+    auto& wires = plane->wires();
+
+    auto pir = m_pirs.at(iplane);
+    Gen::ImpactTransform transform(pir, m_dft, bindiff);
+
+    const int nwires = pimpos->region_binning().nbins();
+    for (int iwire = 0; iwire < nwires; ++iwire) {
+        auto wave = transform.waveform(iwire);
+
+        auto mm = Waveform::edge(wave);
+        if (mm.first == (int) wave.size()) {  // all zero
+            continue;
+        }
+
+        int chid = wires[iwire]->channel();
+        int tbin = mm.first;
+
+        ITrace::ChargeSequence charge(wave.begin() + mm.first, wave.begin() + mm.second);
+        auto trace = make_shared<SimpleTrace>(chid, tbin, charge);
+        traces.push_back(trace);
+    }
+    return traces;
+}
+
 bool Gen::DepoTransform::operator()(const input_pointer& in, output_pointer& out)
 {
     if (!in) {
@@ -180,11 +240,21 @@ bool Gen::DepoTransform::operator()(const input_pointer& in, output_pointer& out
     auto depos = in->depos();
     size_t ndepos_used=0;
 
-    Binning tbins(m_readout_time / m_tick, m_start_time, m_start_time + m_readout_time);
-    ITrace::vector traces;
+    // One job per (face, plane) in order.
+    struct Job {
+        IAnodeFace::pointer face;
+        IWirePlane::pointer plane;
+        int iplane;
+        const IDepo::vector* depos;
+        ITrace::vector traces;
+    };
+    std::vector<IDepo::vector> faces_depos;
+    faces_depos.reserve(m_anode->faces().size());
+    std::vector<Job> jobs;
     for (auto face : m_anode->faces()) {
         // Select the depos which are in this face's sensitive volume
-        IDepo::vector face_depos = Aux::sensitive(*depos, face);
+        faces_depos.push_back(Aux::sensitive(*depos, face));
+        const auto& face_depos = faces_depos.back();
         ndepos_used += face_depos.size();
 
         int iplane = -1;
@@ -197,42 +267,40 @@ bool Gen::DepoTransform::operator()(const input_pointer& in, output_pointer& out
           log->debug("skip plane {}", plane_index);         
 	      continue;
 	    }
+            jobs.push_back(Job{face, plane, iplane, &face_depos, {}});
+        }
+    }
 
-            const Pimpos* pimpos = plane->pimpos();
-
-            Binning tbins(m_readout_time / m_tick, m_start_time, m_start_time + m_readout_time);
-
-            Gen::BinnedDiffusion_transform bindiff(*pimpos, tbins, m_nsigma, m_rng);
-            for (auto depo : face_depos) {
-                depo = modify_depo(plane->planeid(), depo);
-                bindiff.add(depo, depo->extent_long() / m_drift_speed, depo->extent_tran());
-            }
-
-            auto& wires = plane->wires();
-
-            auto pir = m_pirs.at(iplane);
-            Gen::ImpactTransform transform(pir, m_dft, bindiff);
-
-            const int nwires = pimpos->region_binning().nbins();
-            for (int iwire = 0; iwire < nwires; ++iwire) {
-                auto wave = transform.waveform(iwire);
-
-                auto mm = Waveform::edge(wave);
-                if (mm.first == (int) wave.size()) {  // all zero
-                    continue;
-                }
-
-                int chid = wires[iwire]->channel();
-                int tbin = mm.first;
-
-                ITrace::ChargeSequence charge(wave.begin() + mm.first, wave.begin() + mm.second);
-                auto trace = make_shared<SimpleTrace>(chid, tbin, charge);
-                traces.push_back(trace);
+    if (m_nthreads == 0) {
+        for (auto& job : jobs) {
+            job.traces = plane_traces(job.plane, job.iplane, *job.depos, m_rng);
+        }
+    }
+    else {
+        // Seeds are drawn in job order so the streams do not depend
+        // on which thread runs which job.
+        std::vector<IRandom::pointer> rngs(jobs.size());
+        if (m_rng) {
+            for (auto& rng : rngs) {
+                const unsigned int seed = m_rng->range(0, std::numeric_limits<int>::max());
+                auto prng = std::make_shared<Gen::Random>("twister", std::vector<unsigned int>{seed});
+                prng->configure(prng->default_configuration());
+                rng = prng;
             }
-            // fixme: use SPDLOG_LOGGER_DEBUG
-            log->debug("plane={} face={} depos={} total traces={}",
-                       iplane, face->ident(), face_depos.size(), traces.size());
         }
+        Parallel::for_each(jobs.size(), [&](size_t ind) {
+            auto& job = jobs[ind];
+            job.traces = plane_traces(job.plane, job.iplane, *job.depos, rngs[ind]);
+        }, m_nthreads);
+    }
+
+    // Merge in job order.
+    ITrace::vector traces;
+    for (auto& job : jobs) {
+        traces.insert(traces.end(), job.traces.begin(), job.traces.end());
+        // fixme: use SPDLOG_LOGGER_DEBUG
+        log->debug("plane={} face={} depos={} total traces={}",
+                   job.iplane, job.face->ident(), job.depos->size(), traces.size());
     }
 
     auto frame = make_shared<SimpleFrame>(m_frame_count, m_start_time, traces, m_tick);
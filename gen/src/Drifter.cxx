@@ -8,9 +8,11 @@
 #include "WireCellIface/IAnodeFace.h"
 #include "WireCellIface/IWirePlane.h"
 #include "WireCellAux/SimpleDepo.h"
+#include "WireCellAux/ColumnarDepoSet.h"
 
 #include <boost/range.hpp>
 
+#include <numeric>
 #include <sstream>
 
 WIRECELL_FACTORY(Drifter, WireCell::Gen::Drifter,
@@ -185,6 +187,118 @@ bool Gen::Drifter::insert(const input_pointer& depo)
     return true;
 }
 
+IDepoSet::pointer Gen::Drifter::drift(const IDepoSet::pointer& in, int ident)
+{
+    using Columns = Aux::ColumnarDepoSet::Columns;
+
+    Columns converted;
+    const Columns* cols = &converted;
+    if (auto cds = std::dynamic_pointer_cast<const Aux::ColumnarDepoSet>(in)) {
+        cols = &cds->columns();
+    }
+    else {
+        converted = Columns(*in->depos());
+    }
+    const size_t ndepos = cols->size();
+
+    // Select the region of each depo as in insert().  Bounds may be
+    // arbitrary surfaces so this is necessarily done depo by depo.
+    std::vector<size_t> rows;
+    std::vector<double> respx;
+    std::vector<char> inbulk;
+    rows.reserve(ndepos);
+    respx.reserve(ndepos);
+    inbulk.reserve(ndepos);
+    for (size_t ind = 0; ind < ndepos; ++ind) {
+        if (cols->charge[ind] == 0.0) {
+            continue;
+        }
+        const Point pos(cols->x[ind], cols->y[ind], cols->z[ind]);
+        auto xrit = std::find_if(m_xregions.begin(), m_xregions.end(),
+                                 [&](const Xregion& xr) { return xr.near.inside(pos); });
+        bool bulk = false;
+        if (xrit == m_xregions.end()) {
+            xrit = std::find_if(m_xregions.begin(), m_xregions.end(),
+                                [&](const Xregion& xr) { return xr.bulk.inside(pos); });
+            bulk = true;
+        }
+        if (xrit == m_xregions.end()) {
+            continue;
+        }
+        rows.push_back(ind);
+        respx.push_back(xrit->response->location());
+        inbulk.push_back(bulk);
+    }
+    Columns out = cols->take(rows);
+    const size_t nout = rows.size();
+
+    // The remaining transport is done column by column in loops
+    // simple enough for the compiler to vectorize.
+    std::vector<double> dt(nout), absorbprob(nout);
+    for (size_t ind = 0; ind < nout; ++ind) {
+        dt[ind] = std::abs((respx[ind] - out.x[ind]) / m_speed);
+    }
+    for (size_t ind = 0; ind < nout; ++ind) {
+        absorbprob[ind] = 1 - std::exp(-dt[ind] / m_lifetime);
+    }
+    for (size_t ind = 0; ind < nout; ++ind) {
+        const double direction = inbulk[ind] ? 1.0 : -1.0;
+        out.time[ind] += direction * dt[ind] + m_toffset;
+        out.x[ind] = respx[ind];
+    }
+    for (size_t ind = 0; ind < nout; ++ind) {
+        const double dL = out.extent_long[ind], dT = out.extent_tran[ind];
+        out.extent_long[ind] = inbulk[ind] ? std::sqrt(2.0 * m_DL * dt[ind] + dL * dL) : dL;
+        out.extent_tran[ind] = inbulk[ind] ? std::sqrt(2.0 * m_DT * dt[ind] + dT * dT) : dT;
+    }
+
+    // Absorption.  Fluctuations draw in input order, same as insert().
+    if (m_fluctuate) {
+        std::vector<size_t> bulk;
+        std::vector<int> nelec;
+        std::vector<double> prob;
+        for (size_t ind = 0; ind < nout; ++ind) {
+            if (inbulk[ind]) {
+                bulk.push_back(ind);
+                nelec.push_back((int) std::abs(out.charge[ind]));
+                prob.push_back(absorbprob[ind]);
+            }
+        }
+        std::vector<int> nabsorbed(bulk.size());
+        m_rng->fill_binomial(nabsorbed.data(), bulk.size(), nelec.data(), prob.data());
+        for (size_t ib = 0; ib < bulk.size(); ++ib) {
+            const size_t ind = bulk[ib];
+            const double Qi = out.charge[ind];
+            const double sign = Qi < 0 ? -1.0 : 1.0;
+            out.charge[ind] = Qi - sign * nabsorbed[ib];
+        }
+    }
+    else {
+        for (size_t ind = 0; ind < nout; ++ind) {
+            const double Qi = out.charge[ind];
+            out.charge[ind] = inbulk[ind] ? Qi - Qi * absorbprob[ind] : Qi;
+        }
+    }
+    for (size_t ind = 0; ind < nout; ++ind) {
+        out.charge[ind] *= m_scale_factor;
+    }
+
+    // As with insert(), the drifted depo keeps only the id and
+    // refers to the original as its prior.  The input is held so
+    // that its depos are made only if those of the output are.
+    IDepo::vector().swap(out.prior);
+    out.prior_row = rows;
+    std::fill(out.pdg.begin(), out.pdg.end(), 0);
+    std::fill(out.energy.begin(), out.energy.end(), 1.0);
+
+    std::vector<size_t> order(nout);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return out.time[a] < out.time[b]; });
+
+    return std::make_shared<Aux::ColumnarDepoSet>(ident, out.take(order), in);
+}
+
 bool by_time(const IDepo::pointer& lhs, const IDepo::pointer& rhs) { return lhs->time() < rhs->time(); }
 
 // save all cached depos to the output queue sorted in time order
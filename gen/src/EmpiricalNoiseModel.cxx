@@ -3,6 +3,7 @@
 
 #include "WireCellUtil/Configuration.h"
 #include "WireCellUtil/Persist.h"
+#include "WireCellUtil/BinaryCache.h"
 #include "WireCellUtil/Exceptions.h"
 #include "WireCellUtil/Response.h"  // fixme: should remove direct dependency
 #include "WireCellUtil/Waveform.h"
@@ -29,6 +30,91 @@ static int fft_length(int nsamples)
     // return nsamples;
 }
 
+using NoiseSpectrum = Gen::EmpiricalNoiseModel::NoiseSpectrum;
+
+static std::vector<NoiseSpectrum> spectra_from_json(const Json::Value& jspectra)
+{
+    std::vector<NoiseSpectrum> spectra;
+    for (const auto& jentry : jspectra) {
+        NoiseSpectrum ns;
+
+        // optional for this model
+
+        ns.plane = jentry["plane"].asInt();
+        ns.gain = jentry["gain"].asFloat();        // *m_gres;
+        ns.shaping = jentry["shaping"].asFloat();  // * m_tres;
+        ns.wirelen = jentry["wirelen"].asFloat();  // * m_wlres;
+        ns.constant = get(jentry, "const", 0.0);
+
+        // required from all WCT noise spectra
+
+        ns.nsamples = jentry["nsamples"].asInt();
+        ns.period = jentry["period"].asFloat();    // * m_tres;
+
+        auto jfreqs = jentry["freqs"];
+        const int nfreqs = jfreqs.size();
+        ns.freqs.resize(nfreqs, 0.0);
+        for (int ind = 0; ind < nfreqs; ++ind) {
+            ns.freqs[ind] = jfreqs[ind].asFloat();  // * m_fres;
+        }
+        auto jamps = jentry["amps"];
+        const int namps = jamps.size();
+        ns.amps.resize(namps, 0.0);
+        for (int ind = 0; ind < namps; ++ind) {
+            ns.amps[ind] = jamps[ind].asFloat();
+        }
+        spectra.push_back(ns);
+    }
+    return spectra;
+}
+
+// The spectra as flat arrays for the binary cache.
+static BinaryCache::Arrays spectra_to_arrays(const std::vector<NoiseSpectrum>& spectra)
+{
+    BinaryCache::Arrays arrays;
+    auto& ids = arrays.ints["ids"];
+    auto& params = arrays.reals["params"];
+    auto& freq_offsets = arrays.ints["freq_offsets"];
+    auto& freqs = arrays.reals["freqs"];
+    auto& amp_offsets = arrays.ints["amp_offsets"];
+    auto& amps = arrays.reals["amps"];
+    freq_offsets.push_back(0);
+    amp_offsets.push_back(0);
+    for (const auto& ns : spectra) {
+        ids.insert(ids.end(), {ns.plane, ns.nsamples});
+        params.insert(params.end(), {ns.period, ns.gain, ns.shaping, ns.wirelen, ns.constant});
+        freqs.insert(freqs.end(), ns.freqs.begin(), ns.freqs.end());
+        freq_offsets.push_back(freqs.size());
+        amps.insert(amps.end(), ns.amps.begin(), ns.amps.end());
+        amp_offsets.push_back(amps.size());
+    }
+    return arrays;
+}
+
+static std::vector<NoiseSpectrum> spectra_from_arrays(const BinaryCache::Arrays& arrays)
+{
+    const auto& ids = arrays.integer("ids");
+    const auto& params = arrays.real("params");
+    const auto& freq_offsets = arrays.integer("freq_offsets");
+    const auto& freqs = arrays.real("freqs");
+    const auto& amp_offsets = arrays.integer("amp_offsets");
+    const auto& amps = arrays.real("amps");
+    const size_t nspectra = ids.size() / 2;
+    std::vector<NoiseSpectrum> spectra(nspectra);
+    for (size_t ind = 0; ind < nspectra; ++ind) {
+        auto& ns = spectra[ind];
+        ns.plane = ids[2 * ind];
+        ns.nsamples = ids[2 * ind + 1];
+        ns.period = params[5 * ind];
+        ns.gain = params[5 * ind + 1];
+        ns.shaping = params[5 * ind + 2];
+        ns.wirelen = params[5 * ind + 3];
+        ns.constant = params[5 * ind + 4];
+        ns.freqs.assign(freqs.begin() + freq_offsets[ind], freqs.begin() + freq_offsets[ind + 1]);
+        ns.amps.assign(amps.begin() + amp_offsets[ind], amps.begin() + amp_offsets[ind + 1]);
+    }
+    return spectra;
+}
 
 Gen::EmpiricalNoiseModel::EmpiricalNoiseModel(const std::string& spectra_file, const int nsamples, const double period,
                                               const double wire_length_scale,
@@ -168,9 +254,25 @@ void Gen::EmpiricalNoiseModel::configure(const WireCell::Configuration& cfg)
         log->critical("required configuration parameter \"spectra_file\" is empty");
         ++errors;
     }
+    std::vector<NoiseSpectrum> spectra;
+    std::string cpath;
     if (jspectra.isString()) {
         m_spectra_file = jspectra.asString();
-        jspectra = Persist::load(m_spectra_file);
+        cpath = BinaryCache::path(m_spectra_file, "noise");
+        BinaryCache::Arrays arrays;
+        if (BinaryCache::load(cpath, arrays)) {
+            spectra = spectra_from_arrays(arrays);
+            cpath = "";
+        }
+        else {
+            jspectra = Persist::load(m_spectra_file);
+        }
+    }
+    if (spectra.empty()) {
+        spectra = spectra_from_json(jspectra);
+        if (!cpath.empty() && !spectra.empty()) {
+            BinaryCache::save(cpath, spectra_to_arrays(spectra));
+        }
     }
 
     std::string dft_tn = get<std::string>(cfg, "dft", "FftwDFT");
@@ -190,35 +292,8 @@ void Gen::EmpiricalNoiseModel::configure(const WireCell::Configuration& cfg)
     // Load spectral data.  Fixme: should break out this code
     // separate.
     m_spectral_data.clear();
-    for (const auto& jentry : jspectra) {
-        NoiseSpectrum* nsptr = new NoiseSpectrum();
-
-        // optional for this model
-
-        nsptr->plane = jentry["plane"].asInt();
-        nsptr->gain = jentry["gain"].asFloat();        // *m_gres;
-        nsptr->shaping = jentry["shaping"].asFloat();  // * m_tres;
-        nsptr->wirelen = jentry["wirelen"].asFloat();  // * m_wlres;
-        nsptr->constant = get(jentry, "const", 0.0);
-
-        // required from all WCT noise spectra
-
-        nsptr->nsamples = jentry["nsamples"].asInt();
-        nsptr->period = jentry["period"].asFloat();    // * m_tres;
-
-        auto jfreqs = jentry["freqs"];
-        const int nfreqs = jfreqs.size();
-        nsptr->freqs.resize(nfreqs, 0.0);
-        for (int ind = 0; ind < nfreqs; ++ind) {
-            nsptr->freqs[ind] = jfreqs[ind].asFloat();  // * m_fres;
-        }
-        auto jamps = jentry["amps"];
-        const int namps = jamps.size();
-        nsptr->amps.resize(namps, 0.0);
-        for (int ind = 0; ind < namps; ++ind) {
-            nsptr->amps[ind] = jamps[ind].asFloat();
-        }
-
+    for (const auto& spectrum : spectra) {
+        NoiseSpectrum* nsptr = new NoiseSpectrum(spectrum);
         resample(*nsptr);
         m_spectral_data[nsptr->plane].push_back(nsptr);  // assumes ordered by wire length!
         // log->debug("nwanted={} plane={} ntold={} ngot={} ninput={}",
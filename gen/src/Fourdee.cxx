@@ -217,12 +217,12 @@ class NoiseAdderProc : public FilterProc {
             return false;
         }
 
-        const IFrame::pointer iframe = boost::any_cast<const IFrame::pointer>(iq.front());
+        const IFrame::pointer iframe = iq.front().as<IFrame::pointer>();
         iq.pop();
 
         if (!iframe) {  // eos
             std::cerr << "NoiseAdderProc eos\n";
-            boost::any out = iframe;
+            SharedAny out = iframe;
             oq.push(out);
             return true;
         }
@@ -231,7 +231,7 @@ class NoiseAdderProc : public FilterProc {
         bool ok = (*noise_node)(nframe);
         if (!ok) return false;
         nframe = Aux::sum(IFrame::vector{iframe, nframe}, iframe->ident());
-        boost::any anyout = nframe;
+        SharedAny anyout = nframe;
         oq.push(anyout);
         return true;
     }
@@ -1,6 +1,8 @@
 #include "WireCellGen/GaussianDiffusion.h"
 
+#include <cmath>
 #include <iostream>  // debugging
+#include <vector>
 
 using namespace WireCell;
 using namespace std;
@@ -181,36 +183,30 @@ void Gen::GaussianDiffusion::set_sampling(const Binning& tbin,  // overall time
     // normalize to total charge
     ret *= depo_charge / raw_sum;
 
-    double fluc_sum = 0;
     if (fluctuate) {
-
-        for (size_t ip = 0; ip < npss; ++ip) {
-            for (size_t it = 0; it < ntss; ++it) {
-                const double oldval = ret(ip, it);
-                // should be a multinomial distribution, n_i follows binomial distribution
-                // but n_i, n_j has covariance -n_tot * p_i * p_j
-                // normalize later to approximate this multinomial distribution (how precise?)
-                // how precise? better than poisson and 10000 total charge corresponds to a <1% level error.
-                double number = 0.0;
-                const double relval = oldval / depo_charge;
-                if (relval >= 1.0) {
-                    number = (int) std::abs(depo_charge);
-                }
-                else {
-                    number = fluctuate->binomial((int) std::abs(depo_charge), relval);
-                }
-                // the charge should be negative -- ionization electrons
-                number *= charge_sign;
-                fluc_sum += number;
-                ret(ip, it) = number;
-            }
+        // The electrons are distributed among the cells as one
+        // multinomial sample with the Gaussian integrals as
+        // probabilities.
+        const size_t ncells = ret.size();
+        const int nelectrons = (int) std::abs(depo_charge);
+        std::vector<double> prob(ncells);
+        for (size_t ind = 0; ind < ncells; ++ind) {
+            prob[ind] = std::abs(ret.data()[ind]);
+        }
+        std::vector<int> number(ncells);
+        fluctuate->fill_multinomial(number.data(), ncells, nelectrons, prob.data());
+
+        double fluc_sum = 0;
+        for (size_t ind = 0; ind < ncells; ++ind) {
+            // the charge should be negative -- ionization electrons
+            ret.data()[ind] = charge_sign * number[ind];
+            fluc_sum += ret.data()[ind];
         }
         if (fluc_sum == 0) {
             return;
         }
-        else {
-            ret *= m_deposition->charge() / fluc_sum;
-        }
+        // Keep the fractional electron, if any.
+        ret *= m_deposition->charge() / fluc_sum;
     }
 
     {  // debugging
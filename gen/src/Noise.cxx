@@ -38,6 +38,11 @@ WireCell::Configuration Gen::NoiseBase::default_configuration() const
     // interpreation of "percent" we apply twice this amount of
     // refreshing.  0.02 remains a reasonable choice.
     cfg["replacement_percentage"] = m_rep_percent;
+    // If nonzero, noise waveforms are made this many at a time with
+    // one batched inverse DFT instead of one DFT each.  Randoms are
+    // drawn in the same order either way.  Some hundreds is a good
+    // choice.  This applies to Add*Noise.
+    cfg["batch"] = (unsigned int)(m_batch);
     return cfg;
 }
 
@@ -72,6 +77,13 @@ void Gen::NoiseBase::configure(const WireCell::Configuration& cfg)
 
     m_nsamples = get<int>(cfg, "nsamples", m_nsamples);
     m_rep_percent = get<double>(cfg, "replacement_percentage", m_rep_percent);
+    const int batch = get<int>(cfg, "batch", m_batch);
+    if (batch < 0) {
+        std::string msg = "batch must not be negative";
+        log->error(msg);
+        THROW(ValueError() << errmsg{"Gen::NoiseBase: " + msg});
+    }
+    m_batch = batch;
     m_bug202 = get<double>(cfg, "bug202", 0.0);
     if (m_bug202>0) {
         log->warn("BUG 202 IS ACTIVATED: {}", m_bug202);
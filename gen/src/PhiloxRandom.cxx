@@ -0,0 +1,258 @@
+#include "WireCellGen/PhiloxRandom.h"
+
+#include "WireCellUtil/NamedFactory.h"
+#include "WireCellUtil/Math.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+WIRECELL_FACTORY(PhiloxRandom, WireCell::Gen::PhiloxRandom, WireCell::IRandom, WireCell::IConfigurable)
+
+using namespace WireCell;
+
+// Below this mean, binomial and Poisson are sampled by inversion from
+// a single uniform.  Above, the std distributions are driven by the
+// engine.
+static const double inversion_mean = 30.0;
+
+static uint64_t splitmix64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+static uint64_t make_key(const std::vector<unsigned int>& seeds)
+{
+    uint64_t key = 0;
+    for (auto seed : seeds) {
+        key = splitmix64(key ^ seed);
+    }
+    return key;
+}
+
+Gen::PhiloxRandom::PhiloxRandom(const std::vector<unsigned int> seeds, uint64_t stream)
+  : m_seeds(seeds)
+  , m_stream(stream)
+  , m_engine(make_key(seeds), stream)
+{
+}
+
+Gen::PhiloxRandom::~PhiloxRandom() {}
+
+WireCell::Configuration Gen::PhiloxRandom::default_configuration() const
+{
+    Configuration cfg;
+    // Seeds select the sequence.
+    Json::Value jseeds(Json::arrayValue);
+    for (auto seed : m_seeds) {
+        jseeds.append(seed);
+    }
+    cfg["seeds"] = jseeds;
+    // The stream within the sequence.  Components sharing seeds may
+    // be given distinct streams for independent randoms.
+    cfg["stream"] = Json::Value((Json::UInt64) m_stream);
+    // In fill_multinomial(), binomials with variance above this are
+    // approximated as normal.  Zero samples exactly.
+    cfg["normal_threshold"] = m_normal_threshold;
+    return cfg;
+}
+
+void Gen::PhiloxRandom::configure(const WireCell::Configuration& cfg)
+{
+    auto jseeds = cfg["seeds"];
+    if (not jseeds.isNull()) {
+        std::vector<unsigned int> seeds;
+        for (auto jseed : jseeds) {
+            seeds.push_back(jseed.asInt());
+        }
+        m_seeds = seeds;
+    }
+    auto jstream = cfg["stream"];
+    if (not jstream.isNull()) {
+        m_stream = jstream.asUInt64();
+    }
+    m_normal_threshold = get(cfg, "normal_threshold", m_normal_threshold);
+    m_engine = Philox(make_key(m_seeds), m_stream);
+    m_have_spare = false;
+}
+
+IRandom::pointer Gen::PhiloxRandom::substream(uint64_t key)
+{
+    auto child = std::make_shared<PhiloxRandom>(m_seeds, splitmix64(m_stream ^ splitmix64(key)));
+    child->m_normal_threshold = m_normal_threshold;
+    return child;
+}
+
+// Sample by inversion assuming prob <= 0.5 and small max*prob.
+static int binomial_inversion(int max, double prob, double u)
+{
+    const double q = 1 - prob;
+    const double s = prob / q;
+    const double a = (max + 1) * s;
+    double r = std::pow(q, max);
+    int x = 0;
+    while (u > r and x < max) {
+        u -= r;
+        ++x;
+        r *= a / x - s;
+        if (r <= 0) {
+            // The pmf underflowed with u left in the rounding gap
+            // between its accumulated sum and 1.  Take the mode
+            // rather than running on to max.
+            return std::min(max, (int) ((max + 1) * prob));
+        }
+    }
+    return x;
+}
+
+int Gen::PhiloxRandom::binomial(int max, double prob)
+{
+    if (max <= 0 or prob <= 0) {
+        return 0;
+    }
+    if (prob >= 1) {
+        return max;
+    }
+    if (prob > 0.5) {
+        return max - binomial(max, 1 - prob);
+    }
+    if (max * prob < inversion_mean) {
+        return binomial_inversion(max, prob, m_engine.uniform());
+    }
+    std::binomial_distribution<int> distribution(max, prob);
+    return distribution(m_engine);
+}
+
+int Gen::PhiloxRandom::poisson(double mean)
+{
+    if (mean <= 0) {
+        return 0;
+    }
+    if (mean >= inversion_mean) {
+        std::poisson_distribution<int> distribution(mean);
+        return distribution(m_engine);
+    }
+    double u = m_engine.uniform();
+    double p = std::exp(-mean);
+    int x = 0;
+    while (u > p and p > 0) {
+        u -= p;
+        ++x;
+        p *= mean / x;
+    }
+    return x;
+}
+
+double Gen::PhiloxRandom::unit_normal()
+{
+    if (m_have_spare) {
+        m_have_spare = false;
+        return m_spare;
+    }
+    const double u1 = 1.0 - m_engine.uniform();  // (0,1]
+    const double u2 = m_engine.uniform();
+    const double r = std::sqrt(-2.0 * std::log(u1));
+    m_spare = r * std::sin(2 * pi * u2);
+    m_have_spare = true;
+    return r * std::cos(2 * pi * u2);
+}
+
+double Gen::PhiloxRandom::normal(double mean, double sigma) { return mean + sigma * unit_normal(); }
+
+double Gen::PhiloxRandom::uniform(double begin, double end) { return begin + (end - begin) * m_engine.uniform(); }
+
+double Gen::PhiloxRandom::exponential(double mean)
+{
+    return -std::log(1.0 - m_engine.uniform()) / mean;
+}
+
+int Gen::PhiloxRandom::range(int first, int last)
+{
+    std::uniform_int_distribution<int> distribution(first, last);
+    return distribution(m_engine);
+}
+
+void Gen::PhiloxRandom::fill_uniform(double* out, size_t n, double begin, double end)
+{
+    for (size_t ind = 0; ind < n; ++ind) {
+        out[ind] = m_engine.uniform();
+    }
+    const double width = end - begin;
+    for (size_t ind = 0; ind < n; ++ind) {
+        out[ind] = begin + width * out[ind];
+    }
+}
+
+void Gen::PhiloxRandom::fill_normal(double* out, size_t n, double mean, double sigma)
+{
+    size_t ind = 0;
+    if (n and m_have_spare) {
+        out[ind++] = mean + sigma * unit_normal();
+    }
+
+    // Box-Muller over pairs, first drawing all uniforms so the
+    // transform is a simple loop.
+    const size_t npairs = (n - ind) / 2;
+    double* pairs = out + ind;
+    for (size_t ipair = 0; ipair < npairs; ++ipair) {
+        pairs[2 * ipair] = 1.0 - m_engine.uniform();
+        pairs[2 * ipair + 1] = m_engine.uniform();
+    }
+    for (size_t ipair = 0; ipair < npairs; ++ipair) {
+        const double r = sigma * std::sqrt(-2.0 * std::log(pairs[2 * ipair]));
+        const double phi = 2 * pi * pairs[2 * ipair + 1];
+        pairs[2 * ipair] = mean + r * std::cos(phi);
+        pairs[2 * ipair + 1] = mean + r * std::sin(phi);
+    }
+    ind += 2 * npairs;
+
+    if (ind < n) {
+        out[ind] = mean + sigma * unit_normal();
+    }
+}
+
+void Gen::PhiloxRandom::fill_multinomial(int* out, size_t n, int total, const double* prob)
+{
+    // As IRandom::fill_multinomial() but with the chain's binomials
+    // of large variance replaced by a normal approximation.
+    double remaining = 0;
+    size_t last = n;
+    for (size_t ind = 0; ind < n; ++ind) {
+        out[ind] = 0;
+        if (prob[ind] > 0) {
+            remaining += prob[ind];
+            last = ind;
+        }
+    }
+    int left = total;
+    for (size_t ind = 0; ind < n and left > 0; ++ind) {
+        if (prob[ind] <= 0) {
+            continue;
+        }
+        if (ind == last) {
+            out[ind] = left;
+            break;
+        }
+        const double frac = std::min(prob[ind] / remaining, 1.0);
+        const double var = left * frac * (1 - frac);
+        if (m_normal_threshold > 0 and var > m_normal_threshold) {
+            const double num = std::round(left * frac + std::sqrt(var) * unit_normal());
+            out[ind] = std::clamp((int) num, 0, left);
+        }
+        else {
+            out[ind] = binomial(left, frac);
+        }
+        left -= out[ind];
+        remaining -= prob[ind];
+    }
+}
+
+void Gen::PhiloxRandom::fill_binomial(int* out, size_t n, const int* max, const double* prob)
+{
+    for (size_t ind = 0; ind < n; ++ind) {
+        out[ind] = binomial(max[ind], prob[ind]);
+    }
+}
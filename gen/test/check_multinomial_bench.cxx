@@ -0,0 +1,93 @@
+/**
+   Benchmark fluctuating GaussianDiffusion patches.
+
+   Compares the prior method of one independent binomial per patch
+   cell followed by renormalization against one multinomial sample,
+   for both Gen::Random and Gen::PhiloxRandom.
+ */
+
+#include "WireCellGen/GaussianDiffusion.h"
+#include "WireCellGen/PhiloxRandom.h"
+#include "WireCellGen/Random.h"
+#include "WireCellAux/SimpleDepo.h"
+
+#include "WireCellUtil/Units.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace WireCell;
+using namespace WireCell::Gen;
+
+static double independent_binomials(const std::vector<double>& prob, int nelectrons, IRandom& rng)
+{
+    double sum = 0;
+    for (double p : prob) {
+        sum += rng.binomial(nelectrons, p);
+    }
+    return sum;
+}
+
+static double multinomial(const std::vector<double>& prob, int nelectrons, IRandom& rng)
+{
+    std::vector<int> number(prob.size());
+    rng.fill_multinomial(number.data(), number.size(), nelectrons, prob.data());
+    double sum = 0;
+    for (int num : number) {
+        sum += num;
+    }
+    return sum;
+}
+
+template <typename Func>
+static void doit(const std::string& name, Func func)
+{
+    using clock = std::chrono::steady_clock;
+    const auto start = clock::now();
+    double dummy = func();
+    const std::chrono::duration<double> dt = clock::now() - start;
+    std::cout << name << ": " << dt.count() << " s (" << dummy << ")\n";
+}
+
+int main(int argc, char* argv[])
+{
+    const int npatches = argc > 1 ? atoi(argv[1]) : 10000;
+
+    // A typical patch: 3 sigma of 2 wire pitches by 10 ticks.
+    auto depo = std::make_shared<Aux::SimpleDepo>(0, Point(), -5000);
+    const GausDesc tdesc(10 * units::us, 1 * units::us), pdesc(0, 0.5 * units::mm);
+    const Binning tbins(100, 0, 50 * units::us), pbins(1000, -15 * units::cm, 15 * units::cm);
+    GaussianDiffusion gd(depo, tdesc, pdesc);
+    gd.set_sampling(tbins, pbins, 3.0, nullptr, 1);
+    const auto& patch = gd.patch();
+    std::vector<double> prob(patch.size());
+    for (size_t ind = 0; ind < prob.size(); ++ind) {
+        prob[ind] = patch.data()[ind] / depo->charge();
+    }
+    const int nelectrons = std::abs(depo->charge());
+    std::cout << npatches << " patches of " << patch.rows() << " x " << patch.cols() << " cells\n";
+
+    Random random;
+    random.configure(random.default_configuration());
+    PhiloxRandom philox;
+
+    for (auto [rname, rng] : {std::pair<std::string, IRandom*>{"Random", &random}, {"PhiloxRandom", &philox}}) {
+        doit(rname + " binomials", [&]() {
+            double tot = 0;
+            for (int ind = 0; ind < npatches; ++ind) {
+                tot += independent_binomials(prob, nelectrons, *rng);
+            }
+            return tot / npatches;
+        });
+        doit(rname + " multinomial", [&]() {
+            double tot = 0;
+            for (int ind = 0; ind < npatches; ++ind) {
+                tot += multinomial(prob, nelectrons, *rng);
+            }
+            return tot / npatches;
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,204 @@
+#include "WireCellGen/AddNoise.h"
+#include "WireCellAux/SimpleFrame.h"
+#include "WireCellAux/SimpleTrace.h"
+#include "WireCellUtil/NamedFactory.h"
+#include "WireCellUtil/PluginManager.h"
+#include "WireCellUtil/doctest.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace WireCell;
+
+namespace {
+
+    const int nsamples = 1000;
+    const int nchans = 256;
+    const int groupsize = 8;
+
+    // A low-pass spectrum, symmetric about Nyquist, with amplitude
+    // and cutoff varying with the index so that a wave given to the
+    // wrong channel or group is noticed.
+    std::vector<float> lowpass(int index)
+    {
+        const double amp = 5.0 + (index % 7);
+        const double cutoff = 20.0 + 10 * (index % 5);
+        std::vector<float> spec(nsamples);
+        for (int ind = 0; ind < nsamples; ++ind) {
+            const double f = std::min(ind, nsamples - ind) / cutoff;
+            spec[ind] = amp / (1 + f * f);
+        }
+        return spec;
+    }
+
+    class TestChannelSpectrum : public IChannelSpectrum {
+      public:
+        TestChannelSpectrum()
+        {
+            for (int ch = 0; ch < nchans; ++ch) {
+                m_specs.push_back(lowpass(ch));
+            }
+        }
+        virtual ~TestChannelSpectrum() {}
+        const amplitude_t& channel_spectrum(int chid) const { return m_specs.at(chid); }
+
+      private:
+        std::vector<amplitude_t> m_specs;
+    };
+
+    class TestGroupSpectrum : public IGroupSpectrum {
+      public:
+        TestGroupSpectrum()
+        {
+            for (int grp = 0; grp < nchans / groupsize; ++grp) {
+                m_specs.push_back(lowpass(grp));
+            }
+        }
+        virtual ~TestGroupSpectrum() {}
+        const amplitude_t& group_spectrum(int groupid) const { return m_specs.at(groupid); }
+        int groupid(int chid) const { return chid / groupsize; }
+
+      private:
+        std::vector<amplitude_t> m_specs;
+    };
+}
+
+WIRECELL_FACTORY(TestChannelSpectrum, TestChannelSpectrum, WireCell::IChannelSpectrum)
+WIRECELL_FACTORY(TestGroupSpectrum, TestGroupSpectrum, WireCell::IGroupSpectrum)
+
+static void common_setup()
+{
+    PluginManager& pm = PluginManager::instance();
+    pm.add("WireCellAux");
+    pm.add("WireCellGen");
+    // The test models are not in a shared library.
+    make_TestChannelSpectrum_factory();
+    make_TestGroupSpectrum_factory();
+}
+
+static IFrame::pointer make_frame()
+{
+    ITrace::vector traces;
+    for (int ch = 0; ch < nchans; ++ch) {
+        traces.push_back(std::make_shared<Aux::SimpleTrace>(ch, 0, ITrace::ChargeSequence(nsamples, 0)));
+    }
+    return std::make_shared<Aux::SimpleFrame>(0, 0, traces);
+}
+
+// Run an AddNoise with its own, freshly seeded random engine.
+template <class AddNoise>
+static IFrame::pointer run_noise(const std::string& model, int batch, int seed)
+{
+    const std::string rngname = "batch" + std::to_string(batch) + "-seed" + std::to_string(seed);
+    auto rng = Factory::lookup<IConfigurable>("Random", rngname);
+    auto rcfg = rng->default_configuration();
+    rcfg["seeds"][0] = seed;
+    rng->configure(rcfg);
+
+    AddNoise addnoise;
+    auto cfg = addnoise.default_configuration();
+    cfg["model"] = model;
+    cfg["rng"] = "Random:" + rngname;
+    cfg["nsamples"] = nsamples;
+    cfg["batch"] = batch;
+    addnoise.configure(cfg);
+
+    IFrame::pointer outframe;
+    REQUIRE(addnoise(make_frame(), outframe));
+    REQUIRE(outframe);
+    REQUIRE(outframe->traces()->size() == (size_t) nchans);
+    return outframe;
+}
+
+// The RMS and the power summed in a few frequency bands, averaged
+// over traces.
+struct NoiseStats {
+    double rms{0};
+    std::vector<double> bands;
+};
+static NoiseStats noise_stats(const IFrame::pointer& frame, IDFT::pointer dft)
+{
+    const size_t nbands = 4, band = nsamples / 2 / nbands;
+    NoiseStats ns;
+    ns.bands.resize(nbands, 0);
+    double sum2 = 0;
+    for (const auto& trace : *frame->traces()) {
+        const auto& charge = trace->charge();
+        std::vector<IDFT::complex_t> wave(charge.begin(), charge.end()), spec(nsamples);
+        dft->fwd1d(wave.data(), spec.data(), nsamples);
+        for (size_t ind = 0; ind < nbands * band; ++ind) {
+            ns.bands[ind / band] += std::norm(spec[ind]);
+        }
+        for (auto q : charge) {
+            sum2 += q * q;
+        }
+    }
+    const double ntraces = frame->traces()->size();
+    ns.rms = std::sqrt(sum2 / (ntraces * nsamples));
+    for (auto& b : ns.bands) {
+        b /= ntraces;
+    }
+    return ns;
+}
+
+template <class AddNoise>
+static void check_batch_equivalence(const std::string& model)
+{
+    common_setup();
+
+    // With the same seed the randoms are drawn in the same order
+    // and each trace matches up to the rounding of the batched DFT.
+    {
+        auto plain = run_noise<AddNoise>(model, 0, 1234);
+        auto batched = run_noise<AddNoise>(model, 100, 1234);
+        const auto& ptraces = *plain->traces();
+        const auto& btraces = *batched->traces();
+        for (size_t itr = 0; itr < ptraces.size(); ++itr) {
+            REQUIRE(ptraces[itr]->channel() == btraces[itr]->channel());
+            const auto& pq = ptraces[itr]->charge();
+            const auto& bq = btraces[itr]->charge();
+            REQUIRE(pq.size() == bq.size());
+            double pmax = 0, diff = 0;
+            for (size_t ind = 0; ind < pq.size(); ++ind) {
+                pmax = std::max(pmax, (double) std::abs(pq[ind]));
+                diff = std::max(diff, (double) std::abs(pq[ind] - bq[ind]));
+            }
+            REQUIRE(pmax > 0);
+            CHECK(diff <= 1e-4 * pmax);
+        }
+    }
+
+    auto dft = Factory::find_tn<IDFT>("FftwDFT");
+
+    // Different seeds so the comparison is of distributions and not
+    // of identical random sequences.
+    auto plain = noise_stats(run_noise<AddNoise>(model, 0, 1234), dft);
+    auto batched = noise_stats(run_noise<AddNoise>(model, 100, 4321), dft);
+
+    REQUIRE(plain.rms > 0);
+    CHECK(std::abs(batched.rms / plain.rms - 1) < 0.1);
+    for (size_t ind = 0; ind < plain.bands.size(); ++ind) {
+        REQUIRE(plain.bands[ind] > 0);
+        CHECK(std::abs(batched.bands[ind] / plain.bands[ind] - 1) < 0.2);
+    }
+}
+
+TEST_CASE("incoherent add noise is statistically the same with and without batch")
+{
+    check_batch_equivalence<Gen::IncoherentAddNoise>("TestChannelSpectrum");
+}
+
+TEST_CASE("coherent add noise is statistically the same with and without batch")
+{
+    check_batch_equivalence<Gen::CoherentAddNoise>("TestGroupSpectrum");
+}
+
+TEST_CASE("add noise rejects a negative batch")
+{
+    common_setup();
+    Gen::IncoherentAddNoise addnoise;
+    auto cfg = addnoise.default_configuration();
+    cfg["model"] = "TestChannelSpectrum";
+    cfg["batch"] = -1;
+    CHECK_THROWS_AS(addnoise.configure(cfg), ValueError);
+}
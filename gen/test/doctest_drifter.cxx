@@ -1,4 +1,7 @@
 #include "WireCellGen/Drifter.h"
+#include "WireCellAux/ColumnarDepoSet.h"
+#include "WireCellAux/SimpleDepo.h"
+#include "WireCellAux/SimpleDepoSet.h"
 
 #include "WireCellUtil/Logging.h"
 #include "WireCellUtil/Units.h"
@@ -7,6 +10,7 @@
 #include "WireCellUtil/NamedFactory.h"
 #include "WireCellUtil/doctest.h"
 
+#include <algorithm>
 #include <random>
 
 using namespace WireCell;
@@ -215,3 +219,129 @@ TEST_CASE("drifter null face")
         CHECK(got == want);
     }
 }
+
+// Two drift volumes either side of an anode at x=0.
+static void configure_columnar(Drifter& drifter, bool fluctuate, const std::string& rng = "Random")
+{
+    Configuration cfg = drifter.default_configuration();
+    cfg["rng"] = rng;
+    cfg["fluctuate"] = fluctuate;
+    cfg["xregions"][0]["cathode"] = 2*units::meter;
+    cfg["xregions"][0]["response"] = 10*units::cm;
+    cfg["xregions"][0]["anode"] = 0;
+    cfg["xregions"][1]["cathode"] = -2*units::meter;
+    cfg["xregions"][1]["response"] = -10*units::cm;
+    cfg["xregions"][1]["anode"] = 0;
+    drifter.configure(cfg);
+}
+
+static IDepo::vector columnar_input()
+{
+    IDepo::vector in;
+    auto xs = uniform_values(42, 1000, -2.5*units::meter, 2.5*units::meter);
+    auto ts = uniform_values(43, 1000, 0, 1*units::ms);
+    std::sort(ts.begin(), ts.end());
+    for (size_t ind = 0; ind < xs.size(); ++ind) {
+        const double q = ind % 10 ? -1000 : 0; // some zero charge
+        in.push_back(std::make_shared<Aux::SimpleDepo>(ts[ind], Point(xs[ind], 0, 0), q,
+                                                       nullptr, 1*units::mm, 2*units::mm, ind));
+    }
+    return in;
+}
+
+// Drift depo by depo and return the output in time order.
+static IDrifter::output_queue drift_each(Drifter& drifter, const IDepo::vector& in)
+{
+    IDrifter::output_queue out;
+    for (auto depo : in) {
+        drifter(depo, out);
+    }
+    drifter(nullptr, out);
+    out.pop_back();             // EOS
+    std::stable_sort(out.begin(), out.end(), [](const auto& a, const auto& b) {
+        return a->time() < b->time();
+    });
+    return out;
+}
+
+TEST_CASE("drifter columnar")
+{
+    common_setup();
+
+    Drifter drifter;
+    configure_columnar(drifter, false);
+
+    auto in = columnar_input();
+    auto want = drift_each(drifter, in);
+
+    // Columnar input and regular input give same result.
+    auto simple = std::make_shared<Aux::SimpleDepoSet>(0, in);
+    auto columnar = std::make_shared<Aux::ColumnarDepoSet>(1, Aux::ColumnarDepoSet::Columns(in));
+    for (IDepoSet::pointer ds : {IDepoSet::pointer(simple), IDepoSet::pointer(columnar)}) {
+        auto out = drifter.drift(ds, 7);
+        CHECK(out->ident() == 7);
+        auto got = out->depos();
+        REQUIRE(got->size() == want.size());
+        for (size_t ind = 0; ind < want.size(); ++ind) {
+            const auto& w = want[ind];
+            const auto& g = got->at(ind);
+            CHECK(g->time() == w->time());
+            CHECK(g->pos() == w->pos());
+            CHECK(g->charge() == w->charge());
+            CHECK(g->extent_long() == w->extent_long());
+            CHECK(g->extent_tran() == w->extent_tran());
+            CHECK(g->id() == w->id());
+            CHECK(g->prior()->id() == w->prior()->id());
+        }
+    }
+}
+
+TEST_CASE("drifter columnar fluctuated")
+{
+    common_setup();
+
+    auto in = columnar_input();
+    auto columnar = std::make_shared<Aux::ColumnarDepoSet>(1, Aux::ColumnarDepoSet::Columns(in));
+
+    Drifter mean;
+    configure_columnar(mean, false);
+    auto unfluct = drift_each(mean, in);
+
+    // Identically seeded generators so that drift() must draw its
+    // absorption binomials in the same order as insert().
+    for (const std::string rngtype : {"Random", "PhiloxRandom"}) {
+        std::vector<std::string> rngs;
+        for (const std::string name : {"each", "columnar"}) {
+            auto icfg = Factory::lookup<IConfigurable>(rngtype, name);
+            auto rcfg = icfg->default_configuration();
+            rcfg["seeds"] = Json::arrayValue;
+            for (int seed : {1, 2, 3, 4, 5}) {
+                rcfg["seeds"].append(seed);
+            }
+            icfg->configure(rcfg);
+            rngs.push_back(rngtype + ":" + name);
+        }
+
+        Drifter each, cols;
+        configure_columnar(each, true, rngs[0]);
+        configure_columnar(cols, true, rngs[1]);
+
+        auto want = drift_each(each, in);
+        auto got = cols.drift(columnar, 0)->depos();
+        REQUIRE(got->size() == want.size());
+        REQUIRE(unfluct.size() == want.size());
+        size_t nfluct = 0;
+        for (size_t ind = 0; ind < want.size(); ++ind) {
+            const auto& w = want[ind];
+            const auto& g = got->at(ind);
+            CHECK(g->id() == w->id());
+            CHECK(g->time() == w->time());
+            CHECK(g->charge() == w->charge());
+            if (w->charge() != unfluct[ind]->charge()) {
+                ++nfluct;
+            }
+        }
+        // The comparison is of actual fluctuations.
+        CHECK(nfluct > 0);
+    }
+}
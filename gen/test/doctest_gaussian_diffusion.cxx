@@ -0,0 +1,74 @@
+#include "WireCellGen/GaussianDiffusion.h"
+#include "WireCellGen/PhiloxRandom.h"
+#include "WireCellAux/SimpleDepo.h"
+
+#include "WireCellUtil/Units.h"
+#include "WireCellUtil/doctest.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace WireCell;
+using namespace WireCell::Gen;
+
+// The method used prior to multinomial sampling: independent binomial
+// per cell followed by renormalizing to the depo charge.
+static Array::array_xxf independent_binomials(const Array::array_xxf& mean, double charge, IRandom& rng)
+{
+    Array::array_xxf ret = mean;
+    double sum = 0;
+    for (int ind = 0; ind < ret.size(); ++ind) {
+        ret.data()[ind] = -rng.binomial((int) std::abs(charge), mean.data()[ind] / charge);
+        sum += ret.data()[ind];
+    }
+    return ret * (charge / sum);
+}
+
+TEST_CASE("gaussian diffusion multinomial fluctuation")
+{
+    const double charge = -5000;
+    auto depo = std::make_shared<Aux::SimpleDepo>(0, Point(), charge);
+    const GausDesc tdesc(10 * units::us, 1 * units::us), pdesc(0, 1 * units::mm);
+    const Binning tbins(100, 0, 50 * units::us), pbins(100, -5 * units::cm, 5 * units::cm);
+
+    GaussianDiffusion gd(depo, tdesc, pdesc);
+    gd.set_sampling(tbins, pbins, 3.0, nullptr, 1);
+    const Array::array_xxf mean = gd.patch();
+    const int ncells = mean.size();
+    REQUIRE(ncells > 10);
+
+    auto rng = std::make_shared<PhiloxRandom>();
+    const int ntrials = 2000;
+    Array::array_xxf sum1 = Array::array_xxf::Zero(mean.rows(), mean.cols()), sum2 = sum1;
+    Array::array_xxf old1 = sum1, old2 = sum1;
+    for (int trial = 0; trial < ntrials; ++trial) {
+        gd.clear_sampling();
+        gd.set_sampling(tbins, pbins, 3.0, rng, 1);
+        const auto& patch = gd.patch();
+        CHECK(patch.sum() == doctest::Approx(charge).epsilon(1e-4));
+        sum1 += patch;
+        sum2 += patch * patch;
+
+        auto old = independent_binomials(mean, charge, *rng);
+        old1 += old;
+        old2 += old * old;
+    }
+
+    // Per cell, multinomial mean and variance are N*p and N*p*(1-p).
+    // The old method should agree in mean.
+    const double nel = std::abs(charge);
+    for (int ind = 0; ind < ncells; ++ind) {
+        const double p = mean.data()[ind] / charge;
+        const double want_mean = charge * p;
+        const double want_var = nel * p * (1 - p);
+        const double got_mean = sum1.data()[ind] / ntrials;
+        const double got_var = sum2.data()[ind] / ntrials - got_mean * got_mean;
+        const double old_mean = old1.data()[ind] / ntrials;
+        const double err = 5 * std::sqrt(want_var / ntrials) + 1e-3;
+        CHECK(std::abs(got_mean - want_mean) < err);
+        CHECK(std::abs(got_mean - old_mean) < 2 * err);
+        if (want_var > 10) {
+            CHECK(got_var == doctest::Approx(want_var).epsilon(0.2));
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#include "WireCellGen/PhiloxRandom.h"
+
+#include "WireCellUtil/doctest.h"
+
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+using namespace WireCell;
+
+template <typename T>
+static void moments(const std::vector<T>& vals, double& mean, double& sigma)
+{
+    mean = std::accumulate(vals.begin(), vals.end(), 0.0) / vals.size();
+    double var = 0;
+    for (auto val : vals) {
+        var += (val - mean) * (val - mean);
+    }
+    sigma = std::sqrt(var / vals.size());
+}
+
+TEST_CASE("philox random fills")
+{
+    Gen::PhiloxRandom rng;
+    const size_t n = 100001;    // odd to exercise the spare
+    double mean, sigma;
+
+    std::vector<double> normals(n);
+    rng.fill_normal(normals.data(), n, 1.0, 2.0);
+    moments(normals, mean, sigma);
+    CHECK(mean == doctest::Approx(1.0).epsilon(0.02));
+    CHECK(sigma == doctest::Approx(2.0).epsilon(0.02));
+
+    std::vector<double> uniforms(n);
+    rng.fill_uniform(uniforms.data(), n, -1.0, 3.0);
+    moments(uniforms, mean, sigma);
+    CHECK(mean == doctest::Approx(1.0).epsilon(0.02));
+    CHECK(sigma == doctest::Approx(4.0 / std::sqrt(12.0)).epsilon(0.02));
+
+    // Mix of small (inverted) and large means and high probability.
+    for (auto [max, prob] : {std::pair<int, double>{20, 0.1}, {1000, 0.3}, {50, 0.9}}) {
+        std::vector<int> maxes(n, max), got(n);
+        std::vector<double> probs(n, prob);
+        rng.fill_binomial(got.data(), n, maxes.data(), probs.data());
+        moments(got, mean, sigma);
+        CHECK(mean == doctest::Approx(max * prob).epsilon(0.02));
+        CHECK(sigma == doctest::Approx(std::sqrt(max * prob * (1 - prob))).epsilon(0.02));
+    }
+
+    std::vector<int> counts(n);
+    for (auto& count : counts) {
+        count = rng.poisson(4.0);
+    }
+    moments(counts, mean, sigma);
+    CHECK(mean == doctest::Approx(4.0).epsilon(0.02));
+    CHECK(sigma == doctest::Approx(2.0).epsilon(0.02));
+}
+
+TEST_CASE("philox random substreams")
+{
+    Gen::PhiloxRandom rng1, rng2;
+    auto a = rng1.substream(7);
+    rng2.normal(0, 1);          // parent state does not matter
+    auto b = rng2.substream(7);
+    auto c = rng1.substream(8);
+    std::vector<double> va(10), vb(10), vc(10);
+    a->fill_uniform(va.data(), 10, 0, 1);
+    b->fill_uniform(vb.data(), 10, 0, 1);
+    c->fill_uniform(vc.data(), 10, 0, 1);
+    CHECK(va == vb);
+    CHECK(va != vc);
+}
+
+TEST_CASE("philox random configuration")
+{
+    Gen::PhiloxRandom rng1;
+    auto cfg = rng1.default_configuration();
+    cfg["stream"] = Json::Value((Json::UInt64) 0x123456789abcULL);
+    cfg["normal_threshold"] = 0;
+    rng1.configure(cfg);
+
+    // A large stream round trips through the configuration.
+    Gen::PhiloxRandom rng2;
+    rng2.configure(rng1.default_configuration());
+    CHECK(rng2.default_configuration()["stream"].asUInt64() == 0x123456789abcULL);
+    CHECK(rng1.uniform(0, 1) == rng2.uniform(0, 1));
+
+    // Substreams inherit the sampling configuration.
+    auto sub = std::dynamic_pointer_cast<Gen::PhiloxRandom>(rng1.substream(7));
+    REQUIRE(sub);
+    CHECK(sub->default_configuration()["normal_threshold"].asDouble() == 0);
+}
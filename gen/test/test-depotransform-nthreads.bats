@@ -0,0 +1,36 @@
+#!/usr/bin/env bats
+
+# Check that a fluctuating DepoTransform gives identical output
+# regardless of how many threads it uses to process planes.  Each
+# plane job draws from its own random stream seeded in job order.
+
+# bats file_tags=gen,PDSP
+
+bats_load_library wct-bats.sh
+
+cfg_file="${BATS_TEST_FILENAME%.bats}.jsonnet"
+
+@test "fluctuated depo transform output does not depend on nthreads" {
+
+    skip_if_no_input
+
+    cd_tmp file
+
+    local in_file="$(input_file depos/many.tar.bz2)"
+    [[ -f "$in_file" ]]
+
+    local nt
+    for nt in 1 4
+    do
+        wire-cell -l sim-$nt.log -L debug \
+                  -A input="$in_file" -A output="frames-$nt.tar.gz" \
+                  -A nthreads=$nt \
+                  -c "$cfg_file"
+        file_larger_than "frames-$nt.tar.gz" 32
+    done
+
+    local one="$(unpack_frames frames-1.tar.gz)"
+    local four="$(unpack_frames frames-4.tar.gz)"
+    [[ -n "$(ls $one)" ]]
+    check diff -r "$one" "$four"
+}
@@ -32,6 +32,8 @@
 
 
 
+#include <array>
+#include <cstdint>
 #include <variant>
 
 namespace WireCell {
@@ -169,6 +171,88 @@ namespace WireCell {
     typedef boost::graph_traits<cluster_graph_t>::edge_descriptor cluster_edge_t;
     typedef boost::graph_traits<cluster_graph_t>::vertex_iterator cluster_vertex_iter_t;
 
+    // An immutable, compressed sparse row (CSR) form of a
+    // cluster_graph_t.
+    //
+    // Vertices are grouped by node type in the canonical order of
+    // cluster_node_t::known_codes so that each type occupies one
+    // contiguous range of vertex indices.  The pointers of each type
+    // are held in their own array instead of in a variant per node.
+    // The neighbors of each vertex are sorted by index so that the
+    // neighbors of one type are also contiguous.
+    class cluster_csr_t {
+       public:
+        using index_t = uint32_t;
+
+        // A view of a contiguous range of vertex indices.
+        struct span_t {
+            const index_t* first{nullptr};
+            const index_t* last{nullptr};
+            const index_t* begin() const { return first; }
+            const index_t* end() const { return last; }
+            size_t size() const { return last - first; }
+            bool empty() const { return first == last; }
+        };
+
+        cluster_csr_t() = default;
+
+        // Convert from the adjacency list form.  All nodes must hold
+        // one of the known types.
+        explicit cluster_csr_t(const cluster_graph_t& graph);
+
+        size_t num_vertices() const { return m_vertex.size(); }
+        size_t num_edges() const { return m_nedges; }
+
+        // The half-open range of vertex indices holding nodes of the
+        // given type code.  An unknown code gives an empty range.
+        std::pair<index_t, index_t> range(char code) const;
+
+        // Return the type code of the vertex.
+        char code(index_t vtx) const;
+
+        // The sorted neighbors of a vertex, all or only those of one
+        // type code.
+        span_t neighbors(index_t vtx) const;
+        span_t neighbors(index_t vtx, char code) const;
+
+        // Typed access to node pointers.  The vertex must be in the
+        // range() of the corresponding type code.
+        const cluster_node_t::channel_t& channel(index_t vtx) const { return m_channels[vtx - m_begin[0]]; }
+        const cluster_node_t::wire_t& wire(index_t vtx) const { return m_wires[vtx - m_begin[1]]; }
+        const cluster_node_t::blob_t& blob(index_t vtx) const { return m_blobs[vtx - m_begin[2]]; }
+        const cluster_node_t::slice_t& slice(index_t vtx) const { return m_slices[vtx - m_begin[3]]; }
+        const cluster_node_t::meas_t& meas(index_t vtx) const { return m_measures[vtx - m_begin[4]]; }
+
+        // Return the node of a vertex in the variant form.
+        cluster_node_t node(index_t vtx) const;
+
+        // Map between a vertex index and the vertex descriptor in the
+        // graph from which this CSR was made.
+        cluster_vertex_t descriptor(index_t vtx) const { return m_vertex[vtx]; }
+        index_t index(cluster_vertex_t desc) const { return m_index[desc]; }
+
+        // Return an equivalent adjacency list graph.  Its vertex
+        // descriptors are equal to the vertex indices of this CSR.
+        cluster_graph_t graph() const;
+
+       private:
+        // Start of each type's vertex range, in known_codes order,
+        // followed by the number of vertices.
+        std::array<index_t, 6> m_begin{};
+        // Per vertex start in m_targets followed by its size.
+        std::vector<index_t> m_offsets{0};
+        std::vector<index_t> m_targets;
+        size_t m_nedges{0};
+
+        std::vector<index_t> m_vertex, m_index;
+
+        std::vector<cluster_node_t::channel_t> m_channels;
+        std::vector<cluster_node_t::wire_t> m_wires;
+        std::vector<cluster_node_t::blob_t> m_blobs;
+        std::vector<cluster_node_t::slice_t> m_slices;
+        std::vector<cluster_node_t::meas_t> m_measures;
+    };
+
     // The actual ICluster interface.
     //
     // It is small and essentially delievers a cluster_grapht_.  All
@@ -182,6 +266,10 @@ namespace WireCell {
 
         // Access the graph.
         virtual const cluster_graph_t& graph() const = 0;
+
+        // Access the graph in compact CSR form.  Its vertex
+        // descriptors refer to graph().
+        virtual const cluster_csr_t& csr() const = 0;
     };
 
     typedef IndexedGraph<cluster_node_t> cluster_indexed_graph_t;
@@ -37,6 +37,18 @@ namespace WireCell {
         There is also a special rank=0 DFT on rank=2 arrays which is
         more commonly known as a "matrix transpose".
 
+        Each of the six methods has a real-valued counterpart.  The
+        "fwd" methods named with "_r2c" take a real array and produce
+        only the non-negative frequency half of its Hermitian
+        symmetric spectrum.  The "inv" methods named with "_c2r" take
+        such a half spectrum and produce a real array.  Along the
+        transformed axis of size n the half spectrum has n/2+1
+        elements.  For 2d the half is along the columns (axis=1).  The
+        nrows and ncols arguments always give the shape of the real
+        array.  For example, fwd1b_r2c() with axis=0 on a real array
+        of shape (nrows, ncols) produces a complex array of shape
+        (nrows/2+1, ncols).
+
         Requirements on implementations:
 
         - Forward transforms SHALL NOT apply normalization.
@@ -46,12 +58,17 @@ namespace WireCell {
         - The arrays SHALL be assumed to follow C-ordering aka
           row-major storage order.
       
-        - Transform methods SHALL allow the input and output array
-          pointers to be identical.
+        - Complex-to-complex transform methods SHALL allow the input
+          and output array pointers to be identical.
+
+        - Real-valued transform methods SHALL NOT modify their input.
 
         - The IDFT interface provides 1b methods implemented in terms
           of 1d calls and a implementation MAY override these (for
           example, if implementation can exploit batch optimization).
+          Likewise, the real-valued methods are provided in terms of
+          the complex methods and an implementation SHOULD override
+          them as a native real-valued transform costs about half.
 
         - Implementation SHALL allow safe concurrent calls to methods
           by different threads of execution.
@@ -62,7 +79,8 @@ namespace WireCell {
           at least as large as indicated by accompanying size arguments.
 
         - Input and output arrays MUST either be non-overlapping in
-          memory or MUST be identical.
+          memory or MUST be identical.  Arrays given to real-valued
+          transforms MUST be non-overlapping.
 
         Notes: 
 
@@ -115,6 +133,31 @@ namespace WireCell {
                    int nrows, int ncols) const = 0;
 
 
+        // real-valued 1d, 1b and 2d.  See above for the shape of
+        // the half spectrum.
+
+        virtual
+        void fwd1d_r2c(const scalar_t* in, complex_t* out, int size) const;
+
+        virtual
+        void inv1d_c2r(const complex_t* in, scalar_t* out, int size) const;
+
+        virtual
+        void fwd1b_r2c(const scalar_t* in, complex_t* out,
+                       int nrows, int ncols, int axis) const;
+
+        virtual
+        void inv1b_c2r(const complex_t* in, scalar_t* out,
+                       int nrows, int ncols, int axis) const;
+
+        virtual
+        void fwd2d_r2c(const scalar_t* in, complex_t* out,
+                       int nrows, int ncols) const;
+
+        virtual
+        void inv2d_c2r(const complex_t* in, scalar_t* out,
+                       int nrows, int ncols) const;
+
         // Fill "out" with the transpose of "in", may be in-place.
         // The nrows/ncols refers to the shape of the input.
         virtual
@@ -3,7 +3,7 @@
 
 #include "WireCellIface/INode.h"
 
-#include <boost/any.hpp>
+#include "WireCellUtil/SharedAny.h"
 #include <vector>
 
 namespace WireCell {
@@ -18,10 +18,10 @@ namespace WireCell {
 
         virtual ~IFaninNodeBase();
 
-        typedef std::vector<boost::any> any_vector;
+        typedef std::vector<SharedAny> any_vector;
 
         /// The calling signature:
-        virtual bool operator()(const any_vector& anyin, boost::any& anyout) = 0;
+        virtual bool operator()(const any_vector& anyin, SharedAny& anyout) = 0;
 
         virtual NodeCategory category() { return faninNode; }
     };
@@ -38,11 +38,11 @@ namespace WireCell {
 
         virtual ~IFaninNode() {}
 
-        virtual bool operator()(const any_vector& anyv, boost::any& anyout)
+        virtual bool operator()(const any_vector& anyv, SharedAny& anyout)
         {
             input_vector invec;
             for (auto a : anyv) {
-                auto in = boost::any_cast<input_pointer>(a);
+                auto in = a.as<input_pointer>();
                 invec.push_back(in);
             }
             output_pointer out;
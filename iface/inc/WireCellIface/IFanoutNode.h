@@ -3,7 +3,7 @@
 
 #include "WireCellIface/INode.h"
 
-#include <boost/any.hpp>
+#include "WireCellUtil/SharedAny.h"
 #include <vector>
 
 namespace WireCell {
@@ -17,10 +17,10 @@ namespace WireCell {
 
         virtual ~IFanoutNodeBase();
 
-        typedef std::vector<boost::any> any_vector;
+        typedef std::vector<SharedAny> any_vector;
 
         /// The calling signature:
-        virtual bool operator()(const boost::any& anyin, any_vector& anyout) = 0;
+        virtual bool operator()(const SharedAny& anyin, any_vector& anyout) = 0;
 
         virtual NodeCategory category() { return fanoutNode; }
     };
@@ -37,9 +37,9 @@ namespace WireCell {
 
         virtual ~IFanoutNode() {}
 
-        virtual bool operator()(const boost::any& anyin, any_vector& anyv)
+        virtual bool operator()(const SharedAny& anyin, any_vector& anyv)
         {
-            const input_pointer& in = boost::any_cast<const input_pointer&>(anyin);
+            const input_pointer in = anyin.as<input_pointer>();
             output_vector outv;
             bool ok = (*this)(in, outv);
             if (!ok) return false;
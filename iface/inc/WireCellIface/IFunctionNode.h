@@ -3,7 +3,7 @@
 
 #include "WireCellIface/INode.h"
 
-#include <boost/any.hpp>
+#include "WireCellUtil/SharedAny.h"
 #include <vector>
 
 namespace WireCell {
@@ -17,7 +17,7 @@ namespace WireCell {
         virtual ~IFunctionNodeBase();
 
         /// The calling signature:
-        virtual bool operator()(const boost::any& anyin, boost::any& anyout) = 0;
+        virtual bool operator()(const SharedAny& anyin, SharedAny& anyout) = 0;
 
         virtual NodeCategory category() { return functionNode; }
     };
@@ -36,9 +36,9 @@ namespace WireCell {
         /// Set the signature for all subclasses.
         virtual std::string signature() { return typeid(signature_type).name(); }
 
-        virtual bool operator()(const boost::any& anyin, boost::any& anyout)
+        virtual bool operator()(const SharedAny& anyin, SharedAny& anyout)
         {
-            const input_pointer& in = boost::any_cast<const input_pointer&>(anyin);
+            const input_pointer in = anyin.as<input_pointer>();
             output_pointer out;
             bool ok = (*this)(in, out);
             if (!ok) return false;
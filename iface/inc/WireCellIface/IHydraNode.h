@@ -70,7 +70,7 @@
 #include "WireCellIface/INode.h"
 #include "WireCellUtil/TupleHelpers.h"
 
-#include <boost/any.hpp>
+#include "WireCellUtil/SharedAny.h"
 #include <vector>
 #include <deque>
 
@@ -85,7 +85,7 @@ namespace WireCell {
 
         virtual ~IHydraNodeBase();
 
-        typedef std::deque<boost::any> any_queue;
+        typedef std::deque<SharedAny> any_queue;
         typedef std::vector<any_queue> any_queue_vector;
 
         /// The calling signature:
@@ -200,6 +200,7 @@ namespace WireCell {
         using HydraOutput = IHydraOutputV<OutputType, FanoutMultiplicity>;
 
         using typename IHydraNodeBase::any_queue_vector;
+        using typename HydraInput::input_pointer;
         using typename HydraInput::input_queue;
         using typename HydraInput::input_queues;
         using typename HydraOutput::output_queue;
@@ -212,7 +213,9 @@ namespace WireCell {
             const size_t isize = HydraInput::input_types().size();
             input_queues iqs(isize);
             for (size_t ind=0; ind<isize; ++ind) {
-                iqs[ind] = boost::any_cast<input_queue>(anyinqs[ind]);
+                for (const auto& any : anyinqs[ind]) {
+                    iqs[ind].push_back(any.as<input_pointer>());
+                }
             }
 
             // cross over
@@ -297,7 +300,7 @@ namespace WireCell {
             input_queues iqs(isize);
             for (size_t ind=0; ind<isize; ++ind) {
                 for (auto any : anyinqs[ind]) {
-                    iqs[ind].push_back(boost::any_cast<input_pointer>(any));
+                    iqs[ind].push_back(any.as<input_pointer>());
                 }
             }
 
@@ -5,7 +5,7 @@
 
 #include "WireCellUtil/TupleHelpers.h"
 
-#include <boost/any.hpp>
+#include "WireCellUtil/SharedAny.h"
 #include <vector>
 #include <memory>
 
@@ -21,10 +21,10 @@ namespace WireCell {
 
         virtual ~IJoinNodeBase();
 
-        typedef std::vector<boost::any> any_vector;
+        typedef std::vector<SharedAny> any_vector;
 
         /// The calling signature:
-        virtual bool operator()(const any_vector& anyin, boost::any& anyout) = 0;
+        virtual bool operator()(const any_vector& anyin, SharedAny& anyout) = 0;
 
         virtual NodeCategory category() { return joinNode; }
     };
@@ -43,10 +43,10 @@ namespace WireCell {
 
         virtual ~IJoinNode() {}
 
-        virtual bool operator()(const any_vector& anyv, boost::any& anyout)
+        virtual bool operator()(const any_vector& anyv, SharedAny& anyout)
         {
             input_helper_type ih;
-            auto intup = ih.from_any(anyv);
+            auto intup = ih.from_shared_any(anyv);
 
             output_pointer out;
             bool ok = (*this)(intup, out);
@@ -3,7 +3,7 @@
 
 #include "WireCellIface/INode.h"
 
-#include <boost/any.hpp>
+#include "WireCellUtil/SharedAny.h"
 #include <deque>
 #include <vector>
 
@@ -17,10 +17,10 @@ namespace WireCell {
 
         virtual ~IQueuedoutNodeBase();
 
-        typedef std::deque<boost::any> queuedany;
+        typedef std::deque<SharedAny> queuedany;
 
         /// The calling signature:
-        virtual bool operator()(const boost::any& anyin, queuedany& out) = 0;
+        virtual bool operator()(const SharedAny& anyin, queuedany& out) = 0;
 
         virtual NodeCategory category() { return queuedoutNode; }
     };
@@ -38,9 +38,9 @@ namespace WireCell {
 
         virtual ~IQueuedoutNode() {}
 
-        virtual bool operator()(const boost::any& anyin, queuedany& outanyq)
+        virtual bool operator()(const SharedAny& anyin, queuedany& outanyq)
         {
-            const input_pointer& in = boost::any_cast<const input_pointer&>(anyin);
+            const input_pointer in = anyin.as<input_pointer>();
             output_queue outq;
             bool ok = (*this)(in, outq);
             if (!ok) return false;
@@ -17,12 +17,21 @@
     Note, to gain any speed up, the IRandom implementation must
     explicitly implement these "callable" methods.  
 
+    The "fill" methods sample many values into an array in one call
+    and the "substream" method returns an independent generator for
+    use by one thread or one object.  Default implementations loop
+    over the "immediate" methods and do not support substreams.
+    Implementations based on counter-based generators (see
+    Gen::PhiloxRandom) provide fast bulk sampling and reproducible
+    substreams.
+
  */
 
 #ifndef WIRECELL_IRANDOM
 #define WIRECELL_IRANDOM
 
 #include "WireCellUtil/IComponent.h"
+#include <cstdint>
 #include <functional>
 
 namespace WireCell {
@@ -57,6 +66,28 @@ namespace WireCell {
         /// Sample a uniform integer range.
         virtual int range(int first, int last) = 0;
         virtual int_func make_range(int first, int last);
+
+        /// Fill out[0..n) with samples from a normal distribution.
+        virtual void fill_normal(double* out, size_t n, double mean, double sigma);
+
+        /// Fill out[0..n) with samples from a uniform distribution.
+        virtual void fill_uniform(double* out, size_t n, double begin, double end);
+
+        /// Fill out[0..n) with samples from binomial distributions,
+        /// the i'th with max[i] trials of probability prob[i].
+        virtual void fill_binomial(int* out, size_t n, const int* max, const double* prob);
+
+        /// Fill out[0..n) with one sample of a multinomial
+        /// distribution of total trials over n categories.  The
+        /// category probabilities prob[0..n) need not be normalized.
+        /// The samples sum to total unless all probabilities are zero.
+        virtual void fill_multinomial(int* out, size_t n, int total, const double* prob);
+
+        /// Return a new generator producing a sequence which is
+        /// independent of this one and which is determined only by
+        /// the configuration of this one and the key.  Return nullptr
+        /// if substreams are not supported.
+        virtual pointer substream(uint64_t key);
     };
 
 }  // namespace WireCell
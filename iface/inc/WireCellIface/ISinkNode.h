@@ -3,7 +3,7 @@
 
 #include "WireCellIface/INode.h"
 
-#include <boost/any.hpp>
+#include "WireCellUtil/SharedAny.h"
 #include <vector>
 
 namespace WireCell {
@@ -18,7 +18,7 @@ namespace WireCell {
 
         virtual NodeCategory category() { return sinkNode; }
 
-        virtual bool operator()(const boost::any& in) = 0;
+        virtual bool operator()(const SharedAny& in) = 0;
     };
 
     template <typename InputType>
@@ -30,9 +30,9 @@ namespace WireCell {
 
         virtual ~ISinkNode() {}
 
-        virtual bool operator()(const boost::any& anyin)
+        virtual bool operator()(const SharedAny& anyin)
         {
-            const input_pointer& in = boost::any_cast<const input_pointer&>(anyin);
+            const input_pointer in = anyin.as<input_pointer>();
             return (*this)(in);
         }
 
@@ -20,6 +20,7 @@ application-dependent.
 #include "WireCellUtil/Measurement.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace WireCell {
 
@@ -54,6 +55,10 @@ namespace WireCell {
         // typedef std::map<IChannel::pointer, value_t> map_t;
         // typedef std::map<IChannel::pointer, value_t, IdentLess> map_t;
 
+        // A compact form of the activity: contiguous channel/value
+        // pairs in ascending order of channel ident.
+        typedef std::vector<pair_t> dense_t;
+
         // Pointer back to IFrame from which this ISlice was created.
         virtual IFrame::pointer frame() const = 0;
 
@@ -69,6 +74,12 @@ namespace WireCell {
 
         // The activity in the form of a channel/value map;
         virtual map_t activity() const = 0;
+
+        // The activity in the form of a channel/value array sorted by
+        // channel ident.  Unlike activity() this does not copy.  The
+        // reference is valid until the slice is next filled by its
+        // producer.
+        virtual const dense_t& dense_activity() const = 0;
     };
 }  // namespace WireCell
 
@@ -3,7 +3,7 @@
 
 #include "WireCellIface/INode.h"
 
-#include <boost/any.hpp>
+#include "WireCellUtil/SharedAny.h"
 #include <vector>
 
 namespace WireCell {
@@ -18,7 +18,7 @@ namespace WireCell {
 
         virtual NodeCategory category() { return sourceNode; }
 
-        virtual bool operator()(boost::any& anyout) = 0;
+        virtual bool operator()(SharedAny& anyout) = 0;
     };
 
     template <typename OutputType>
@@ -38,7 +38,7 @@ namespace WireCell {
         /// Set the signature for all subclasses.
         virtual std::string signature() { return typeid(signature_type).name(); }
 
-        virtual bool operator()(boost::any& anyout)
+        virtual bool operator()(SharedAny& anyout)
         {
             output_pointer out;
             bool ok = (*this)(out);
@@ -5,7 +5,7 @@
 
 #include "WireCellUtil/TupleHelpers.h"
 
-#include <boost/any.hpp>
+#include "WireCellUtil/SharedAny.h"
 #include <vector>
 #include <memory>
 
@@ -21,10 +21,10 @@ namespace WireCell {
 
         virtual ~ISplitNodeBase();
 
-        typedef std::vector<boost::any> any_vector;
+        typedef std::vector<SharedAny> any_vector;
 
         /// The calling signature:
-        virtual bool operator()(const boost::any& anyin, any_vector& anyout) = 0;
+        virtual bool operator()(const SharedAny& anyin, any_vector& anyout) = 0;
 
         virtual NodeCategory category() { return splitNode; }
     };
@@ -43,16 +43,16 @@ namespace WireCell {
 
         virtual ~ISplitNode() {}
 
-        virtual bool operator()(const boost::any& anyin, any_vector& anyvout)
+        virtual bool operator()(const SharedAny& anyin, any_vector& anyvout)
         {
-            const input_pointer& in = boost::any_cast<const input_pointer&>(anyin);
+            const input_pointer in = anyin.as<input_pointer>();
 
             output_tuple_type outtup;
             output_helper_type oh;
 
             bool ok = (*this)(in, outtup);
             if (ok) {
-                anyvout = oh.as_any(outtup);
+                anyvout = oh.as_shared_any(outtup);
             }
             return ok;
         }
@@ -1,5 +1,8 @@
 
 #include "WireCellIface/ICluster.h"
+#include "WireCellUtil/Exceptions.h"
+
+#include <algorithm>
 
 
 WireCell::ICluster::~ICluster() {}
@@ -18,3 +21,124 @@ size_t WireCell::cluster_node_t::code_index(char code)
     return ret;
 }
 
+
+using namespace WireCell;
+
+cluster_csr_t::cluster_csr_t(const cluster_graph_t& graph)
+{
+    const size_t nvtx = boost::num_vertices(graph);
+    m_nedges = boost::num_edges(graph);
+
+    // Count each type to find the start of its range.
+    std::array<index_t, 5> counts{};
+    for (auto desc : boost::make_iterator_range(boost::vertices(graph))) {
+        const auto ind = graph[desc].ptr.index();
+        if (ind == 0 || ind == std::variant_npos) {
+            THROW(ValueError() << errmsg{"cluster_csr_t: cluster node of unknown type"});
+        }
+        ++counts[ind - 1];
+    }
+    m_begin[0] = 0;
+    for (size_t kind = 0; kind < counts.size(); ++kind) {
+        m_begin[kind + 1] = m_begin[kind] + counts[kind];
+    }
+
+    m_channels.reserve(counts[0]);
+    m_wires.reserve(counts[1]);
+    m_blobs.reserve(counts[2]);
+    m_slices.reserve(counts[3]);
+    m_measures.reserve(counts[4]);
+
+    // Assign vertex indices in type-then-descriptor order.
+    m_index.resize(nvtx);
+    m_vertex.resize(nvtx);
+    auto next = m_begin;
+    for (auto desc : boost::make_iterator_range(boost::vertices(graph))) {
+        const auto& ptr = graph[desc].ptr;
+        const auto kind = ptr.index() - 1;
+        const index_t vtx = next[kind]++;
+        m_index[desc] = vtx;
+        m_vertex[vtx] = desc;
+        switch (kind) {
+        case 0: m_channels.push_back(std::get<cluster_node_t::channel_t>(ptr)); break;
+        case 1: m_wires.push_back(std::get<cluster_node_t::wire_t>(ptr)); break;
+        case 2: m_blobs.push_back(std::get<cluster_node_t::blob_t>(ptr)); break;
+        case 3: m_slices.push_back(std::get<cluster_node_t::slice_t>(ptr)); break;
+        case 4: m_measures.push_back(std::get<cluster_node_t::meas_t>(ptr)); break;
+        }
+    }
+
+    // Sorted adjacency in vertex index order.
+    m_offsets.resize(nvtx + 1);
+    m_offsets[0] = 0;
+    for (size_t vtx = 0; vtx < nvtx; ++vtx) {
+        m_offsets[vtx + 1] = m_offsets[vtx] + boost::out_degree(m_vertex[vtx], graph);
+    }
+    m_targets.resize(m_offsets[nvtx]);
+    for (size_t vtx = 0; vtx < nvtx; ++vtx) {
+        auto* out = m_targets.data() + m_offsets[vtx];
+        for (auto edge : boost::make_iterator_range(boost::out_edges(m_vertex[vtx], graph))) {
+            *out++ = m_index[boost::target(edge, graph)];
+        }
+        std::sort(m_targets.data() + m_offsets[vtx], out);
+    }
+}
+
+std::pair<cluster_csr_t::index_t, cluster_csr_t::index_t> cluster_csr_t::range(char code) const
+{
+    const size_t kind = cluster_node_t::code_index(code);
+    if (kind >= 5) {
+        return std::make_pair(m_begin[5], m_begin[5]);
+    }
+    return std::make_pair(m_begin[kind], m_begin[kind + 1]);
+}
+
+char cluster_csr_t::code(index_t vtx) const
+{
+    const size_t kind = std::upper_bound(m_begin.begin() + 1, m_begin.end(), vtx) - m_begin.begin() - 1;
+    return cluster_node_t::known_codes[kind];
+}
+
+cluster_csr_t::span_t cluster_csr_t::neighbors(index_t vtx) const
+{
+    const auto* base = m_targets.data();
+    return span_t{base + m_offsets[vtx], base + m_offsets[vtx + 1]};
+}
+
+cluster_csr_t::span_t cluster_csr_t::neighbors(index_t vtx, char code) const
+{
+    auto all = neighbors(vtx);
+    const auto [beg, end] = range(code);
+    return span_t{std::lower_bound(all.first, all.last, beg),
+                  std::lower_bound(all.first, all.last, end)};
+}
+
+cluster_node_t cluster_csr_t::node(index_t vtx) const
+{
+    switch (cluster_node_t::code_index(code(vtx))) {
+    case 0: return cluster_node_t(channel(vtx));
+    case 1: return cluster_node_t(wire(vtx));
+    case 2: return cluster_node_t(blob(vtx));
+    case 3: return cluster_node_t(slice(vtx));
+    case 4: return cluster_node_t(meas(vtx));
+    }
+    return cluster_node_t();
+}
+
+cluster_graph_t cluster_csr_t::graph() const
+{
+    const size_t nvtx = num_vertices();
+    cluster_graph_t ret(nvtx);
+    for (size_t vtx = 0; vtx < nvtx; ++vtx) {
+        ret[vtx] = node(vtx);
+    }
+    for (size_t vtx = 0; vtx < nvtx; ++vtx) {
+        for (auto other : neighbors(vtx)) {
+            if (other < vtx) {
+                continue;
+            }
+            boost::add_edge(vtx, other, ret);
+        }
+    }
+    return ret;
+}
@@ -1,5 +1,6 @@
 #include "WireCellIface/IDFT.h"
 
+#include <algorithm>
 #include <vector>
 #include <utility>              // std::swap since c++11
 
@@ -42,6 +43,87 @@ void IDFT::inv1b(const complex_t* in, complex_t* out,
     }
 }
 
+// Default real-valued transforms in terms of the complex ones.  These
+// cost about twice what a native real-valued transform would.
+// Implementations, please override.
+
+void IDFT::fwd1d_r2c(const scalar_t* in, complex_t* out, int size) const
+{
+    std::vector<complex_t> cin(in, in+size);
+    this->fwd1d(cin.data(), cin.data(), size);
+    std::copy(cin.begin(), cin.begin() + size/2+1, out);
+}
+
+// Fill the full spectrum of size n from its n/2+1 half.
+static void hermitian_fill(const IDFT::complex_t* half, IDFT::complex_t* full, int size)
+{
+    const int nhalf = size/2+1;
+    std::copy(half, half+nhalf, full);
+    for (int ind=nhalf; ind<size; ++ind) {
+        full[ind] = std::conj(half[size-ind]);
+    }
+}
+
+void IDFT::inv1d_c2r(const complex_t* in, scalar_t* out, int size) const
+{
+    std::vector<complex_t> cin(size);
+    hermitian_fill(in, cin.data(), size);
+    this->inv1d(cin.data(), cin.data(), size);
+    for (int ind=0; ind<size; ++ind) {
+        out[ind] = std::real(cin[ind]);
+    }
+}
+
+void IDFT::fwd1b_r2c(const scalar_t* in, complex_t* out,
+                     int nrows, int ncols, int axis) const
+{
+    if (axis) {
+        const int nhalf = ncols/2+1;
+        for (int irow=0; irow<nrows; ++irow) {
+            this->fwd1d_r2c(in+irow*ncols, out+irow*nhalf, ncols);
+        }
+        return;
+    }
+    std::vector<scalar_t> tin(nrows*ncols);
+    std::vector<complex_t> tout(ncols*(nrows/2+1));
+    this->transpose(in, tin.data(), nrows, ncols);
+    this->fwd1b_r2c(tin.data(), tout.data(), ncols, nrows, 1);
+    this->transpose(tout.data(), out, ncols, nrows/2+1);
+}
+
+void IDFT::inv1b_c2r(const complex_t* in, scalar_t* out,
+                     int nrows, int ncols, int axis) const
+{
+    if (axis) {
+        const int nhalf = ncols/2+1;
+        for (int irow=0; irow<nrows; ++irow) {
+            this->inv1d_c2r(in+irow*nhalf, out+irow*ncols, ncols);
+        }
+        return;
+    }
+    std::vector<complex_t> tin(ncols*(nrows/2+1));
+    std::vector<scalar_t> tout(nrows*ncols);
+    this->transpose(in, tin.data(), nrows/2+1, ncols);
+    this->inv1b_c2r(tin.data(), tout.data(), ncols, nrows, 1);
+    this->transpose(tout.data(), out, ncols, nrows);
+}
+
+void IDFT::fwd2d_r2c(const scalar_t* in, complex_t* out,
+                     int nrows, int ncols) const
+{
+    this->fwd1b_r2c(in, out, nrows, ncols, 1);
+    this->fwd1b(out, out, nrows, ncols/2+1, 0);
+}
+
+void IDFT::inv2d_c2r(const complex_t* in, scalar_t* out,
+                     int nrows, int ncols) const
+{
+    const int nhalf = ncols/2+1;
+    std::vector<complex_t> tmp(nrows*nhalf);
+    this->inv1b(in, tmp.data(), nrows, nhalf, 0);
+    this->inv1b_c2r(tmp.data(), out, nrows, ncols, 1);
+}
+
 // Trivial default transpose.  Implementations, please override if you
 // can offer something faster.
 
@@ -41,3 +41,59 @@ IRandom::int_func IRandom::make_range(int first, int last)
     return std::bind(&IRandom::range, this, first, last);
 }
 
+
+void IRandom::fill_normal(double* out, size_t n, double mean, double sigma)
+{
+    for (size_t ind = 0; ind < n; ++ind) {
+        out[ind] = normal(mean, sigma);
+    }
+}
+
+void IRandom::fill_uniform(double* out, size_t n, double begin, double end)
+{
+    for (size_t ind = 0; ind < n; ++ind) {
+        out[ind] = uniform(begin, end);
+    }
+}
+
+void IRandom::fill_binomial(int* out, size_t n, const int* max, const double* prob)
+{
+    for (size_t ind = 0; ind < n; ++ind) {
+        out[ind] = binomial(max[ind], prob[ind]);
+    }
+}
+
+// Sample as a chain of binomials, each conditioned on the trials and
+// probability not yet assigned to earlier categories.  This is exact
+// and stops drawing once all trials are assigned.
+void IRandom::fill_multinomial(int* out, size_t n, int total, const double* prob)
+{
+    double remaining = 0;
+    size_t last = n;
+    for (size_t ind = 0; ind < n; ++ind) {
+        out[ind] = 0;
+        if (prob[ind] > 0) {
+            remaining += prob[ind];
+            last = ind;
+        }
+    }
+    int left = total;
+    for (size_t ind = 0; ind < n and left > 0; ++ind) {
+        if (prob[ind] <= 0) {
+            continue;
+        }
+        if (ind == last) {      // immune to round off in remaining
+            out[ind] = left;
+            break;
+        }
+        const double frac = prob[ind] / remaining;
+        out[ind] = frac >= 1 ? left : binomial(left, frac);
+        left -= out[ind];
+        remaining -= prob[ind];
+    }
+}
+
+IRandom::pointer IRandom::substream(uint64_t /*key*/)
+{
+    return nullptr;
+}
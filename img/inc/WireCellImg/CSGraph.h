@@ -130,6 +130,9 @@ namespace WireCell::Img::CS {
         // decomposition on the measure covariance matrix.  If False,
         // measurement uncertainties are not considered.
         bool whiten{true};
+        // If true, the solver starts from the current blob values
+        // (eg, the solution of a previous round) instead of zero.
+        bool warm_start{false};
     };
     graph_t solve(const graph_t& csg, const SolveParams& params, const bool verbose=false);
 
@@ -93,6 +93,20 @@ namespace WireCell {
             // "whitened" via Cholesky decomposition.
             bool m_whiten{true};
 
+            // Config: if true, each round of solving starts from the
+            // blob values left by the previous round (or given by the
+            // input for the first) instead of from zero.  This speeds
+            // up later rounds at the cost of results which may differ
+            // slightly within the solver tolerance.
+            bool m_warm_start{false};
+
+            // Config: if zero, subgraphs are solved serially.
+            // Otherwise, up to this many threads solve them, taking
+            // "grain" subgraphs at a time.  The result does not
+            // depend on either.
+            int m_nthreads{0};
+            size_t m_grain{16};
+
             int m_count{0};
         };
 
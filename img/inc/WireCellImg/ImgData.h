@@ -15,12 +15,21 @@
 #include "WireCellIface/IStripeSet.h"
 #include "WireCellIface/ISlice.h"
 #include "WireCellIface/ISliceFrame.h"
+#include "WireCellAux/SliceTools.h"
+
+#include <atomic>
+#include <mutex>
 
 namespace WireCell::Img::Data {
 
     class Slice : public ISlice {
         IFrame::pointer m_frame;
-        map_t m_activity;
+        // Activity is accumulated in m_activity and moved to the
+        // compact m_dense on freeze().
+        mutable map_t m_activity;
+        mutable dense_t m_dense;
+        mutable std::atomic<bool> m_frozen{false};
+        mutable std::mutex m_freeze_mutex;
         int m_ident;
         double m_start, m_span;
 
@@ -40,14 +49,48 @@ namespace WireCell::Img::Data {
         int ident() const { return m_ident; }
         double start() const { return m_start; }
         double span() const { return m_span; }
-        map_t activity() const { return m_activity; }
+        map_t activity() const { return Aux::activity_map(dense_activity()); }
+        const dense_t& dense_activity() const { freeze(); return m_dense; }
 
         // These methods are not part of the ISlice interface and may be
-        // used prior to interment in the ISlice::pointer.
+        // used prior to interment in the ISlice::pointer.  A frozen
+        // activity is first restored to the map which invalidates any
+        // reference earlier returned by dense_activity().
+
+        void sum(const IChannel::pointer& ch, value_t val) { thaw(); m_activity[ch] += val; }
+        void assign(const IChannel::pointer& ch, value_t val) { thaw(); m_activity[ch] = val; }
+        void merge(const ISlice::pointer& in) {thaw(); const auto& a = in->dense_activity(); m_activity.insert(std::begin(a),std::end(a));}
+
+        // Move the accumulated activity into its compact, sorted
+        // form.  This is called implicitly on first access but
+        // producers should call it before passing the slice on.
+        void freeze() const {
+            if (m_frozen.load(std::memory_order_acquire)) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(m_freeze_mutex);
+            if (m_frozen.load(std::memory_order_relaxed)) {
+                return;
+            }
+            m_dense = Aux::dense_activity(m_activity);
+            map_t().swap(m_activity);
+            m_frozen.store(true, std::memory_order_release);
+        }
 
-        void sum(const IChannel::pointer& ch, value_t val) { m_activity[ch] += val; }
-        void assign(const IChannel::pointer& ch, value_t val) { m_activity[ch] = val; }
-        void merge(const ISlice::pointer& in) {const auto& a = in->activity(); m_activity.insert(std::begin(a),std::end(a));}
+        // Undo freeze().  This releases the dense form.  Not safe
+        // against concurrent readers.
+        void thaw() {
+            if (! m_frozen.load(std::memory_order_acquire)) {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(m_freeze_mutex);
+            if (! m_frozen.load(std::memory_order_relaxed)) {
+                return;
+            }
+            m_activity = Aux::activity_map(m_dense);
+            dense_t().swap(m_dense);
+            m_frozen.store(false, std::memory_order_release);
+        }
     };
 
     // simple collection
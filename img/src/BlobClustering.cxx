@@ -57,7 +57,7 @@ void add_slice(cluster_indexed_graph_t& grind,
         return;
     }
 
-    for (const auto& ichv : islice->activity()) {
+    for (const auto& ichv : islice->dense_activity()) {
         const IChannel::pointer ich = ichv.first;
         if (grind.has(ich)) {
             continue;
@@ -38,28 +38,21 @@ void doit(cluster_graph_t& cgraph)
     // Count to set measure idents.
     int tot_meas = 0;
 
-    for (const auto& svtx : vertex_range(cgraph)) {
-        const auto& snode = cgraph[svtx];
-        const char scode = snode.code();
-        if (scode != 's') {
-            continue;
-        }
-
-        const auto islice = std::get<ISlice::pointer>(snode.ptr);
+    // Walk the s-b-w-c structure on a compact snapshot.  Measures
+    // are added to cgraph which the snapshot does not see.
+    const cluster_csr_t csr(cgraph);
+
+    const auto [sbeg, send] = csr.range('s');
+    for (auto sidx = sbeg; sidx != send; ++sidx) {
+        const auto& islice = csr.slice(sidx);
         ISlice::map_t activity = islice->activity();
 
         // Recieve b and c reached from this s per plane
         std::vector<bcdesc::graph_t> bcs(3); // fixme: hard-code 3 planes
         std::vector< std::unordered_map<int, bcdesc::vdesc_t> > uniq_chans(3);
 
-        for (auto bvtx : mir(boost::adjacent_vertices(svtx, cgraph))) {
-            const auto& bnode = cgraph[bvtx];
-            const char bcode = bnode.code();
-            if (bcode != 'b') {
-                continue;
-            }
-
-            const auto iblob = std::get<IBlob::pointer>(bnode.ptr);
+        for (auto bidx_csr : csr.neighbors(sidx, 'b')) {
+            const auto bvtx = csr.descriptor(bidx_csr);
 
             // add this blob to each plane graph
             std::vector<bcdesc::vdesc_t> bidx;
@@ -68,24 +61,11 @@ void doit(cluster_graph_t& cgraph)
             }
 
             // wires
-            for (auto wvtx : mir(boost::adjacent_vertices(bvtx, cgraph))) {
-                const auto& wnode = cgraph[wvtx];
-                const char wcode = wnode.code();
-                if (wcode != 'w') {
-                    continue;
-                }
-                
-                const auto iwire = std::get<IWire::pointer>(wnode.ptr);
+            for (auto widx : csr.neighbors(bidx_csr, 'w')) {
 
                 // channels
-                for (auto cvtx : mir(boost::adjacent_vertices(wvtx, cgraph))) {
-                    const auto& cnode = cgraph[cvtx];
-                    const char ccode = cnode.code();
-                    if (ccode != 'c') {
-                        continue;
-                    }
-
-                    auto ich = std::get<IChannel::pointer>(cnode.ptr);
+                for (auto cidx_csr : csr.neighbors(widx, 'c')) {
+                    const auto& ich = csr.channel(cidx_csr);
                     const auto wpid = ich->planeid();
                     const auto pind = wpid.index();
                     const auto cident = ich->ident();
@@ -96,7 +76,7 @@ void doit(cluster_graph_t& cgraph)
                     auto& uniq_chan = uniq_chans[pind];
                     auto ucit = uniq_chan.find(cident);
                     if (ucit == uniq_chan.end()) {
-                        cidx = boost::add_vertex({ cvtx }, bc);
+                        cidx = boost::add_vertex({ csr.descriptor(cidx_csr) }, bc);
                         uniq_chan[cident] = cidx;
                     }
                     else {
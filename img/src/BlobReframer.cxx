@@ -81,7 +81,7 @@ bool Img::BlobReframer::operator()(const input_pointer& in, output_pointer& out)
         int itick = islice->start() / m_period;
         int nspan = islice->span() / m_period;
 
-        for (auto const& act : islice->activity()) {
+        for (auto const& act : islice->dense_activity()) {
             auto ichan = act.first;
             if (map_charges.find(ichan->ident()) == map_charges.end()) {
                 map_charges.insert(std::make_pair(ichan->ident(), ITrace::ChargeSequence(m_nticks, 0.0)));
@@ -57,7 +57,7 @@ bool Img::BlobSetMerge::operator()(const input_vector& invec, output_pointer& ou
         }
         SPDLOG_LOGGER_TRACE(log,"in: slice ident: {} time: {} activites: {} blobs: {}",
                             ibs->slice()->ident(), ibs->slice()->start(),
-                            ibs->slice()->activity().size(), ibs->blobs().size());
+                            ibs->slice()->dense_activity().size(), ibs->blobs().size());
         ISlice::pointer newslice = ibs->slice();
         if (!sbs->slice()) {
             oslice = new Img::Data::Slice(newslice->frame(), newslice->ident(),
@@ -78,10 +78,6 @@ bool Img::BlobSetMerge::operator()(const input_vector& invec, output_pointer& ou
             sbs->m_blobs.push_back(IBlob::pointer(sb));
         }
         perset << " " << ibs->blobs().size();
-
-        SPDLOG_LOGGER_TRACE(log, "out: slice ident: {} time: {} activites: {} blobs: {}",
-                            sbs->slice()->ident(), sbs->slice()->start(),
-                            sbs->slice()->activity().size(), sbs->blobs().size());
     }
     perset << " ";
     if (neos) {
@@ -90,6 +86,15 @@ bool Img::BlobSetMerge::operator()(const input_vector& invec, output_pointer& ou
         return true;
     }
 
+    // Reading the activity freezes the merged slice so only do it
+    // once all inputs are merged.
+    if (oslice) {
+        oslice->freeze();
+        SPDLOG_LOGGER_TRACE(log, "out: slice ident: {} time: {} activites: {} blobs: {}",
+                            sbs->slice()->ident(), sbs->slice()->start(),
+                            sbs->slice()->dense_activity().size(), sbs->blobs().size());
+    }
+
     out = sbs;
 
     log->trace("sync'ed {} blobs: {}", sbs->m_blobs.size(), perset.str());
@@ -116,7 +116,7 @@ struct FromActivity {
         // we do not have easy way to go from wire->chid->ich so go
         // from ich->chid and wire->chid.
         std::unordered_map<int, ISlice::value_t> activity;
-        for (const auto& [ich, act] : islice->activity()) {
+        for (const auto& [ich, act] : islice->dense_activity()) {
             activity[ich->ident()] = act;
         }
 
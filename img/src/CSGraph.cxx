@@ -170,8 +170,10 @@ graph_t CS::solve(const graph_t& csg, const SolveParams& params, const bool verb
         SPDLOG_INFO("weight \n{}", String::stringify(weight));
     }
     // std::cerr << "R:\n" << R_mat << "\nm:\n" << m_vec << std::endl;
+    // Blob values are in units of the scaled solution.
+    rparams.set_init = params.warm_start;
     auto solution = Ress::solve(R_mat, m_vec, rparams,
-                                source, weight);
+                                source / params.scale, weight);
     if (verbose) {
         SPDLOG_INFO("solution {}", String::stringify(solution));
     }
@@ -11,7 +11,9 @@
 
 #include "WireCellUtil/NamedFactory.h"
 #include "WireCellUtil/Logging.h"
+#include "WireCellUtil/Parallel.h"
 
+#include <algorithm>
 #include <iterator>
 
 WIRECELL_FACTORY(ChargeSolving, WireCell::Img::ChargeSolving,
@@ -44,13 +46,17 @@ WireCell::Configuration Img::ChargeSolving::default_configuration() const
     }
     cfg["solve_config"] = m_solve_config;
     cfg["whiten"] = m_whiten;
+    cfg["warm_start"] = m_warm_start;
+
+    cfg["nthreads"] = m_nthreads;
+    cfg["grain"] = (int)m_grain;
 
     return cfg;
 }
 
 
 
-void blob_weight_uniform(const cluster_graph_t& /*cgraph*/, graph_t& csg)
+void blob_weight_uniform(const cluster_csr_t& /*csr*/, graph_t& csg)
 {
     for (auto desc : vertex_range(csg)) {
         auto& vtx = csg[desc];
@@ -61,7 +67,7 @@ void blob_weight_uniform(const cluster_graph_t& /*cgraph*/, graph_t& csg)
     }
 }
 
-void blob_weight_simple(const cluster_graph_t& cgraph, graph_t& csg)
+void blob_weight_simple(const cluster_csr_t& csr, graph_t& csg)
 {
     for (auto desc : vertex_range(csg)) {
         auto& vtx = csg[desc];
@@ -73,13 +79,8 @@ void blob_weight_simple(const cluster_graph_t& cgraph, graph_t& csg)
         // add 1.0.  that's the simple weight.
         std::unordered_set<int> slice_idents;
         slice_idents.insert(csg[boost::graph_bundle].islice->ident());
-        for (auto edge : mir(boost::out_edges(vtx.orig_desc, cgraph)))
-        {
-            vdesc_t ndesc = boost::target(edge, cgraph);
-            const auto& nnode = cgraph[ndesc];
-            if (nnode.code() == 'b') {
-                slice_idents.insert(get<blob_t>(nnode.ptr)->slice()->ident());
-            }
+        for (auto nidx : csr.neighbors(csr.index(vtx.orig_desc), 'b')) {
+            slice_idents.insert(csr.blob(nidx)->slice()->ident());
         }
         vtx.value.uncertainty((float) slice_idents.size());
     }
@@ -87,7 +88,7 @@ void blob_weight_simple(const cluster_graph_t& cgraph, graph_t& csg)
 // fixme: implement distance.
 
 
-void blob_weight_uboone(const cluster_graph_t& cgraph, graph_t& csg)
+void blob_weight_uboone(const cluster_csr_t& csr, graph_t& csg)
 {
     int nblobs = 0;
     for (auto desc : vertex_range(csg)) {
@@ -104,21 +105,16 @@ void blob_weight_uboone(const cluster_graph_t& cgraph, graph_t& csg)
         auto cent_time = (int)csg[boost::graph_bundle].islice->start();
         bool prev_con = false;
         bool next_con = false;
-        for (auto edge : mir(boost::out_edges(vtx.orig_desc, cgraph)))
-        {
-            vdesc_t ndesc = boost::target(edge, cgraph);
-            const auto& nnode = cgraph[ndesc];
-            if (nnode.code() == 'b') {
-                const auto iblob = get<blob_t>(nnode.ptr);
-                auto time = (int)iblob->slice()->start();
-                /// TODO: make this 300 configurable
-                if (iblob->value() < 300) continue;
-                if (time > cent_time) {
-                    next_con = true;
-                }
-                if (time < cent_time) {
-                    prev_con = true;
-                }
+        for (auto nidx : csr.neighbors(csr.index(vtx.orig_desc), 'b')) {
+            const auto& iblob = csr.blob(nidx);
+            auto time = (int)iblob->slice()->start();
+            /// TODO: make this 300 configurable
+            if (iblob->value() < 300) continue;
+            if (time > cent_time) {
+                next_con = true;
+            }
+            if (time < cent_time) {
+                prev_con = true;
             }
         }
         double weight = 9.;
@@ -137,7 +133,7 @@ void blob_weight_uboone(const cluster_graph_t& cgraph, graph_t& csg)
 }
 
 // Weighting function lookup
-using blob_weighting_f = std::function<void(const cluster_graph_t& cgraph, graph_t& csg)>;
+using blob_weighting_f = std::function<void(const cluster_csr_t& csr, graph_t& csg)>;
 using blob_weighting_lut = std::unordered_map<std::string, blob_weighting_f>;
 static const blob_weighting_lut gStrategies{
     {"uniform", blob_weight_uniform},
@@ -183,6 +179,19 @@ void Img::ChargeSolving::configure(const WireCell::Configuration& cfg)
     }
     log->debug("SolveParams::Config: {}", m_solve_config);
     m_whiten = get<bool>(cfg, "whiten", m_whiten);
+    m_warm_start = get<bool>(cfg, "warm_start", m_warm_start);
+
+    m_nthreads = get(cfg, "nthreads", m_nthreads);
+    if (m_nthreads < 0) {
+        std::string msg = "nthreads must not be negative";
+        log->error(msg);
+        THROW(ValueError() << errmsg{"ChargeSolving: " + msg});
+    }
+    const int grain = get<int>(cfg, "grain", m_grain);
+    if (grain <= 0) {
+        THROW(ValueError() << errmsg{"ChargeSolving: grain must be positive"});
+    }
+    m_grain = grain;
 }
 
 
@@ -261,7 +270,8 @@ bool Img::ChargeSolving::operator()(const input_pointer& in, output_pointer& out
     // Separate the big graph spanning the whole frame into connected
     // b-m subgraphs with all the info needed for solving each round.
     graph_vector_t sgs;
-    const auto in_graph = in->graph();
+    const auto& in_graph = in->graph();
+    const auto& in_csr = in->csr();
     dump_cg(in_graph, log);
     unpack(in_graph, std::back_inserter(sgs), m_meas_thresh);
 
@@ -273,33 +283,37 @@ bool Img::ChargeSolving::operator()(const input_pointer& in, output_pointer& out
 
     std::vector<float> blob_threshold(nstrats, m_blob_thresh.value());
 
-    SolveParams sparams{gSolveParamsConfigMap.at(m_solve_config), 1000, m_whiten};
-    for (size_t ind = 0; ind < nstrats; ++ind) {
-        const auto& strategy = m_weighting_strategies[ind];
+    SolveParams sparams{gSolveParamsConfigMap.at(m_solve_config), 1000, m_whiten, m_warm_start};
+    for (const auto& strategy : m_weighting_strategies) {
         log->debug("cluster: {} strategy={}",
                    in->ident(), strategy);
+    }
+
+    // Subgraphs share nothing so each may go through all rounds of
+    // solving on its own.  Each is replaced in place which keeps the
+    // order and thus the repacked output independent of threading.
+    auto solve_all = [&](graph_t& sg) {
+        for (size_t ind = 0; ind < nstrats; ++ind) {
+            auto& blob_weighter = gStrategies.at(m_weighting_strategies[ind]);
+            //dump_sg(sg, log);
+            blob_weighter(in_csr, sg);
+            auto tmp_csg = solve(sg, sparams);
+            sg = prune(tmp_csg, blob_threshold[ind]);
+        }
+    };
 
-        auto& blob_weighter = gStrategies.at(strategy);
-
-        // TODO: remove debug code
-        // for (auto& sg : sgs) {
-        //     auto gprop = sg[boost::graph_bundle];
-        //     int start_tick = std::round(gprop.islice->start()/(0.5*WireCell::units::us));
-        //     if (start_tick==2132) {
-        //         log->debug("start: {}", start_tick);
-        //         dump_sg(sg, log);
-        //         blob_weighter(in_graph, sg);
-        //         solve(sg, sparams, true);
-        //     }
-        // }
-
-        std::transform(sgs.begin(), sgs.end(), sgs.begin(),
-                       [&](graph_t& sg) {
-                           //dump_sg(sg, log);
-                           blob_weighter(in_graph, sg);
-                           auto tmp_csg = solve(sg, sparams);
-                           return prune(tmp_csg, blob_threshold[ind]);
-                       });
+    if (m_nthreads == 0) {
+        std::for_each(sgs.begin(), sgs.end(), solve_all);
+    }
+    else {
+        const size_t njobs = (sgs.size() + m_grain - 1) / m_grain;
+        Parallel::for_each(njobs, [&](size_t job) {
+            const size_t beg = job * m_grain;
+            const size_t end = std::min(sgs.size(), beg + m_grain);
+            for (size_t isg = beg; isg < end; ++isg) {
+                solve_all(sgs[isg]);
+            }
+        }, m_nthreads);
     }
     for (const auto& sg : sgs) {
         dump_sg(sg, log);
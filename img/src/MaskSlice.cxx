@@ -451,6 +451,7 @@ bool Img::MaskSlicer::operator()(const input_pointer& in, output_pointer& out)
     ISlice::vector islices;
     for (auto sit : svcmap) {
         auto s = sit.second;
+        s->freeze();
         islices.push_back(ISlice::pointer(s));
     }
     out = make_shared<Img::Data::SliceFrame>(islices, in->ident(), in->time());
@@ -473,6 +474,7 @@ bool Img::MaskSlices::operator()(const input_pointer& in, output_queue& slices)
     // intern
     for (auto sit : svcmap) {
         auto s = sit.second;
+        s->freeze();
 
         /// debug
         // double qtot = 0;
@@ -56,7 +56,7 @@ bool Img::SliceFanout::operator()(const input_pointer& in, output_vector& outv)
     // Slices are pretty verbose so keep this at trace.
     SPDLOG_LOGGER_TRACE(log, "{}x of slice={} t={} + {} in nchan={}",
                         m_multiplicity, in->ident(), in->start(),
-                        in->span(), in->activity().size());
+                        in->span(), in->dense_activity().size());
 
     for (size_t ind = 0; ind < m_multiplicity; ++ind) {
         outv[ind] = in;
@@ -111,6 +111,7 @@ bool Img::SumSlicer::operator()(const input_pointer& in, output_pointer& out)
     ISlice::vector islices;
     for (auto sit : svcmap) {
         auto s = sit.second;
+        s->freeze();
         islices.push_back(ISlice::pointer(s));
     }
     if (m_slice_eos) {
@@ -136,6 +137,7 @@ bool Img::SumSlices::operator()(const input_pointer& inframe, output_queue& slic
     // intern
     for (auto sit : svcmap) {
         auto s = sit.second;
+        s->freeze();
 
         /// debug
         // double qtot = 0;
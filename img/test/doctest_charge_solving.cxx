@@ -0,0 +1,83 @@
+#include "WireCellImg/ChargeSolving.h"
+#include "WireCellAux/SimpleBlob.h"
+#include "WireCellAux/SimpleCluster.h"
+#include "WireCellAux/SimpleMeasure.h"
+#include "WireCellAux/SimpleSlice.h"
+#include "WireCellUtil/doctest.h"
+
+#include <map>
+#include <random>
+
+using namespace WireCell;
+
+// Each slice holds many small b-m subgraphs: three blobs and three
+// measures in a ring.  Blobs connect to the same blob of the next
+// slice so the weighting strategies see inter-slice neighbors.
+static ICluster::pointer make_cluster(int nslices, int ngroups)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> charge(500, 5000);
+
+    cluster_graph_t g;
+    std::vector<cluster_vertex_t> prev;
+    int blob_ident = 0, meas_ident = 0;
+    for (int islice = 0; islice < nslices; ++islice) {
+        ISlice::pointer slice = std::make_shared<Aux::SimpleSlice>(nullptr, islice, 4.0 * islice, 4.0);
+        auto svtx = boost::add_vertex(slice, g);
+        std::vector<cluster_vertex_t> blobs;
+        for (int igrp = 0; igrp < ngroups; ++igrp) {
+            std::vector<cluster_vertex_t> bvtxs, mvtxs;
+            for (int ind = 0; ind < 3; ++ind) {
+                IBlob::pointer blob = std::make_shared<Aux::SimpleBlob>(
+                    blob_ident++, 1000, 0, RayGrid::Blob(), slice, nullptr);
+                bvtxs.push_back(boost::add_vertex(blob, g));
+                boost::add_edge(bvtxs.back(), svtx, g);
+                IMeasure::pointer meas = std::make_shared<Aux::SimpleMeasure>(
+                    meas_ident++, WirePlaneId(0), IMeasure::value_t(charge(rng), 50));
+                mvtxs.push_back(boost::add_vertex(meas, g));
+            }
+            for (int ind = 0; ind < 3; ++ind) {
+                boost::add_edge(bvtxs[ind], mvtxs[ind], g);
+                boost::add_edge(bvtxs[ind], mvtxs[(ind + 1) % 3], g);
+            }
+            blobs.insert(blobs.end(), bvtxs.begin(), bvtxs.end());
+        }
+        for (size_t ind = 0; ind < prev.size(); ++ind) {
+            boost::add_edge(prev[ind], blobs[ind], g);
+        }
+        prev = blobs;
+    }
+    return std::make_shared<Aux::SimpleCluster>(g);
+}
+
+static std::map<int, std::pair<float, float>> solve(const ICluster::pointer& in, int nthreads)
+{
+    Img::ChargeSolving cs;
+    auto cfg = cs.default_configuration();
+    cfg["nthreads"] = nthreads;
+    cfg["grain"] = 1;
+    cs.configure(cfg);
+
+    ICluster::pointer out;
+    REQUIRE(cs(in, out));
+    REQUIRE(out);
+
+    std::map<int, std::pair<float, float>> ret;
+    const auto& csr = out->csr();
+    const auto [beg, end] = csr.range('b');
+    for (auto ind = beg; ind < end; ++ind) {
+        const auto& blob = csr.blob(ind);
+        ret[blob->ident()] = std::make_pair(blob->value(), blob->uncertainty());
+    }
+    return ret;
+}
+
+TEST_CASE("charge solving output does not depend on nthreads")
+{
+    auto in = make_cluster(6, 20);
+    const auto want = solve(in, 0);
+    REQUIRE(want.size() > 0);
+    for (int nthreads : {1, 4}) {
+        CHECK(solve(in, nthreads) == want);
+    }
+}
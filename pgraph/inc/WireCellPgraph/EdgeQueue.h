@@ -0,0 +1,111 @@
+/** The queue held by a Pgraph edge.
+
+    An edge has exactly one tail port and one head port and so its
+    queue has a single producer and a single consumer.  The queue is
+    lock-free under the condition that at most one thread puts and at
+    most one thread gets at any given time, which the Graph executors
+    assure by never calling a node from more than one thread at once.
+
+    Storage is a chain of fixed size ring blocks.  An emptied block
+    is kept for reuse so that a queue in steady state does not
+    allocate.
+
+    A queue may be given a capacity.  This does not limit what may be
+    put but is used by the Graph to stall the tail node while the
+    queue is full.  A node which produces many outputs per call (eg a
+    queuedout node) may thus overshoot the capacity by one call's
+    worth of data.
+ */
+
+#ifndef WIRECELL_PGRAPH_EDGEQUEUE
+#define WIRECELL_PGRAPH_EDGEQUEUE
+
+#include "WireCellUtil/SharedAny.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+
+namespace WireCell {
+    namespace Pgraph {
+
+        // The type of data passed in the graph.  Copying a datum
+        // does not allocate.
+        typedef WireCell::SharedAny Data;
+        // A buffer of data.  It is a std::deque instead of a
+        // std::queue so that it may be iterated as well as pushed
+        // back into.  Like a British queue, one enters it from the
+        // back and exits it from the front.
+        typedef std::deque<Data> Queue;
+
+        class EdgeQueue {
+           public:
+            // A capacity of zero means unlimited.
+            explicit EdgeQueue(size_t capacity = 0);
+            ~EdgeQueue();
+
+            EdgeQueue(const EdgeQueue&) = delete;
+            EdgeQueue& operator=(const EdgeQueue&) = delete;
+
+            // These may be called by any thread.
+            size_t capacity() const { return m_capacity; }
+            size_t size() const;
+            bool empty() const { return size() == 0; }
+            bool full() const { return m_capacity and size() >= m_capacity; }
+
+            // The largest size the queue has reached.
+            size_t high_water() const { return m_high_water.load(std::memory_order_relaxed); }
+
+            // The total number of data ever put to the queue.
+            size_t total() const { return m_pushed.load(std::memory_order_relaxed); }
+
+            // Producer side.  Add data to the back.
+            void push_back(const Data& data);
+
+            // Consumer side.  Return the data at the front,
+            // optionally popping it.  The queue must not be empty.
+            Data front(bool pop = false);
+
+            // Consumer side.  Pop and discard up to n data from the
+            // front.
+            void pop_front(size_t n = 1);
+
+            // Consumer side.  Return a copy of the current contents.
+            Queue snapshot();
+
+           private:
+            static const size_t block_size = 64;
+            struct Block {
+                Data slots[block_size];
+                std::atomic<Block*> next{nullptr};
+            };
+
+            // Get a block for the producer, reusing a spare if one.
+            Block* get_block();
+            // Consumer: return the slot holding index, moving the
+            // head block forward if needed.
+            Data& slot(size_t index);
+
+            const size_t m_capacity;
+
+            // Monotonic counts of data pushed and popped.  The
+            // Nth datum lives in slot N % block_size.
+            std::atomic<size_t> m_pushed{0}, m_popped{0};
+            std::atomic<size_t> m_high_water{0};
+
+            // Owned by the producer.
+            Block* m_tail{nullptr};
+
+            // Owned by the consumer.  The head block holds indices
+            // starting at m_head_base.
+            Block* m_head{nullptr};
+            size_t m_head_base{0};
+
+            // An emptied block passed from consumer to producer.
+            std::atomic<Block*> m_spare{nullptr};
+        };
+
+    }  // namespace Pgraph
+}  // namespace WireCell
+
+#endif
@@ -25,10 +25,12 @@
 #include "WireCellPgraph/Node.h"
 #include "WireCellUtil/Logging.h"
 #include "WireCellUtil/ExecMon.h"
+#include "WireCellAux/NodeProfiler.h"
 
 #include <vector>
 #include <unordered_set>
 #include <unordered_map>
+#include <mutex>
 
 namespace WireCell {
     namespace Pgraph {
@@ -42,8 +44,11 @@ namespace WireCell {
 
             // Connect two nodes by their given ports.  Return false
             // if they are incompatible.  new nodes will be implicitly
-            // added to the graph.
-            bool connect(Node* tail, Node* head, size_t tpind = 0, size_t hpind = 0);
+            // added to the graph.  A nonzero capacity limits the
+            // number of data the edge may hold before the tail node
+            // is stalled.
+            bool connect(Node* tail, Node* head, size_t tpind = 0, size_t hpind = 0,
+                         size_t capacity = 0);
 
             // return a topological sort of the graph as per Kahn algorithm.
             std::vector<Node*> sort_kahn();
@@ -51,25 +56,43 @@ namespace WireCell {
             // Excute the graph until nodes stop delivering
             bool execute();
 
+            // Execute the graph until nodes stop delivering using a
+            // work-stealing pool of nthreads threads (0 means one
+            // per hardware thread).  A node is attempted whenever
+            // one of its neighbors has successfully run and it is
+            // never called by more threads than its concurrency().
+            bool execute_parallel(size_t nthreads = 0);
+
             // Excute parents of node or if any parent is not ready,
             // recursively call this method on parent.  Return number
             // of nodes executed.
             int execute_upstream(Node* node);
 
-            // All internal calling of nodes goes through here.
+            // All internal calling of nodes goes through here.  A
+            // node with any full output edge is not called.  Calls
+            // that return true are recorded to any profiler.
             bool call_node(Node* node);
 
+            // Return the number of edges at their capacity.
+            size_t full_edges() const;
+
             // Return false if any node is not connected.
             bool connected();
 
-            // Print out cumulated CPU time for executing each node
+            // Print out cumulated wall clock time for executing each
+            // node followed by the high-water mark of each edge queue.
             void print_timers(bool include_execmon=false) const;
 
             //Turn on/off using ExecMon
             void set_enable_em(bool flag=false);
 
+            // Record every node call to the profiler, null to stop.
+            void set_profiler(std::shared_ptr<Aux::NodeProfiler> profiler);
+            std::shared_ptr<Aux::NodeProfiler> profiler() const { return m_profiler; }
+
            private:
             std::vector<std::pair<Node*, Node*> > m_edges;
+            std::vector<Edge> m_queues;  // parallel to m_edges
             //std::unordered_set<Node*> m_nodes;
             std::map<size_t, Node*> m_nodes;
             std::unordered_map<Node*, std::vector<Node*> > m_edges_forward, m_edges_backward;
@@ -78,6 +101,15 @@ namespace WireCell {
             std::unordered_map<Node*, double> m_nodes_timer;
             bool m_enable_em = false;
             ExecMon m_em;
+            std::mutex m_em_mutex;
+            std::shared_ptr<Aux::NodeProfiler> m_profiler;
+            std::unordered_map<Node*, size_t> m_profile_index;
+
+            // Register with the profiler any nodes not yet seen.
+            void profile_nodes();
+
+            // The call_node() proper, without profiling.
+            bool call_node_unprofiled(Node* node);
         };
     }  // namespace Pgraph
 }  // namespace WireCell
@@ -21,6 +21,17 @@ namespace WireCell {
             // Concrete node must return some instance identifier.
             virtual std::string ident() = 0;
 
+            // Return a short name for use in reports.
+            virtual std::string name() { return ident(); }
+
+            // Return the maximum number of threads that may call
+            // this node at once, 0 means unlimited.  This is only
+            // consulted by Graph::execute_parallel().  The INode
+            // wrappers pop and push their ports in multiple steps
+            // and so are not reentrant regardless of what their
+            // INode::concurrency() may claim.
+            virtual int concurrency() { return 1; }
+
             Port& iport(size_t ind = 0) { return port(Port::input, ind); }
             Port& oport(size_t ind = 0) { return port(Port::output, ind); }
 
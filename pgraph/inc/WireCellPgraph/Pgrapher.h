@@ -50,6 +50,34 @@
     none, 1 is default and gives summary of time, 2 also includes ExecMon
     tracing.
 
+    A "threads" sets the number of threads used to execute the graph.
+    The default of 1 uses the original single-threaded, low-memory
+    execution.  A larger number executes the graph with a
+    work-stealing thread pool where nodes run concurrently as their
+    input data allow but each node is never called by more than one
+    thread at a time.  A value of 0 uses one thread per hardware
+    thread.
+
+    A "capacity" sets the default maximum number of data an edge may
+    hold before its tail node is stalled until the head node catches
+    up.  The default of 0 means unlimited.  An individual edge may
+    override this with its own "capacity" attribute, eg:
+
+      {tail:{node:"DepoFileSource"}, head:{node:"Drifter"}, capacity:2}
+
+    A node that makes many outputs in one call may overshoot the
+    capacity by that one call's output.  Capacities that are too small
+    for a graph with unbalanced branches may stall the graph before all
+    data has flowed.  The high-water mark of each edge is printed along
+    with the timers.
+
+    A "profile" names a file to which a Chrome/Perfetto trace event
+    JSON record of every node call is written after execution.  Each
+    call records its wall clock span, thread CPU time, thread, input
+    and output queue depths and input payload size.  Load it in
+    chrome://tracing or https://ui.perfetto.dev.  The default empty
+    string disables profiling.
+
  */
 
 #ifndef WIRECELL_PGRAPH_PGRAPHER
@@ -80,6 +108,9 @@ namespace WireCell::Pgraph {
       private:
         Graph m_graph;
         int m_verbosity{1};
+        int m_threads{1};
+        int m_capacity{0};
+        std::string m_profile{""};
     };
 
 }  // namespace WireCell::Pgraph
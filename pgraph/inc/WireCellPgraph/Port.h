@@ -1,28 +1,18 @@
 #ifndef WIRECELL_PGRAPH_PORT
 #define WIRECELL_PGRAPH_PORT
 
+#include "WireCellPgraph/EdgeQueue.h"
 #include "WireCellUtil/Exceptions.h"
 
-#include <boost/any.hpp>
-
 #include <string>
 #include <vector>
-#include <deque>
 #include <memory>
 
 namespace WireCell {
     namespace Pgraph {
 
-        // The type of data passed in the graph.
-        typedef boost::any Data;
-        // A buffer of data.  It is a std::deque instead of a
-        // std::queue so that it may be iterated as well as pushed
-        // back into.  Like a British queue, one enters it from the
-        // back and exits it from the front.
-        typedef std::deque<Data> Queue;
-
         // Edges are just queues that can be shared.
-        typedef std::shared_ptr<Queue> Edge;
+        typedef std::shared_ptr<EdgeQueue> Edge;
 
         class Node;
 
@@ -45,6 +35,9 @@ namespace WireCell {
             // Return true if queue is empty or no edge has been plugged.
             bool empty() const;
 
+            // Return true if the edge queue has reached its capacity.
+            bool full() const;
+
             // Get the next data.  By default this pops the data off
             // the queue.  To "peek" at the data, pas false.
             Data get(bool pop = true);
@@ -0,0 +1,80 @@
+/** A small work-stealing thread pool used by Graph::execute_parallel().
+
+    A task is just an index which is passed to a function given to
+    run().  Each worker thread owns a double-ended queue of tasks.  A
+    worker takes from the back of its own queue, so the task it most
+    recently submitted runs next, and when that is empty it steals
+    from the front of the queue of another worker.
+
+    The pool runs until no task is queued or being executed.
+ */
+
+#ifndef WIRECELL_PGRAPH_WORKPOOL
+#define WIRECELL_PGRAPH_WORKPOOL
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace WireCell {
+    namespace Pgraph {
+
+        class WorkPool {
+           public:
+            typedef size_t task_t;
+            typedef std::function<void(task_t task)> function_t;
+
+            // Create a pool with the given number of worker
+            // threads.  Zero means one per hardware thread.
+            explicit WorkPool(size_t nthreads = 0);
+
+            // Schedule a task.  When called from inside run() by a
+            // worker the task is added to the back of that worker's
+            // queue, else queues are chosen round-robin.
+            void submit(task_t task);
+
+            // Call func on tasks until none remain.  Tasks must be
+            // submitted before and may be submitted during the run.
+            // An exception thrown by func stops the run and is
+            // rethrown here.
+            void run(function_t func);
+
+            size_t nthreads() const { return m_workers.size(); }
+
+           private:
+            struct Worker {
+                std::mutex mutex;
+                std::deque<task_t> tasks;
+            };
+
+            bool take(size_t index, task_t& task);
+            void work(size_t index);
+            void finish(std::exception_ptr err = nullptr);
+
+            std::vector<std::unique_ptr<Worker>> m_workers;
+            function_t m_func;
+
+            // Tasks submitted but not yet completed.
+            std::atomic<size_t> m_pending{0};
+            // Tasks sitting in some worker queue.
+            std::atomic<size_t> m_queued{0};
+            // Workers waiting for a task.
+            std::atomic<size_t> m_sleeping{0};
+            // Round-robin index for submissions from outside.
+            std::atomic<size_t> m_next{0};
+
+            std::mutex m_mutex;
+            std::condition_variable m_cv;
+            std::atomic<bool> m_done{false};
+            std::exception_ptr m_error{nullptr};
+        };
+
+    }  // namespace Pgraph
+}  // namespace WireCell
+
+#endif
@@ -15,6 +15,7 @@
 #include "WireCellIface/IFanoutNode.h"
 #include "WireCellIface/IFaninNode.h"
 #include "WireCellIface/IHydraNode.h"
+#include "WireCellIface/INamed.h"
 
 #include "WireCellUtil/Type.h"
 
@@ -27,7 +28,7 @@ namespace WireCell {
 
         // Node wrappers are constructed with just an INode::pointer
         // and adapt it to Pgraph::Node.  They operate at the
-        // boost::any level and the I*BaseNode INode level.  They are
+        // SharedAny level and the I*BaseNode INode level.  They are
         // not meant to be constructed directly but through the
         // type-erasing Pgraph::Factory.  Their operator() must return
         // false if their underlying node can not be called or if that
@@ -72,6 +73,18 @@ namespace WireCell {
                 return ss.str();
             }
 
+            // The component "type:name" if the INode is named, else
+            // just its type.
+            virtual std::string name()
+            {
+                std::string ret = WireCell::type(*(m_wcnode.get()));
+                auto named = std::dynamic_pointer_cast<INamed>(m_wcnode);
+                if (named) {
+                    ret += ":" + named->get_name();
+                }
+                return ret;
+            }
+
            private:
             INode::pointer m_wcnode;
         };
@@ -96,7 +109,7 @@ namespace WireCell {
                     return false;  // don't call me if I've got existing output waiting
                 }
 
-                boost::any obj;
+                Data obj;
                 m_ok = (*m_wcnode)(obj);
                 if (!m_ok) {
                     return false;
@@ -149,7 +162,7 @@ namespace WireCell {
                 if (ip.empty()) {
                     return false;  // don't call me if there is nothing to give me.
                 }
-                boost::any out;
+                Data out;
                 auto in = ip.get();
                 bool ok = (*m_wcnode)(in, out);
                 if (!ok) {
@@ -218,7 +231,7 @@ namespace WireCell {
                 for (size_t ind = 0; ind < nin; ++ind) {
                     inv[ind] = iports[ind].get();
                 }
-                boost::any out;
+                Data out;
                 bool ok = (*m_wcnode)(inv, out);
                 if (!ok) {
                     return false;
@@ -325,16 +338,16 @@ namespace WireCell {
 
                 // 1) fill input any queue vector
                 IHydraNodeBase::any_queue_vector inqv(nin);
+                std::vector<size_t> ngiven(nin, 0);
                 for (size_t ind = 0; ind < nin; ++ind) {
                     Edge edge = iports[ind].edge();
                     if (!edge) {
                         std::cerr << "Hydra: got broken edge\n";
                         continue;
                     }
-                    if (edge->empty()) {
-                        continue;
-                    }
-                    inqv[ind].insert(inqv[ind].begin(), edge->begin(), edge->end());
+                    auto q = edge->snapshot();
+                    inqv[ind].insert(inqv[ind].begin(), q.begin(), q.end());
+                    ngiven[ind] = inqv[ind].size();
                 }
 
                 auto& oports = output_ports();
@@ -354,18 +367,21 @@ namespace WireCell {
                 // 4) pop dfp input queues to match.  BIG FAT
                 // WARNING: this trimming assumes calller only
                 // pop_front's.  Really should hunt for which ones
-                // have been removed.
+                // have been removed.  We count what was consumed
+                // rather than trimming to size as the upstream may
+                // have added more in the mean time.
                 for (size_t ind = 0; ind < nin; ++ind) {
                     size_t want = inqv[ind].size();
-                    while (iports[ind].size() > want) {
-                        iports[ind].get();
+                    if (ngiven[ind] > want) {
+                        iports[ind].edge()->pop_front(ngiven[ind] - want);
                     }
                 }
 
                 // 5) send out output any queue vectors
                 for (size_t ind = 0; ind < nout; ++ind) {
-                    Edge edge = oports[ind].edge();
-                    edge->insert(edge->end(), outqv[ind].begin(), outqv[ind].end());
+                    for (auto& out : outqv[ind]) {
+                        oports[ind].put(out);
+                    }
                 }
 
                 return true;
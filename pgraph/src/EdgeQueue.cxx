@@ -0,0 +1,122 @@
+#include "WireCellPgraph/EdgeQueue.h"
+#include "WireCellUtil/Exceptions.h"
+
+#include <algorithm>
+
+using namespace WireCell;
+using namespace WireCell::Pgraph;
+
+EdgeQueue::EdgeQueue(size_t capacity)
+  : m_capacity(capacity)
+{
+    m_head = m_tail = new Block;
+}
+
+EdgeQueue::~EdgeQueue()
+{
+    Block* block = m_head;
+    while (block) {
+        Block* next = block->next.load(std::memory_order_relaxed);
+        delete block;
+        block = next;
+    }
+    delete m_spare.load(std::memory_order_relaxed);
+}
+
+size_t EdgeQueue::size() const
+{
+    // Read popped first so the difference can never be negative.
+    const size_t popped = m_popped.load(std::memory_order_acquire);
+    const size_t pushed = m_pushed.load(std::memory_order_acquire);
+    return pushed - popped;
+}
+
+EdgeQueue::Block* EdgeQueue::get_block()
+{
+    Block* block = m_spare.exchange(nullptr, std::memory_order_acquire);
+    if (!block) {
+        return new Block;
+    }
+    block->next.store(nullptr, std::memory_order_relaxed);
+    return block;
+}
+
+void EdgeQueue::push_back(const Data& data)
+{
+    const size_t index = m_pushed.load(std::memory_order_relaxed);
+    const size_t offset = index % block_size;
+    if (index and !offset) {
+        Block* block = get_block();
+        m_tail->next.store(block, std::memory_order_release);
+        m_tail = block;
+    }
+    m_tail->slots[offset] = data;
+    m_pushed.store(index + 1, std::memory_order_release);
+
+    const size_t now = index + 1 - m_popped.load(std::memory_order_acquire);
+    if (now > m_high_water.load(std::memory_order_relaxed)) {
+        m_high_water.store(now, std::memory_order_relaxed);
+    }
+}
+
+Data& EdgeQueue::slot(size_t index)
+{
+    while (index - m_head_base >= block_size) {
+        // The producer links the next block before publishing any
+        // index in it so this is never null here.
+        Block* next = m_head->next.load(std::memory_order_acquire);
+        Block* old = m_spare.exchange(m_head, std::memory_order_release);
+        delete old;
+        m_head = next;
+        m_head_base += block_size;
+    }
+    return m_head->slots[index % block_size];
+}
+
+Data EdgeQueue::front(bool pop)
+{
+    const size_t index = m_popped.load(std::memory_order_relaxed);
+    if (index == m_pushed.load(std::memory_order_acquire)) {
+        THROW(RuntimeError() << errmsg{"edge is empty"});
+    }
+    Data& sd = slot(index);
+    if (!pop) {
+        return sd;
+    }
+    Data ret = std::move(sd);
+    sd = Data();
+    m_popped.store(index + 1, std::memory_order_release);
+    return ret;
+}
+
+void EdgeQueue::pop_front(size_t n)
+{
+    size_t index = m_popped.load(std::memory_order_relaxed);
+    const size_t end = std::min(index + n, m_pushed.load(std::memory_order_acquire));
+    for (; index < end; ++index) {
+        // Release the datum now rather than when the slot is reused.
+        slot(index) = Data();
+        m_popped.store(index + 1, std::memory_order_release);
+    }
+}
+
+Queue EdgeQueue::snapshot()
+{
+    Queue ret;
+    const size_t beg = m_popped.load(std::memory_order_relaxed);
+    const size_t end = m_pushed.load(std::memory_order_acquire);
+    if (beg == end) {
+        return ret;
+    }
+    // Walk the blocks without moving the head.
+    Block* block = m_head;
+    size_t base = m_head_base;
+    for (size_t index = beg; index < end; ++index) {
+        while (index - base >= block_size) {
+            block = block->next.load(std::memory_order_acquire);
+            base += block_size;
+        }
+        ret.push_back(block->slots[index % block_size]);
+    }
+    return ret;
+}
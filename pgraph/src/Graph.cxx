@@ -1,11 +1,11 @@
 #include "WireCellPgraph/Graph.h"
+#include "WireCellPgraph/WorkPool.h"
 #include "WireCellUtil/Type.h"
 #include "WireCellUtil/String.h"
 
 #include <unordered_map>
 #include <unordered_set>
-#include <ctime>
-#include <boost/algorithm/string.hpp>
+#include <chrono>
 
 using WireCell::demangle;
 using WireCell::String::format;
@@ -27,7 +27,26 @@ void Graph::add_node(Node* node)
 
 void Graph::set_enable_em(bool flag) { m_enable_em = flag; }
 
-bool Graph::connect(Node* tail, Node* head, size_t tpind, size_t hpind)
+void Graph::set_profiler(std::shared_ptr<Aux::NodeProfiler> profiler)
+{
+    m_profiler = profiler;
+    m_profile_index.clear();
+}
+
+void Graph::profile_nodes()
+{
+    if (!m_profiler) {
+        return;
+    }
+    for (auto& [instance, node] : m_nodes) {
+        if (m_profile_index.count(node)) {
+            continue;
+        }
+        m_profile_index[node] = m_profiler->add_node(node->name());
+    }
+}
+
+bool Graph::connect(Node* tail, Node* head, size_t tpind, size_t hpind, size_t capacity)
 {
     Port& tport = tail->output_ports()[tpind];
     Port& hport = head->input_ports()[hpind];
@@ -38,7 +57,8 @@ bool Graph::connect(Node* tail, Node* head, size_t tpind, size_t hpind)
     }
 
     m_edges.push_back(std::make_pair(tail, head));
-    Edge edge = std::make_shared<Queue>();
+    Edge edge = std::make_shared<EdgeQueue>(capacity);
+    m_queues.push_back(edge);
 
     tport.plug(edge);
     hport.plug(edge);
@@ -116,6 +136,9 @@ bool Graph::execute()
     for (Node* node : nodes) {
         m_nodes_timer[node] = 0.0;
     }
+    profile_nodes();
+
+    using clock = std::chrono::steady_clock;
 
     while (true) {
         int count = 0;
@@ -124,11 +147,12 @@ bool Graph::execute()
         for (auto nit = nodes.rbegin(); nit != nodes.rend(); ++nit, ++count) {
             Node* node = *nit;
 
-            auto start = std::clock();
+            const auto start = clock::now();
 
             bool ok = call_node(node);
 
-            m_nodes_timer[node] += (std::clock() - start) / (double) CLOCKS_PER_SEC;
+            const std::chrono::duration<double> dt = clock::now() - start;
+            m_nodes_timer[node] += dt.count();
 
             if (ok) {
                 if (m_enable_em) {
@@ -141,10 +165,126 @@ bool Graph::execute()
         }
 
         if (!did_something) {
-            return true;  // it's okay to do nothing.
+            break;  // it's okay to do nothing.
+        }
+    }
+
+    const size_t nstuck = full_edges();
+    if (nstuck) {
+        l->warn("graph stopped with {} full edges, edge capacity may be too small", nstuck);
+    }
+    return true;
+}
+
+bool Graph::execute_parallel(size_t nthreads)
+{
+    auto nodes = sort_kahn();
+    const size_t nnodes = nodes.size();
+
+    WorkPool pool(nthreads);
+    l->debug("executing with {} nodes on {} threads", nnodes, pool.nthreads());
+
+    std::unordered_map<Node*, size_t> index;
+    for (size_t ind = 0; ind < nnodes; ++ind) {
+        index[nodes[ind]] = ind;
+    }
+
+    // Per-node scheduling state, guarded by its mutex.
+    struct Slot {
+        Node* node{nullptr};
+        int limit{1};
+        int running{0};
+        bool queued{false};  // a task for this node is in the pool
+        bool again{false};   // an attempt was refused due to limit
+        std::vector<size_t> neighbors;
+        double seconds{0};
+        std::mutex mutex;
+    };
+    std::vector<Slot> slots(nnodes);
+    profile_nodes();
+    for (size_t ind = 0; ind < nnodes; ++ind) {
+        Node* node = nodes[ind];
+        auto& slot = slots[ind];
+        slot.node = node;
+        slot.limit = node->concurrency();
+        // Running a node may drain its producers' output and fill
+        // its consumers' input.  Consumers go last so they are
+        // taken first by the worker that ran this node.
+        for (auto parent : m_edges_backward[node]) {
+            slot.neighbors.push_back(index[parent]);
+        }
+        for (auto child : m_edges_forward[node]) {
+            slot.neighbors.push_back(index[child]);
+        }
+    }
+
+    auto schedule = [&](size_t ind) {
+        auto& slot = slots[ind];
+        {
+            std::lock_guard<std::mutex> lock(slot.mutex);
+            if (slot.queued) {
+                return;
+            }
+            slot.queued = true;
+        }
+        pool.submit(ind);
+    };
+
+    // Seed with every node.  Workers take their newest task first
+    // so, like execute(), nodes nearest the sinks are tried first.
+    for (size_t ind = 0; ind < nnodes; ++ind) {
+        schedule(ind);
+    }
+
+    using clock = std::chrono::steady_clock;
+    pool.run([&](size_t ind) {
+        auto& slot = slots[ind];
+        {
+            std::lock_guard<std::mutex> lock(slot.mutex);
+            slot.queued = false;
+            if (slot.limit > 0 and slot.running >= slot.limit) {
+                slot.again = true;
+                return;
+            }
+            ++slot.running;
+        }
+
+        const auto start = clock::now();
+        const bool ok = call_node(slot.node);
+        const std::chrono::duration<double> dt = clock::now() - start;
+
+        bool again = false;
+        {
+            std::lock_guard<std::mutex> lock(slot.mutex);
+            --slot.running;
+            slot.seconds += dt.count();
+            std::swap(again, slot.again);
         }
+
+        if (ok) {
+            if (m_enable_em) {
+                std::lock_guard<std::mutex> lock(m_em_mutex);
+                m_em(format("called %d: %s", ind, slot.node->ident()));
+            }
+            schedule(ind);
+            for (auto other : slot.neighbors) {
+                schedule(other);
+            }
+        }
+        else if (again) {
+            schedule(ind);
+        }
+    });
+
+    for (auto& slot : slots) {
+        m_nodes_timer[slot.node] = slot.seconds;
     }
-    return true;  // shouldn't reach
+
+    const size_t nstuck = full_edges();
+    if (nstuck) {
+        l->warn("graph stopped with {} full edges, edge capacity may be too small", nstuck);
+    }
+    return true;
 }
 
 bool Graph::call_node(Node* node)
@@ -153,6 +293,48 @@ bool Graph::call_node(Node* node)
         l->error("graph call: got nullptr node");
         return false;
     }
+    // Backpressure: stall a node until its consumers catch up.
+    for (const auto& port : node->output_ports()) {
+        if (port.full()) {
+            return false;
+        }
+    }
+
+    if (!m_profiler) {
+        return call_node_unprofiled(node);
+    }
+    auto it = m_profile_index.find(node);
+    if (it == m_profile_index.end()) {
+        return call_node_unprofiled(node);
+    }
+
+    // Inputs are only ever popped by this node so their depth and
+    // the data waiting at their front are stable here.
+    long in_depth = 0;
+    size_t payload = 0;
+    for (auto& port : node->input_ports()) {
+        const size_t depth = port.size();
+        in_depth += depth;
+        if (depth) {
+            payload += Aux::NodeProfiler::payload_size(port.get(false));
+        }
+    }
+    const auto begin = m_profiler->stamp();
+    const bool ok = call_node_unprofiled(node);
+    const auto end = m_profiler->stamp();
+    if (!ok) {
+        return false;
+    }
+    long out_depth = 0;
+    for (const auto& port : node->output_ports()) {
+        out_depth += port.size();
+    }
+    m_profiler->record(it->second, begin, end, in_depth, out_depth, payload);
+    return true;
+}
+
+bool Graph::call_node_unprofiled(Node* node)
+{
     bool ok = (*node)();
     // this can be very noisy but useful to uncomment to understand
     // the graph execution order.
@@ -162,6 +344,17 @@ bool Graph::call_node(Node* node)
     return ok;
 }
 
+size_t Graph::full_edges() const
+{
+    size_t count = 0;
+    for (const auto& edge : m_queues) {
+        if (edge->full()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
 bool Graph::connected()
 {
     bool okay = true;
@@ -187,14 +380,19 @@ void Graph::print_timers(bool include_execmon) const
     std::vector<Node*> ordered;
     for (auto it = m.rbegin(); it != m.rend(); ++it) {
         ordered.push_back(it->second);
-        std::string iden = it->second->ident();
-        std::vector<std::string> tags;
-        boost::split(tags, iden, [](char c) { return c == ' '; });
-        l_timer->info("Timer: {} : {} sec", tags[2].substr(5), it->first);
+        l_timer->info("Timer: {} : {} sec", it->second->name(), it->first);
         total_time += it->first;
     }
     l_timer->info("Timer: Total node execution : {} sec", total_time);
 
+    for (size_t ind = 0; ind < m_edges.size(); ++ind) {
+        const auto& [tail, head] = m_edges[ind];
+        const auto& edge = m_queues[ind];
+        l_timer->info("Edge: {} -> {} : high-water {} of capacity {}, total {}",
+                      tail->name(), head->name(),
+                      edge->high_water(), edge->capacity(), edge->total());
+    }
+
     if (include_execmon) {
         l_timer->debug("ExecMon:\n{}", m_em.summary());
     }
@@ -13,6 +13,9 @@ WireCell::Configuration Pgrapher::default_configuration() const
     Configuration cfg;
 
     cfg["edges"] = Json::arrayValue;
+    cfg["threads"] = m_threads;
+    cfg["capacity"] = m_capacity;
+    cfg["profile"] = m_profile;
     return cfg;
 }
 
@@ -51,6 +54,18 @@ void Pgrapher::configure(const WireCell::Configuration& cfg)
 {
     m_verbosity = get(cfg, "verbosity", m_verbosity);
     m_graph.set_enable_em((m_verbosity == 2));
+    m_threads = get(cfg, "threads", m_threads);
+    if (m_threads < 0) {
+        raise<ValueError>("Pgrapher: illegal number of threads: %d", m_threads);
+    }
+    m_capacity = get(cfg, "capacity", m_capacity);
+    m_profile = get(cfg, "profile", m_profile);
+    if (m_profile.empty()) {
+        m_graph.set_profiler(nullptr);
+    }
+    else {
+        m_graph.set_profiler(std::make_shared<Aux::NodeProfiler>());
+    }
 
     Pgraph::Factory fac;
     log->debug("connecting: {} edges", cfg["edges"].size());
@@ -60,7 +75,13 @@ void Pgrapher::configure(const WireCell::Configuration& cfg)
 
         SPDLOG_LOGGER_TRACE(log, "connecting: {}", jedge);
 
-        bool ok = m_graph.connect(fac(tail.first), fac(head.first), tail.second, head.second);
+        const int capacity = get(jedge, "capacity", m_capacity);
+        if (capacity < 0) {
+            raise<ValueError>("illegal capacity %d for edge %s", capacity,
+                              edge_to_string(jedge["tail"], jedge["head"]));
+        }
+
+        bool ok = m_graph.connect(fac(tail.first), fac(head.first), tail.second, head.second, capacity);
         if (!ok) {
             log->critical("failed to connect edge: {}", jedge);
             raise<ValueError>("failed to connect edge %s", edge_to_string(jedge["tail"], jedge["head"]));
@@ -74,9 +95,19 @@ void Pgrapher::configure(const WireCell::Configuration& cfg)
 
 void Pgrapher::execute()
 {
-    log->debug("executing graph");
-    m_graph.execute();
+    if (m_threads == 1) {
+        log->debug("executing graph");
+        m_graph.execute();
+    }
+    else {
+        log->debug("executing graph with threads={}", m_threads);
+        m_graph.execute_parallel(m_threads);
+    }
     log->debug("graph execution complete");
+    if (auto profiler = m_graph.profiler()) {
+        log->debug("writing node profile to {}", m_profile);
+        profiler->write(m_profile);
+    }
     if (m_verbosity) {
         m_graph.print_timers(m_verbosity == 2);
     }
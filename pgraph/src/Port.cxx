@@ -49,6 +49,11 @@ bool Port::empty() const
     return false;
 }
 
+bool Port::full() const
+{
+    return m_edge and m_edge->full();
+}
+
 // Get the next data.  By default this pops the data off
 // the queue.  To "peek" at the data, pas false.
 Data Port::get(bool pop)
@@ -59,14 +64,7 @@ Data Port::get(bool pop)
     if (!m_edge) {
         THROW(RuntimeError() << errmsg{"port has no edge"});
     }
-    if (m_edge->empty()) {
-        THROW(RuntimeError() << errmsg{"edge is empty"});
-    }
-    Data ret = m_edge->front();
-    if (pop) {
-        m_edge->pop_front();
-    }
-    return ret;
+    return m_edge->front(pop);
 }
 
 // Put the data onto the queue.
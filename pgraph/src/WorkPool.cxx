@@ -0,0 +1,145 @@
+#include "WireCellPgraph/WorkPool.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace WireCell::Pgraph;
+
+// The pool and worker index of the current thread, if it is a worker.
+static thread_local WorkPool* t_pool = nullptr;
+static thread_local size_t t_index = 0;
+
+WorkPool::WorkPool(size_t nthreads)
+{
+    if (!nthreads) {
+        nthreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    for (size_t ind = 0; ind < nthreads; ++ind) {
+        m_workers.push_back(std::make_unique<Worker>());
+    }
+}
+
+void WorkPool::submit(task_t task)
+{
+    const size_t nworkers = m_workers.size();
+    size_t index = t_index;
+    if (t_pool != this) {
+        index = m_next++ % nworkers;
+    }
+
+    ++m_pending;
+    {
+        auto& worker = *m_workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.tasks.push_back(task);
+    }
+    ++m_queued;
+
+    if (m_sleeping) {
+        // Taking the lock assures a worker that just checked for
+        // queued tasks is waiting before we notify.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cv.notify_one();
+    }
+}
+
+bool WorkPool::take(size_t index, task_t& task)
+{
+    const size_t nworkers = m_workers.size();
+    {
+        auto& mine = *m_workers[index];
+        std::lock_guard<std::mutex> lock(mine.mutex);
+        if (!mine.tasks.empty()) {
+            task = mine.tasks.back();
+            mine.tasks.pop_back();
+            --m_queued;
+            return true;
+        }
+    }
+    for (size_t step = 1; step < nworkers; ++step) {
+        auto& victim = *m_workers[(index + step) % nworkers];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            --m_queued;
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkPool::finish(std::exception_ptr err)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (err and !m_error) {
+        m_error = err;
+    }
+    m_done = true;
+    m_cv.notify_all();
+}
+
+void WorkPool::work(size_t index)
+{
+    t_pool = this;
+    t_index = index;
+
+    while (true) {
+        task_t task;
+        if (take(index, task)) {
+            if (!m_done) {
+                try {
+                    m_func(task);
+                }
+                catch (...) {
+                    finish(std::current_exception());
+                }
+            }
+            if (--m_pending == 0) {
+                finish();
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        ++m_sleeping;
+        m_cv.wait(lock, [&]() { return m_done or m_queued > 0; });
+        --m_sleeping;
+        if (m_done) {
+            break;
+        }
+    }
+
+    t_pool = nullptr;
+}
+
+void WorkPool::run(function_t func)
+{
+    if (!m_pending) {
+        return;
+    }
+
+    m_func = func;
+    m_done = false;
+    m_error = nullptr;
+
+    std::vector<std::thread> threads;
+    for (size_t ind = 0; ind < m_workers.size(); ++ind) {
+        threads.emplace_back(&WorkPool::work, this, ind);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Anything left over is from a run stopped by an exception.
+    for (auto& worker : m_workers) {
+        worker->tasks.clear();
+    }
+    m_pending = 0;
+    m_queued = 0;
+    m_func = nullptr;
+
+    if (m_error) {
+        std::rethrow_exception(m_error);
+    }
+}
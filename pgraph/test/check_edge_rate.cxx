@@ -0,0 +1,118 @@
+/** Measure the per-edge overhead of passing data through Pgraph.
+
+    A source feeds a chain of pass-through function nodes ending in a
+    sink.  Each node is a real INode wrapped as it is in a job so the
+    rate includes the port, edge queue and SharedAny casting costs.
+
+    Usage: check_edge_rate [nmsgs [nstages [nthreads]]]
+
+    With nthreads of 0 (default) the serial executor is used.
+ */
+
+#include "WireCellPgraph/Graph.h"
+#include "WireCellPgraph/Wrappers.h"
+#include "WireCellIface/IData.h"
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace WireCell;
+
+namespace {
+    struct Msg : public IData<Msg> {
+        size_t num;
+        Msg(size_t num)
+          : num(num)
+        {
+        }
+    };
+
+    struct MsgSource : public ISourceNode<Msg> {
+        size_t count{0}, nmsgs;
+        MsgSource(size_t nmsgs)
+          : nmsgs(nmsgs)
+        {
+        }
+        virtual std::string signature() { return typeid(ISourceNode<Msg>).name(); }
+        virtual bool operator()(output_pointer& out)
+        {
+            if (count > nmsgs) {
+                return false;
+            }
+            if (count++ < nmsgs) {
+                out = std::make_shared<Msg>(count);
+            }
+            else {
+                out = nullptr;  // EOS
+            }
+            return true;
+        }
+    };
+
+    struct MsgPass : public IFunctionNode<Msg, Msg> {
+        virtual std::string signature() { return typeid(IFunctionNode<Msg, Msg>).name(); }
+        virtual bool operator()(const input_pointer& in, output_pointer& out)
+        {
+            out = in;
+            return true;
+        }
+    };
+
+    struct MsgSink : public ISinkNode<Msg> {
+        size_t count{0};
+        virtual std::string signature() { return typeid(ISinkNode<Msg>).name(); }
+        virtual bool operator()(const input_pointer& in)
+        {
+            if (in) {
+                ++count;
+            }
+            return true;
+        }
+    };
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t nmsgs = 100000, nstages = 10, nthreads = 0;
+    if (argc > 1) nmsgs = std::stoul(argv[1]);
+    if (argc > 2) nstages = std::stoul(argv[2]);
+    if (argc > 3) nthreads = std::stoul(argv[3]);
+
+    auto src = std::make_shared<MsgSource>(nmsgs);
+    auto snk = std::make_shared<MsgSink>();
+
+    std::vector<std::shared_ptr<Pgraph::Node>> nodes;
+    nodes.push_back(std::make_shared<Pgraph::Source>(src));
+    for (size_t ind = 0; ind < nstages; ++ind) {
+        nodes.push_back(std::make_shared<Pgraph::Function>(std::make_shared<MsgPass>()));
+    }
+    nodes.push_back(std::make_shared<Pgraph::Sink>(snk));
+
+    Pgraph::Graph graph;
+    for (size_t ind = 1; ind < nodes.size(); ++ind) {
+        graph.connect(nodes[ind - 1].get(), nodes[ind].get());
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    if (nthreads) {
+        graph.execute_parallel(nthreads);
+    }
+    else {
+        graph.execute();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    const double dt = std::chrono::duration<double>(t1 - t0).count();
+
+    if (snk->count != nmsgs) {
+        std::cerr << "check_edge_rate: sink got " << snk->count << " of " << nmsgs << std::endl;
+        return 1;
+    }
+
+    const size_t nedges = nodes.size() - 1;
+    std::cout << "pgraph: " << nmsgs << " msgs through " << nedges << " edges with " << nthreads
+              << " threads in " << dt << " s: " << nmsgs * nedges / dt << " msg/s/edge" << std::endl;
+    return 0;
+}
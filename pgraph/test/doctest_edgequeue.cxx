@@ -0,0 +1,83 @@
+#include "WireCellPgraph/EdgeQueue.h"
+#include "WireCellUtil/doctest.h"
+
+#include <memory>
+#include <thread>
+
+using namespace WireCell;
+using int_pointer = std::shared_ptr<const int>;
+
+TEST_CASE("pgraph edge queue basics")
+{
+    Pgraph::EdgeQueue q(10);
+    REQUIRE(q.empty());
+    REQUIRE(!q.full());
+    REQUIRE(q.capacity() == 10);
+    CHECK_THROWS(q.front());
+
+    // Cross several blocks, interleaving puts and gets.
+    const int num = 1000;
+    int next = 0;
+    for (int ind = 0; ind < num; ++ind) {
+        Pgraph::Data d = std::make_shared<const int>(ind);
+        q.push_back(d);
+        if (ind % 3 == 0) {
+            REQUIRE(*q.front().as<int_pointer>() == next);
+            REQUIRE(*q.front(true).as<int_pointer>() == next);
+            ++next;
+        }
+    }
+    REQUIRE(q.size() == size_t(num - next));
+    REQUIRE(q.full());
+    REQUIRE(q.total() == num);
+    // the last push came just before a pop
+    REQUIRE(q.high_water() == q.size() + 1);
+
+    auto snap = q.snapshot();
+    REQUIRE(snap.size() == q.size());
+    for (size_t ind = 0; ind < snap.size(); ++ind) {
+        REQUIRE(*snap[ind].as<int_pointer>() == next + (int) ind);
+    }
+
+    q.pop_front(100);
+    next += 100;
+    REQUIRE(*q.front().as<int_pointer>() == next);
+    q.pop_front(num);
+    REQUIRE(q.empty());
+    REQUIRE(q.high_water() == snap.size() + 1);
+}
+
+TEST_CASE("pgraph edge queue releases popped data")
+{
+    Pgraph::EdgeQueue q;
+    auto ptr = std::make_shared<int>(42);
+    Pgraph::Data d = ptr;
+    q.push_back(d);
+    d = Pgraph::Data();
+    REQUIRE(ptr.use_count() == 2);
+    q.front(true);
+    REQUIRE(ptr.use_count() == 1);
+}
+
+TEST_CASE("pgraph edge queue single producer single consumer")
+{
+    Pgraph::EdgeQueue q;
+    const int num = 100000;
+    std::thread producer([&]() {
+        for (int ind = 0; ind < num; ++ind) {
+            Pgraph::Data d = std::make_shared<const int>(ind);
+            q.push_back(d);
+        }
+    });
+    int next = 0;
+    while (next < num) {
+        if (q.empty()) {
+            continue;
+        }
+        REQUIRE(*q.front(true).as<int_pointer>() == next);
+        ++next;
+    }
+    producer.join();
+    REQUIRE(q.empty());
+    REQUIRE(q.total() == num);
+}
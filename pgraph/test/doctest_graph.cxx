@@ -74,7 +74,7 @@ class Source : public IdNode {
             return false;
         }
         msg(format("make: %d", m_num));
-        Pgraph::Data d = m_num;
+        Pgraph::Data d = std::make_shared<const int>(m_num);
         oport().put(d);
         ++m_num;
         return true;
@@ -96,7 +96,7 @@ class Sink : public IdNode {
         if (iport().empty()) {
             return false;
         }
-        int d = boost::any_cast<int>(iport().get());
+        int d = *iport().get().as<std::shared_ptr<const int>>();
         msg(format("sink: %d", d));
         return true;
     }
@@ -129,7 +129,7 @@ class Njoin : public IdNode {
                 continue;
             }
             Pgraph::Data d = p.get();
-            int n = boost::any_cast<int>(d);
+            int n = *d.as<std::shared_ptr<const int>>();
             ss << n << " ";
             outv.push_back(d);
         }
@@ -139,7 +139,7 @@ class Njoin : public IdNode {
             return false;
         }
 
-        Pgraph::Data out = outv;
+        Pgraph::Data out = std::make_shared<const Pgraph::Queue>(outv);
         oport().put(out);
         return true;
     }
@@ -164,7 +164,7 @@ class SplitQueueBuffer : public IdNode {
             if (iport().empty()) {
                 return false;
             }
-            m_buf = boost::any_cast<Pgraph::Queue>(iport().get());
+            m_buf = *iport().get().as<std::shared_ptr<const Pgraph::Queue>>();
         }
         if (m_buf.empty()) {
             return false;
@@ -192,7 +192,7 @@ class Nfan : public IdNode {
             return false;
         }
         auto obj = iport().get();
-        int d = boost::any_cast<int>(obj);
+        int d = *obj.as<std::shared_ptr<const int>>();
         msg(format("nfan: %d", d));
         for (auto p : output_ports()) {
             p.put(obj);
@@ -213,7 +213,7 @@ class Func : public IdNode {
             return false;
         }
         Pgraph::Data out = iport().get();
-        int d = boost::any_cast<int>(out);
+        int d = *out.as<std::shared_ptr<const int>>();
         msg(format("func: %d", d));
         oport().put(out);
         return true;
@@ -0,0 +1,337 @@
+#include "WireCellPgraph/Graph.h"
+#include "WireCellPgraph/WorkPool.h"
+#include "WireCellUtil/doctest.h"
+
+#include <atomic>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+using namespace WireCell;
+using int_pointer = std::shared_ptr<const int>;
+
+namespace {
+
+    class Base : public Pgraph::Node {
+       public:
+        Base(const std::string& name, size_t nin, size_t nout)
+          : m_name(name)
+        {
+            using Pgraph::Port;
+            for (size_t ind = 0; ind < nin; ++ind) {
+                m_ports[Port::input].push_back(Port(this, Port::input, "int"));
+            }
+            for (size_t ind = 0; ind < nout; ++ind) {
+                m_ports[Port::output].push_back(Port(this, Port::output, "int"));
+            }
+        }
+        virtual std::string ident()
+        {
+            std::stringstream ss;
+            ss << m_name << "#" << instance();
+            return ss.str();
+        }
+
+        // Number of threads seen inside operator() at once.
+        std::atomic<int> inside{0}, most{0};
+
+       protected:
+        struct Inside {
+            Base& self;
+            Inside(Base& b)
+              : self(b)
+            {
+                int now = ++self.inside;
+                int was = self.most;
+                while (now > was and !self.most.compare_exchange_weak(was, now)) {
+                }
+            }
+            ~Inside() { --self.inside; }
+        };
+
+       private:
+        std::string m_name;
+    };
+
+    class Src : public Base {
+        int m_num{0}, m_end;
+
+       public:
+        Src(int end)
+          : Base("src", 0, 1)
+          , m_end(end)
+        {
+        }
+        virtual bool operator()()
+        {
+            Inside in(*this);
+            if (m_num >= m_end or oport().size()) {
+                return false;
+            }
+            Pgraph::Data d = std::make_shared<const int>(m_num++);
+            oport().put(d);
+            return true;
+        }
+    };
+
+    class Add : public Base {
+        int m_add;
+
+       public:
+        Add(int add)
+          : Base("add", 1, 1)
+          , m_add(add)
+        {
+        }
+        virtual bool operator()()
+        {
+            Inside in(*this);
+            if (iport().empty()) {
+                return false;
+            }
+            int d = *iport().get().as<int_pointer>();
+            Pgraph::Data out = std::make_shared<const int>(d + m_add);
+            oport().put(out);
+            return true;
+        }
+    };
+
+    // Emits several outputs per input like a queuedout node.
+    class Burst : public Base {
+        int m_num;
+
+       public:
+        Burst(int num)
+          : Base("burst", 1, 1)
+          , m_num(num)
+        {
+        }
+        virtual bool operator()()
+        {
+            Inside in(*this);
+            if (iport().empty()) {
+                return false;
+            }
+            int d = *iport().get().as<int_pointer>();
+            for (int ind = 0; ind < m_num; ++ind) {
+                Pgraph::Data out = std::make_shared<const int>(d * m_num + ind);
+                oport().put(out);
+            }
+            return true;
+        }
+    };
+
+    class Dup : public Base {
+       public:
+        Dup()
+          : Base("dup", 1, 2)
+        {
+        }
+        virtual bool operator()()
+        {
+            Inside in(*this);
+            if (iport().empty()) {
+                return false;
+            }
+            auto d = iport().get();
+            for (auto& p : output_ports()) {
+                p.put(d);
+            }
+            return true;
+        }
+    };
+
+    class Sum : public Base {
+       public:
+        Sum()
+          : Base("sum", 2, 1)
+        {
+        }
+        virtual bool operator()()
+        {
+            Inside in(*this);
+            for (auto& p : input_ports()) {
+                if (p.empty()) {
+                    return false;
+                }
+            }
+            int tot = 0;
+            for (auto& p : input_ports()) {
+                tot += *p.get().as<int_pointer>();
+            }
+            Pgraph::Data out = std::make_shared<const int>(tot);
+            oport().put(out);
+            return true;
+        }
+    };
+
+    class Dst : public Base {
+       public:
+        Dst()
+          : Base("dst", 1, 0)
+        {
+        }
+        std::vector<int> got;
+        virtual bool operator()()
+        {
+            Inside in(*this);
+            if (iport().empty()) {
+                return false;
+            }
+            got.push_back(*iport().get().as<int_pointer>());
+            return true;
+        }
+    };
+
+    // src -> add*n -> dup -> (add, add) -> sum -> dst
+    std::vector<int> run_diamond(size_t nthreads, int nitems, int nstages)
+    {
+        std::vector<std::shared_ptr<Base>> keep;
+        auto src = std::make_shared<Src>(nitems);
+        keep.push_back(src);
+
+        Pgraph::Graph g;
+        Pgraph::Node* last = src.get();
+        for (int ind = 0; ind < nstages; ++ind) {
+            auto add = std::make_shared<Add>(1);
+            keep.push_back(add);
+            g.connect(last, add.get());
+            last = add.get();
+        }
+        auto dup = std::make_shared<Dup>();
+        auto add0 = std::make_shared<Add>(1000);
+        auto add1 = std::make_shared<Add>(2000);
+        auto sum = std::make_shared<Sum>();
+        auto dst = std::make_shared<Dst>();
+        keep.insert(keep.end(), {dup, add0, add1, sum, dst});
+        g.connect(last, dup.get());
+        g.connect(dup.get(), add0.get(), 0);
+        g.connect(dup.get(), add1.get(), 1);
+        g.connect(add0.get(), sum.get(), 0, 0);
+        g.connect(add1.get(), sum.get(), 0, 1);
+        g.connect(sum.get(), dst.get());
+        REQUIRE(g.connected());
+
+        if (nthreads) {
+            g.execute_parallel(nthreads);
+        }
+        else {
+            g.execute();
+        }
+
+        for (auto& node : keep) {
+            REQUIRE(node->most <= 1);
+        }
+        return dst->got;
+    }
+}  // namespace
+
+TEST_CASE("pgraph work pool")
+{
+    const size_t ntasks = 1000;
+    std::vector<std::atomic<int>> seen(ntasks);
+    Pgraph::WorkPool pool(4);
+    REQUIRE(pool.nthreads() == 4);
+    pool.submit(0);
+    pool.run([&](size_t task) {
+        ++seen[task];
+        // each task spawns its two "children" of a binary tree
+        for (size_t child : {2 * task + 1, 2 * task + 2}) {
+            if (child < ntasks) {
+                pool.submit(child);
+            }
+        }
+    });
+    for (size_t ind = 0; ind < ntasks; ++ind) {
+        REQUIRE(seen[ind] == 1);
+    }
+
+    // An exception ends the run and is rethrown.
+    pool.submit(0);
+    CHECK_THROWS(pool.run([&](size_t task) { throw std::runtime_error("oops"); }));
+}
+
+TEST_CASE("pgraph parallel execution matches serial")
+{
+    const int nitems = 200, nstages = 10;
+    auto serial = run_diamond(0, nitems, nstages);
+    REQUIRE(serial.size() == nitems);
+    for (int ind = 0; ind < nitems; ++ind) {
+        REQUIRE(serial[ind] == 2 * (ind + nstages) + 3000);
+    }
+    for (size_t nthreads : {1, 2, 4, 8}) {
+        auto par = run_diamond(nthreads, nitems, nstages);
+        REQUIRE(par == serial);
+    }
+}
+
+TEST_CASE("pgraph edge capacity stalls producer")
+{
+    const int nitems = 100, nburst = 5;
+    const size_t capacity = 3;
+    for (size_t nthreads : {0, 1, 4}) {
+        Src src(nitems);
+        Burst burst(nburst);
+        Add add(0);
+        Dst dst;
+        Pgraph::Graph g;
+        g.connect(&src, &burst);
+        g.connect(&burst, &add, 0, 0, capacity);
+        g.connect(&add, &dst);
+        if (nthreads) {
+            g.execute_parallel(nthreads);
+        }
+        else {
+            g.execute();
+        }
+        REQUIRE(g.full_edges() == 0);
+        REQUIRE(dst.got.size() == nitems * nburst);
+        for (int ind = 0; ind < nitems * nburst; ++ind) {
+            REQUIRE(dst.got[ind] == ind);
+        }
+        auto edge = burst.oport().edge();
+        REQUIRE(edge->total() == nitems * nburst);
+        REQUIRE(edge->high_water() <= capacity - 1 + nburst);
+    }
+}
+
+TEST_CASE("pgraph profiler records calls")
+{
+    const int nitems = 50;
+    for (size_t nthreads : {0, 2}) {
+        Src src(nitems);
+        Add add(1);
+        Dst dst;
+        Pgraph::Graph g;
+        g.connect(&src, &add);
+        g.connect(&add, &dst);
+        auto prof = std::make_shared<Aux::NodeProfiler>();
+        g.set_profiler(prof);
+        if (nthreads) {
+            g.execute_parallel(nthreads);
+        }
+        else {
+            g.execute();
+        }
+        REQUIRE(dst.got.size() == nitems);
+        REQUIRE(prof->nodes().size() == 3);
+
+        std::vector<size_t> ncalls(3, 0);
+        for (const auto& call : prof->calls()) {
+            ++ncalls[call.node];
+            REQUIRE(call.end.wall >= call.begin.wall);
+            const auto& name = prof->nodes()[call.node];
+            if (name.find("src") == 0) {
+                REQUIRE(call.in_depth == 0);
+                REQUIRE(call.out_depth >= 1);
+            }
+            if (name.find("dst") == 0) {
+                REQUIRE(call.in_depth >= 1);
+                REQUIRE(call.out_depth == 0);
+            }
+        }
+        for (auto n : ncalls) {
+            REQUIRE(n == nitems);
+        }
+    }
+}
@@ -71,7 +71,7 @@ class Source : public IdNode {
             return false;
         }
         msg("make: ") << m_num << std::endl;
-        Pgraph::Data d = m_num;
+        Pgraph::Data d = std::make_shared<const int>(m_num);
         oport().put(d);
         ++m_num;
         return true;
@@ -92,7 +92,7 @@ class Sink : public IdNode {
         if (iport().empty()) {
             return false;
         }
-        int d = boost::any_cast<int>(iport().get());
+        int d = *iport().get().as<std::shared_ptr<const int>>();
         msg("sink: ") << d << std::endl;
         return true;
     }
@@ -124,7 +124,7 @@ class Njoin : public IdNode {
                 continue;
             }
             Pgraph::Data d = p.get();
-            int n = boost::any_cast<int>(d);
+            int n = *d.as<std::shared_ptr<const int>>();
             o << n << " ";
             outv.push_back(d);
         }
@@ -134,7 +134,7 @@ class Njoin : public IdNode {
             return false;
         }
 
-        Pgraph::Data out = outv;
+        Pgraph::Data out = std::make_shared<const Pgraph::Queue>(outv);
         oport().put(out);
         return true;
     }
@@ -158,7 +158,7 @@ class SplitQueueBuffer : public IdNode {
             if (iport().empty()) {
                 return false;
             }
-            m_buf = boost::any_cast<Pgraph::Queue>(iport().get());
+            m_buf = *iport().get().as<std::shared_ptr<const Pgraph::Queue>>();
         }
         if (m_buf.empty()) {
             return false;
@@ -185,7 +185,7 @@ class Nfan : public IdNode {
             return false;
         }
         auto obj = iport().get();
-        int d = boost::any_cast<int>(obj);
+        int d = *obj.as<std::shared_ptr<const int>>();
         msg("nfan: ") << d << std::endl;
         for (auto p : output_ports()) {
             p.put(obj);
@@ -205,7 +205,7 @@ class Func : public IdNode {
             return false;
         }
         Pgraph::Data out = iport().get();
-        int d = boost::any_cast<int>(out);
+        int d = *out.as<std::shared_ptr<const int>>();
         msg("func: ") << d << std::endl;
         oport().put(out);
         return true;
@@ -51,6 +51,29 @@ namespace WireCell::Pytorch {
         virtual 
         void inv2d(const complex_t* in, complex_t* out,
                    int nrows, int ncols) const;
+
+        // real-valued, with torch::fft::rfft() and friends
+
+        virtual
+        void fwd1d_r2c(const scalar_t* in, complex_t* out,
+                       int size) const;
+        virtual
+        void inv1d_c2r(const complex_t* in, scalar_t* out,
+                       int size) const;
+
+        virtual
+        void fwd1b_r2c(const scalar_t* in, complex_t* out,
+                       int nrows, int ncols, int axis) const;
+        virtual
+        void inv1b_c2r(const complex_t* in, scalar_t* out,
+                       int nrows, int ncols, int axis) const;
+
+        virtual
+        void fwd2d_r2c(const scalar_t* in, complex_t* out,
+                       int nrows, int ncols) const;
+        virtual
+        void inv2d_c2r(const complex_t* in, scalar_t* out,
+                       int nrows, int ncols) const;
           
       private:
         TorchContext m_ctx;
@@ -11,6 +11,15 @@
 
 #include "WireCellPytorch/Torch.h"  // One-stop header.
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace WireCell::Pytorch {
     class TorchService : public Aux::Logger,
                          public ITensorForward,
@@ -38,6 +47,44 @@ namespace WireCell::Pytorch {
         // semaphore to give user chance ot limit us.
         TorchContext m_ctx;
 
+        // Config: "batch_max".  If more than one, concurrent calls
+        // to forward() with inputs of the same shape are run as one
+        // batch of up to this many.  Each input tensor is
+        // concatenated along its first dimension and the output is
+        // split back along the same.  The model must treat the first
+        // dimension as a batch.  If the model output is not a single
+        // tensor batching stops and calls are run one at a time,
+        // where they fail as they would with batching off since only
+        // tensor output is supported.
+        size_t m_batch_max{1};
+
+        // Config: "batch_wait".  The longest time the first call of a
+        // batch waits for others to join it.
+        std::chrono::microseconds m_batch_wait{5000};
+
+        // Cleared once the model is found to return other than a
+        // single tensor, after which calls are no longer batched.
+        mutable std::atomic<bool> m_batchable{true};
+
+        // One caller's input and the promise of its output.
+        struct Request {
+            ITensorSet::pointer input;
+            std::promise<ITensorSet::pointer> output;
+        };
+        using request_ptr = std::shared_ptr<Request>;
+        using batch_t = std::vector<request_ptr>;
+
+        // The shapes of an input set's tensors, identifying its batch.
+        using batch_key_t = std::vector<size_t>;
+
+        // Batches still accepting requests.
+        mutable std::map<batch_key_t, std::shared_ptr<batch_t>> m_batches;
+        mutable std::mutex m_batch_mutex;
+        mutable std::condition_variable m_batch_cond;
+
+        ITensorSet::pointer forward_one(const ITensorSet::pointer& input) const;
+        ITensorSet::pointer forward_batched(const ITensorSet::pointer& input) const;
+        void run_batch(const batch_t& batch) const;
     };
 }  // namespace WireCell::Pytorch
 
@@ -122,3 +122,81 @@ void DFT::inv2d(const IDFT::complex_t* in, IDFT::complex_t* out,
          [](const torch::Tensor& src) { return torch::fft::ifft2(src); });
 }
 
+
+
+// Real-valued transforms are never in-place so, unlike doit(), we
+// avoid the initial copy.  The input is const but no transform here
+// writes to its input.
+template<typename InType, typename OutType>
+void doit_real(const TorchContext& ctx,
+               const InType* in, OutType* out,
+               int64_t nrows, int64_t ncols, // shape of input
+               int64_t out_size,
+               torch::Dtype in_dtype,
+               torch_transform func)
+{
+    TorchSemaphore sem(ctx);
+    torch::NoGradGuard no_grad;
+
+    auto dtype = torch::TensorOptions().dtype(in_dtype);
+    torch::Tensor src = torch::from_blob(const_cast<InType*>(in), {nrows, ncols}, dtype);
+
+    src = src.to(ctx.device());
+    auto dst = func(src);
+    dst = dst.contiguous().cpu();
+
+    memcpy(out, dst.data_ptr(), sizeof(OutType)*out_size);
+}
+
+
+void DFT::fwd1d_r2c(const IDFT::scalar_t* in, IDFT::complex_t* out, int size) const
+{
+    doit_real(m_ctx, in, out, 1, size, size/2+1, torch::kFloat,
+              [](const torch::Tensor& src) { return torch::fft::rfft(src); });
+}
+
+
+void DFT::inv1d_c2r(const IDFT::complex_t* in, IDFT::scalar_t* out, int size) const
+{
+    doit_real(m_ctx, in, out, 1, size/2+1, size, torch::kComplexFloat,
+              [&](const torch::Tensor& src) { return torch::fft::irfft(src, size); });
+}
+
+
+void DFT::fwd1b_r2c(const IDFT::scalar_t* in, IDFT::complex_t* out,
+                    int nrows, int ncols, int axis) const
+{
+    const int64_t out_size = axis ? nrows*(ncols/2+1) : (nrows/2+1)*ncols;
+    doit_real(m_ctx, in, out, nrows, ncols, out_size, torch::kFloat,
+              [&](const torch::Tensor& src) {
+                  return torch::fft::rfft(src, torch::nullopt, axis); });
+}
+
+
+void DFT::inv1b_c2r(const IDFT::complex_t* in, IDFT::scalar_t* out,
+                    int nrows, int ncols, int axis) const
+{
+    const int64_t hrows = axis ? nrows : nrows/2+1;
+    const int64_t hcols = axis ? ncols/2+1 : ncols;
+    const int64_t n = axis ? ncols : nrows;
+    doit_real(m_ctx, in, out, hrows, hcols, nrows*ncols, torch::kComplexFloat,
+              [&](const torch::Tensor& src) {
+                  return torch::fft::irfft(src, n, axis); });
+}
+
+
+void DFT::fwd2d_r2c(const IDFT::scalar_t* in, IDFT::complex_t* out,
+                    int nrows, int ncols) const
+{
+    doit_real(m_ctx, in, out, nrows, ncols, nrows*(ncols/2+1), torch::kFloat,
+              [](const torch::Tensor& src) { return torch::fft::rfft2(src); });
+}
+
+
+void DFT::inv2d_c2r(const IDFT::complex_t* in, IDFT::scalar_t* out,
+                    int nrows, int ncols) const
+{
+    doit_real(m_ctx, in, out, nrows, ncols/2+1, nrows*ncols, torch::kComplexFloat,
+              [&](const torch::Tensor& src) {
+                  return torch::fft::irfft2(src, std::vector<int64_t>{nrows, ncols}); });
+}
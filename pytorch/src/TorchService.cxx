@@ -3,6 +3,9 @@
 #include "WireCellUtil/NamedFactory.h"
 #include "WireCellUtil/String.h"
 #include "WireCellUtil/Persist.h"
+#include "WireCellUtil/Units.h"
+
+#include <numeric>
 
 #include <omp.h>
 #include <ATen/Parallel.h>
@@ -44,6 +47,13 @@ Configuration Pytorch::TorchService::default_configuration() const
     // one of: {cpu, gpu, gpuN} where "N" is a GPU number.  "gpu"
     // alone will use GPU 0.
     cfg["device"] = "cpu";
+
+    // If more than 1, concurrent calls with same input shapes are
+    // batched, up to this many at once.
+    cfg["batch_max"] = (int)m_batch_max;
+
+    // Longest time the first call of a batch waits for more.
+    cfg["batch_wait"] = m_batch_wait.count() * units::us;
     
     return cfg;
 }
@@ -73,12 +83,37 @@ void Pytorch::TorchService::configure(const WireCell::Configuration& cfg)
 
     log->debug("loaded model \"{}\" to device \"{}\"",
                model_path, m_ctx.devname());
+
+    const int batch_max = get<int>(cfg, "batch_max", m_batch_max);
+    if (batch_max < 1) {
+        THROW(ValueError() << errmsg{"TorchService: batch_max must be positive"});
+    }
+    m_batch_max = batch_max;
+    const double batch_wait = get<double>(cfg, "batch_wait", m_batch_wait.count() * units::us);
+    if (batch_wait < 0) {
+        THROW(ValueError() << errmsg{"TorchService: batch_wait must not be negative"});
+    }
+    m_batch_wait = std::chrono::microseconds((long)(batch_wait / units::us));
+    m_batchable = true;
+    if (m_batch_max > 1) {
+        log->debug("batching up to {} calls waiting at most {} us",
+                   m_batch_max, m_batch_wait.count());
+    }
 }
 
 ITensorSet::pointer Pytorch::TorchService::forward(const ITensorSet::pointer& in) const
 {
+    if (m_batch_max > 1 and m_batchable) {
+        return forward_batched(in);
+    }
+
     TorchSemaphore sem(m_ctx);
+    return forward_one(in);
+}
 
+// Caller must hold the semaphore.
+ITensorSet::pointer Pytorch::TorchService::forward_one(const ITensorSet::pointer& in) const
+{
     log->debug("running model on device: \"{}\"", m_ctx.devname());
 
     torch::NoGradGuard no_grad;
@@ -99,3 +134,137 @@ ITensorSet::pointer Pytorch::TorchService::forward(const ITensorSet::pointer& in
 
     return ret;
 }
+
+// The first caller with a given input shape starts a batch and waits for
+// others to join it until it is full or the wait is over.  It then runs the
+// whole batch and hands each caller its part of the output.
+ITensorSet::pointer Pytorch::TorchService::forward_batched(const ITensorSet::pointer& in) const
+{
+    batch_key_t key;
+    for (const auto& iten : *in->tensors()) {
+        const auto& shape = iten->shape();
+        key.push_back(shape.size());
+        key.insert(key.end(), shape.begin(), shape.end());
+    }
+
+    auto req = std::make_shared<Request>();
+    req->input = in;
+    auto output = req->output.get_future();
+
+    std::shared_ptr<batch_t> batch;
+    bool leader = false;
+    {
+        std::lock_guard<std::mutex> lock(m_batch_mutex);
+        auto& pending = m_batches[key];
+        if (!pending) {
+            pending = std::make_shared<batch_t>();
+            leader = true;
+        }
+        batch = pending;
+        batch->push_back(req);
+        if (batch->size() >= m_batch_max) {
+            m_batches.erase(key);
+            m_batch_cond.notify_all();
+        }
+    }
+
+    if (leader) {
+        {
+            std::unique_lock<std::mutex> lock(m_batch_mutex);
+            m_batch_cond.wait_for(lock, m_batch_wait,
+                                  [&]() { return batch->size() >= m_batch_max; });
+            auto it = m_batches.find(key);
+            if (it != m_batches.end() and it->second == batch) {
+                m_batches.erase(it);
+            }
+        }
+        // No more requests may join so the batch is read without the lock.
+        run_batch(*batch);
+    }
+
+    return output.get();
+}
+
+void Pytorch::TorchService::run_batch(const batch_t& batch) const
+{
+    TorchSemaphore sem(m_ctx);
+
+    const size_t nreqs = batch.size();
+    auto run_each = [&]() {
+        for (const auto& req : batch) {
+            req->output.set_value(forward_one(req->input));
+        }
+    };
+
+    try {
+        if (nreqs == 1) {
+            run_each();
+            return;
+        }
+
+        log->debug("running batch of {} on device: \"{}\"", nreqs, m_ctx.devname());
+
+        torch::NoGradGuard no_grad;
+
+        // Concatenate each input tensor over the requests.
+        std::vector<std::vector<torch::Tensor>> parts;
+        std::vector<int64_t> sizes;
+        for (const auto& req : batch) {
+            auto iival = Pytorch::from_itensor(req->input, m_ctx.is_gpu());
+            parts.resize(iival.size());
+            for (size_t ind = 0; ind < iival.size(); ++ind) {
+                parts[ind].push_back(iival[ind].toTensor());
+            }
+            sizes.push_back(iival.empty() ? 0 : parts[0].back().size(0));
+        }
+        std::vector<torch::IValue> iival;
+        for (const auto& part : parts) {
+            iival.push_back(torch::cat(part, 0));
+        }
+
+        torch::IValue oival;
+        try {
+            oival = m_module.forward(iival);
+        }
+        catch (const std::runtime_error& err) {
+            log->error("error running model batch on device \"{}\": {}",
+                       m_ctx.devname(), err.what());
+            for (const auto& req : batch) {
+                req->output.set_value(nullptr);
+            }
+            return;
+        }
+        if (not oival.isTensor()) {
+            log->warn("model output is not a single tensor, no longer batching, running {} calls one by one",
+                      nreqs);
+            m_batchable = false;
+            run_each();
+            return;
+        }
+        torch::Tensor oten = oival.toTensor();
+
+        const int64_t total = std::accumulate(sizes.begin(), sizes.end(), (int64_t)0);
+        if (oten.dim() == 0 or oten.size(0) != total) {
+            log->warn("model output does not follow input batch, running {} calls one by one", nreqs);
+            run_each();
+            return;
+        }
+
+        int64_t offset = 0;
+        for (size_t ind = 0; ind < nreqs; ++ind) {
+            auto part = oten.narrow(0, offset, sizes[ind]).contiguous();
+            offset += sizes[ind];
+            batch[ind]->output.set_value(Pytorch::to_itensor({part}));
+        }
+    }
+    catch (...) {
+        // Any caller not yet served gets the exception.
+        for (const auto& req : batch) {
+            try {
+                req->output.set_exception(std::current_exception());
+            }
+            catch (const std::future_error&) {
+            }
+        }
+    }
+}
@@ -0,0 +1,158 @@
+// Check TorchService batching against unbatched forward() calls.
+//
+// Uses extsmod.ts (see extsmod.py) which for non-positive input
+// returns weight + input, broadcasting over the leading dimensions
+// and so following the input batch.
+//
+// usage: check_torchservice_batching [path/to/extsmod.ts]
+
+#include "WireCellPytorch/TorchService.h"
+#include "WireCellAux/SimpleTensor.h"
+#include "WireCellAux/SimpleTensorSet.h"
+#include "WireCellUtil/PluginManager.h"
+#include "WireCellUtil/Units.h"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace WireCell;
+
+static int nfailed = 0;
+static void require(bool ok, const std::string& what)
+{
+    if (!ok) {
+        std::cerr << "FAILED: " << what << std::endl;
+        ++nfailed;
+    }
+}
+
+static ITensorSet::pointer make_input(const ITensor::shape_t& shape, float value)
+{
+    size_t size = 1;
+    for (auto s : shape) {
+        size *= s;
+    }
+    std::vector<float> data(size);
+    for (size_t ind = 0; ind < size; ++ind) {
+        data[ind] = -value - 0.001 * ind;  // non-positive
+    }
+    auto ten = std::make_shared<Aux::SimpleTensor>(shape, data.data());
+    auto tens = std::make_shared<ITensor::vector>(ITensor::vector{ten});
+    return std::make_shared<Aux::SimpleTensorSet>(0, Configuration(), tens);
+}
+
+static bool same(const ITensorSet::pointer& a, const ITensorSet::pointer& b)
+{
+    if (!a or !b) {
+        return false;
+    }
+    const auto& ta = *a->tensors();
+    const auto& tb = *b->tensors();
+    if (ta.size() != tb.size()) {
+        return false;
+    }
+    for (size_t ind = 0; ind < ta.size(); ++ind) {
+        if (ta[ind]->shape() != tb[ind]->shape() or ta[ind]->size() != tb[ind]->size()) {
+            return false;
+        }
+        if (std::memcmp(ta[ind]->data(), tb[ind]->data(), ta[ind]->size())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static std::shared_ptr<Pytorch::TorchService> make_service(const std::string& model, int batch_max)
+{
+    auto ts = std::make_shared<Pytorch::TorchService>();
+    auto cfg = ts->default_configuration();
+    cfg["model"] = model;
+    cfg["batch_max"] = batch_max;
+    cfg["batch_wait"] = 50 * units::ms;
+    ts->configure(cfg);
+    return ts;
+}
+
+int main(int argc, const char* argv[])
+{
+    const std::string model = argc > 1 ? argv[1] : "extsmod.ts";
+
+    PluginManager::instance().add("WireCellAux");  // for Semaphore
+
+    auto plain = make_service(model, 1);
+    auto batched = make_service(model, 4);
+
+    // Requests of two shapes differing beyond the batch dimension.
+    // Were they merged the concatenation would fail.
+    const std::vector<ITensor::shape_t> shapes{{1, 1, 10, 20}, {1, 2, 10, 20}};
+
+    const int nthreads = 8, ncalls = 5;
+    std::vector<std::vector<ITensorSet::pointer>> inputs(nthreads), want(nthreads), got(nthreads);
+    for (int ith = 0; ith < nthreads; ++ith) {
+        for (int ind = 0; ind < ncalls; ++ind) {
+            auto in = make_input(shapes[ith % 2], 1 + ith + 0.1 * ind);
+            inputs[ith].push_back(in);
+            want[ith].push_back(plain->forward(in));
+        }
+        got[ith].resize(ncalls);
+    }
+
+    std::vector<std::thread> threads;
+    for (int ith = 0; ith < nthreads; ++ith) {
+        threads.emplace_back([&, ith]() {
+            for (int ind = 0; ind < ncalls; ++ind) {
+                try {
+                    got[ith][ind] = batched->forward(inputs[ith][ind]);
+                }
+                catch (const std::exception& err) {
+                    std::cerr << "thread " << ith << " call " << ind << ": " << err.what() << std::endl;
+                }
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    for (int ith = 0; ith < nthreads; ++ith) {
+        for (int ind = 0; ind < ncalls; ++ind) {
+            require(same(want[ith][ind], got[ith][ind]),
+                    "batched output matches unbatched for thread " + std::to_string(ith)
+                    + " call " + std::to_string(ind));
+        }
+    }
+
+    // A lone request runs after batch_wait times out.
+    {
+        auto in = make_input(shapes[0], 42);
+        auto want1 = plain->forward(in);
+        const auto t0 = std::chrono::steady_clock::now();
+        auto got1 = batched->forward(in);
+        const auto dt = std::chrono::steady_clock::now() - t0;
+        require(same(want1, got1), "lone request output matches unbatched");
+        require(dt >= std::chrono::milliseconds(40), "lone request waits for batch_wait");
+    }
+
+    // An error in a batch reaches its caller as an exception.
+    {
+        auto bad = make_input({1, 10, 20}, 1);  // not 4D
+        bool threw = false;
+        try {
+            batched->forward(bad);
+        }
+        catch (...) {
+            threw = true;
+        }
+        require(threw, "error in a batch reaches the caller");
+    }
+
+    if (nfailed) {
+        std::cerr << nfailed << " checks failed" << std::endl;
+        return 1;
+    }
+    std::cout << "all checks passed" << std::endl;
+    return 0;
+}
@@ -66,13 +66,22 @@ namespace WireCell {
 
             size_t m_count{0};
 
+            // Number of threads to apply grouped filters, 0 is serial.
+            int m_nthreads{0};
+
             // This little struct, named MGCF (Multi-Group Channel Filters), is used to associate a set of
             // channels with a set of filters. See: https://github.com/WireCell/wire-cell-toolkit/issues/327
             struct MGCF {
                 std::vector<IChannelNoiseDatabase::channel_group_t> channelgroups;
                 std::vector<IChannelFilter::pointer> filters;
+                // True if no channel is in more than one group so
+                // that groups may be filtered concurrently.
+                bool disjoint{true};
             };
 
+            // Set disjoint on a newly configured MGCF.
+            void check_disjoint(MGCF& mgcf);
+
             std::vector<MGCF>  m_multigroup_chanfilters;
         };
 
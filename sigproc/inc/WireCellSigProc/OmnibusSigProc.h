@@ -8,6 +8,7 @@
 #include "WireCellIface/IAnodePlane.h"
 #include "WireCellIface/IDFT.h"
 #include "WireCellIface/IWaveform.h"
+#include "WireCellIface/IChannelResponse.h"
 
 #include "WireCellUtil/Waveform.h"
 #include "WireCellUtil/Array.h"
@@ -35,7 +36,7 @@ namespace WireCell {
             void load_data(const input_pointer& in, int plane);
 
             // deconvolution
-            void decon_2D_init(int plane);  // main decon code
+            void decon_2D_init(int plane, bool filter_response);  // main decon code
             void decon_2D_ROI_refine(int plane);
             void decon_2D_tightROI(int plane);
             void decon_2D_tighterROI(int plane);
@@ -74,6 +75,17 @@ namespace WireCell {
             // initialize the overall response function ...
             void init_overall_response(IFrame::pointer frame);
 
+            // Return the 2D spectrum of the overall response of a
+            // plane for data with nrows, optionally with the
+            // "filter_responses" applied.  Cached until the overall
+            // response changes.
+            const Array::array_xxc& response_spectrum(int plane, int nrows, bool filter_response);
+
+            // Return the per-channel electronics response correction
+            // of a plane as a multiplicative spectrum of the given
+            // shape.  Cached until the overall response changes.
+            const Array::array_xxc& channel_correction(int plane, int nrows, int ncols);
+
             void restore_baseline(WireCell::Array::array_xxf& arr);
 	    void rebase_waveform(WireCell::Array::array_xxf& arr, const int& nbins);
             // This little struct is used to map between WCT channel idents
@@ -105,6 +117,8 @@ namespace WireCell {
             std::string m_anode_tn{"AnodePlane"};
             IAnodePlane::pointer m_anode;
             std::string m_per_chan_resp{"PerChannelResponse"};
+            // Resolved in configure() so planes may run in parallel.
+            IChannelResponse::pointer m_per_chan_resp_ptr;
             std::string m_field_response{"FieldResponse"};
 
             // Overall time offset.  must be positive, between 0-0.5
@@ -222,8 +236,16 @@ namespace WireCell {
 
             // average overall responses
             std::vector<Waveform::realseq_t> overall_resp[3];
+            // the period and number of ticks for which they were made
+            double m_resp_period{0};
+            int m_resp_nticks{0};
+            // cached spectra derived from them, see response_spectrum()
+            // and channel_correction().
+            Array::array_xxc m_resp_spectrum[3][2];
+            Array::array_xxc m_channel_correction[3];
             // filters for overall responses
             std::vector<std::string> m_filter_resps_tn{};
+            std::vector<IChannelResponse::pointer> m_filter_resps{};
 
             // tag name for traces
             std::string m_wiener_tag{"wiener"};
@@ -264,6 +286,7 @@ namespace WireCell {
 
             size_t m_count{0};
             int m_verbose{0};
+            int m_nthreads{0};
 
             IDFT::pointer m_dft;
 
@@ -8,11 +8,14 @@
 #include "WireCellAux/SimpleTrace.h"
 
 #include "WireCellUtil/NamedFactory.h"
+#include "WireCellUtil/Exceptions.h"
+#include "WireCellUtil/Parallel.h"
 // #include "WireCellUtil/ExecMon.h" // debugging
 
 #include "WireCellAux/FrameTools.h"
 
 #include <unordered_map>
+#include <unordered_set>
 
 WIRECELL_FACTORY(OmnibusNoiseFilter,
                  WireCell::SigProc::OmnibusNoiseFilter,
@@ -76,6 +79,7 @@ void OmnibusNoiseFilter::configure(const WireCell::Configuration& cfg)
             log->debug("adding grouped filter: {} \"{}\"", mgcf.filters.size(), jf.asString());
             mgcf.filters.push_back(filt);
         }
+        check_disjoint(mgcf);
         m_multigroup_chanfilters.push_back(mgcf);
     }
 
@@ -94,13 +98,35 @@ void OmnibusNoiseFilter::configure(const WireCell::Configuration& cfg)
             log->debug("adding grouped filter: {} \"{}\"", mgcf.filters.size(), jf.asString());
             mgcf.filters.push_back(filt);
         }
+        check_disjoint(mgcf);
         m_multigroup_chanfilters.push_back(mgcf);
     }
 
+    m_nthreads = get(cfg, "nthreads", m_nthreads);
+    if (m_nthreads < 0) {
+        std::string msg = "nthreads must not be negative";
+        log->error(msg);
+        THROW(ValueError() << errmsg{"OmnibusNoiseFilter: " + msg});
+    }
+
     m_intag = get(cfg, "intraces", m_intag);
     m_outtag = get(cfg, "outtraces", m_outtag);
 }
 
+void OmnibusNoiseFilter::check_disjoint(MGCF& mgcf)
+{
+    std::unordered_set<int> seen;
+    for (const auto& group : mgcf.channelgroups) {
+        for (int ch : group) {
+            if (!seen.insert(ch).second) {
+                log->debug("channel {} is in more than one group, groups will be filtered serially", ch);
+                mgcf.disjoint = false;
+                return;
+            }
+        }
+    }
+}
+
 WireCell::Configuration OmnibusNoiseFilter::default_configuration() const
 {
     Configuration cfg;
@@ -119,6 +145,12 @@ WireCell::Configuration OmnibusNoiseFilter::default_configuration() const
     // The tags for input and output traces
     cfg["intraces"] = m_intag;
     cfg["outtraces"] = m_outtag;
+
+    // If nonzero, apply grouped filters to up to this many channel
+    // groups at once.  The filters and the noise database must then
+    // be safe to call from multiple threads (SimpleChannelNoiseDB is
+    // not).  Groups sharing channels are always filtered serially.
+    cfg["nthreads"] = m_nthreads;
     return cfg;
 }
 
@@ -156,6 +188,7 @@ bool OmnibusNoiseFilter::operator()(const input_pointer& inframe, output_pointer
 
     // Get the ones from database and then merge
     std::vector<int> bad_channels = m_noisedb->bad_channels();
+    const std::unordered_set<int> bad_chanset(bad_channels.begin(), bad_channels.end());
     {
         Waveform::BinRange bad_bins;
         bad_bins.first = 0;
@@ -182,7 +215,7 @@ bool OmnibusNoiseFilter::operator()(const input_pointer& inframe, output_pointer
         bychan[ch] = signal;
 
         // if good
-        if (find(bad_channels.begin(), bad_channels.end(), ch) == bad_channels.end()) {
+        if (bad_chanset.find(ch) == bad_chanset.end()) {
             auto const& charge = trace->charge();
             const size_t ncharges = charge.size();
 
@@ -213,34 +246,53 @@ bool OmnibusNoiseFilter::operator()(const input_pointer& inframe, output_pointer
     // int group_counter = 0;
     int nunknownchans = 0;
     for (const auto& mgcf : m_multigroup_chanfilters) {
-        for (auto group : mgcf.channelgroups) {
+        std::vector<const IChannelNoiseDatabase::channel_group_t*> groups;
+        for (const auto& group : mgcf.channelgroups) {
 
             int flag = 1;
-
-            IChannelFilter::channel_signals_t chgrp;
             for (auto ch : group) {  // fix me: check if we don't actually have this channel
                                     // std::cout << group_counter << " " << ch << " " << std::endl;
                 if (bychan.find(ch) == bychan.end()) {
                     ++nunknownchans;
                     flag = 0;
                 }
-                else {
-                    chgrp[ch] = bychan[ch]->charge();  // copy...
-                }
             }
             if (flag == 0) continue;
 
+            groups.push_back(&group);
+        }
+
+        // Masks from each filter on each group, merged below in
+        // order.
+        std::vector<std::vector<Waveform::ChannelMaskMap>> group_masks(groups.size());
+
+        auto filter_group = [&](size_t igrp) {
+            // Move the waveforms into the group and back, no copies.
+            IChannelFilter::channel_signals_t chgrp;
+            for (auto ch : *groups[igrp]) {
+                auto it = chgrp.emplace(ch, IChannelFilter::signal_t());
+                if (it.second) {
+                    it.first->second.swap(bychan.at(ch)->charge());
+                }
+            }
+
             for (auto filter : mgcf.filters) {
-                auto masks = filter->apply(chgrp);
-                Waveform::merge(cmm, masks, m_maskmap);
+                group_masks[igrp].push_back(filter->apply(chgrp));
             }
 
-            for (auto cs : chgrp) {
-                // cs.second; // copy
-                bychan[cs.first]->charge().assign(cs.second.begin(), cs.second.end());
+            for (auto& cs : chgrp) {
+                bychan.at(cs.first)->charge().swap(cs.second);
             }
+        };
+
+        const size_t nthreads = mgcf.disjoint ? m_nthreads : 0;
+        Parallel::for_each(groups.size(), filter_group, nthreads);
 
-        } // end of channel groups
+        for (auto& masks : group_masks) {
+            for (auto& mask : masks) {
+                Waveform::merge(cmm, mask, m_maskmap);
+            }
+        }
 
     } // end of MGCF
 
@@ -17,10 +17,13 @@
 #include "WireCellUtil/Exceptions.h"
 #include "WireCellUtil/String.h"
 #include "WireCellUtil/FFTBestLength.h"
+#include "WireCellUtil/Parallel.h"
 #include "WireCellUtil/Waveform.h"
 
 #include "WireCellUtil/NamedFactory.h"
 
+#include <functional>
+
 WIRECELL_FACTORY(OmnibusSigProc, WireCell::SigProc::OmnibusSigProc,
                  WireCell::INamed,
                  WireCell::IFrameFilter, WireCell::IConfigurable)
@@ -62,6 +65,7 @@ void OmnibusSigProc::configure(const WireCell::Configuration& config)
     std::string dft_tn = get<std::string>(config, "dft", "FftwDFT");
     m_dft = Factory::find_tn<IDFT>(dft_tn);
     m_verbose = get(config, "verbose", 0);
+    m_nthreads = get(config, "nthreads", m_nthreads);
 
     // m_nticks = get(config,"nticks",m_nticks);
     if (!config["nticks"].isNull()) {
@@ -85,6 +89,7 @@ void OmnibusSigProc::configure(const WireCell::Configuration& config)
 
     m_per_chan_resp = get(config, "per_chan_resp", m_per_chan_resp);
     m_field_response = get(config, "field_response", m_field_response);
+    m_resp_nticks = 0;          // remake responses on next frame
 
     m_th_factor_ind = get(config, "troi_ind_th_factor", m_th_factor_ind);
     m_th_factor_col = get(config, "troi_col_th_factor", m_th_factor_col);
@@ -214,6 +219,21 @@ void OmnibusSigProc::configure(const WireCell::Configuration& config)
     //
     m_elecresponse = Factory::find_tn<IWaveform>(m_elecresponse_tn);
 
+    // Channel responses are resolved here as factory lookups are not
+    // safe to make from the per-plane threads.
+    m_per_chan_resp_ptr = nullptr;
+    if (!m_per_chan_resp.empty()) {
+        m_per_chan_resp_ptr = Factory::find_tn<IChannelResponse>(m_per_chan_resp);
+    }
+    m_filter_resps.clear();
+    for (const auto& tn : m_filter_resps_tn) {
+        m_filter_resps.push_back(Factory::find_tn<IChannelResponse>(tn));
+    }
+    // The filters are found by name per plane.  Resolving their
+    // factories now leaves those later lookups as only reads.
+    Factory::lookup_factory<IFilterWaveform>("HfFilter");
+    Factory::lookup_factory<IFilterWaveform>("LfFilter");
+
     // Build up the channel map.  The OSP channel must run contiguously
     // first up the U, then V, then W "wires".  Ie, face-major order,
     // but we have plane-major order so make a temporary collection.
@@ -358,6 +378,11 @@ WireCell::Configuration OmnibusSigProc::default_configuration() const
 
     cfg["sparse"] = false;
 
+    // If zero, process planes serially.  Otherwise, the per-plane
+    // deconvolution and ROI finding run on up to this many threads.
+    // The output does not depend on this number.
+    cfg["nthreads"] = m_nthreads;
+
     return cfg;
 }
 
@@ -372,10 +397,11 @@ void OmnibusSigProc::load_data(const input_pointer& in, int plane)
 
     for (auto trace : *traces.get()) {
         int wct_channel_ident = trace->channel();
-        OspChan och = m_channel_map[wct_channel_ident];
-        if (plane != och.plane) {
+        auto chit = m_channel_map.find(wct_channel_ident);
+        if (chit == m_channel_map.end() or plane != chit->second.plane) {
             continue;  // we'll catch it in another call to load_data
         }
+        const OspChan& och = chit->second;
 
         // fixme: this code uses tbin() but other places in this file will barf if tbin!=0.
         int tbin = trace->tbin();
@@ -797,6 +823,12 @@ void OmnibusSigProc::init_overall_response(IFrame::pointer frame)
         m_pad_nticks = m_fft_nticks - m_nticks;
     }
 
+    if (m_resp_nticks == m_fft_nticks and m_resp_period == m_period) {
+        log->debug("call={} reuse overall response for nticks={} period={}",
+                   m_count, m_resp_nticks, m_resp_period);
+        return;
+    }
+
     // Fixme: this should be moved into configure()
     auto ifr = Factory::find_tn<IFieldResponse>(m_field_response);
     // Get full, "fine-grained" field responses defined at impact
@@ -927,7 +959,85 @@ void OmnibusSigProc::init_overall_response(IFrame::pointer frame)
         // calculated the wire shift ...
         m_wire_shift[iplane] = (int(overall_resp[iplane].size()) - 1) / 2;
 
+        // forget anything derived from the old response
+        m_resp_spectrum[iplane][0].resize(0, 0);
+        m_resp_spectrum[iplane][1].resize(0, 0);
+        m_channel_correction[iplane].resize(0, 0);
     }  //  loop over plane
+
+    m_resp_nticks = m_fft_nticks;
+    m_resp_period = m_period;
+}
+
+const Array::array_xxc& OmnibusSigProc::response_spectrum(int plane, int nrows, bool filter_response)
+{
+    auto& c_resp = m_resp_spectrum[plane][filter_response ? 1 : 0];
+    if (c_resp.rows() == nrows and c_resp.cols() == m_fft_nticks) {
+        return c_resp;
+    }
+
+    Array::array_xxf r_resp = Array::array_xxf::Zero(nrows, m_fft_nticks);
+    for (size_t i = 0; i != overall_resp[plane].size(); i++) {
+        for (int j = 0; j != m_fft_nticks; j++) {
+            r_resp(i, j) = overall_resp[plane].at(i).at(j);
+        }
+    }
+
+    // additional filters for overall resposne
+    if (filter_response) {
+        const auto& fltresp = m_filter_resps.at(plane);
+        for (size_t i = 0; i != overall_resp[plane].size(); i++) {
+            const Waveform::realseq_t& flt = fltresp->channel_response(i); // filter at wire: i
+            for (int j = 0; j != std::min<int>(m_fft_nticks, flt.size()); j++) {
+                r_resp(i, j) *= flt.at(j);
+            }
+        }
+    }
+
+    // do first round FFT on the resposne on time
+    c_resp = fwd_r2c(m_dft, r_resp, 1);
+    // do second round FFT on the response on wire
+    c_resp = fwd(m_dft, c_resp, 0);
+    return c_resp;
+}
+
+const Array::array_xxc& OmnibusSigProc::channel_correction(int plane, int nrows, int ncols)
+{
+    auto& corr = m_channel_correction[plane];
+    if (corr.rows() == nrows and corr.cols() == ncols) {
+        return corr;
+    }
+
+    const auto& cr = m_per_chan_resp_ptr;
+    auto cr_bins = cr->channel_response_binning();
+    if (cr_bins.binsize() != m_period) {
+        log->critical("call={} decon_2D_init: channel response size mismatch", m_count);
+        THROW(ValueError() << errmsg{"OmnibusSigProc::decon_2D_init: channel response size mismatch"});
+    }
+
+    WireCell::Binning tbins(m_fft_nticks, cr_bins.min(), cr_bins.min() + m_fft_nticks * m_period);
+
+    auto ewave = (*m_elecresponse).waveform_samples(tbins);
+    const WireCell::Waveform::compseq_t elec = fwd_r2c(m_dft, ewave);
+
+    corr = Array::array_xxc::Ones(nrows, ncols);
+    for (auto och : m_channel_range[plane]) {
+        Waveform::realseq_t tch_resp = cr->channel_response(och.ident);
+        tch_resp.resize(m_fft_nticks, 0);
+        const WireCell::Waveform::compseq_t ch_elec = fwd_r2c(m_dft, tch_resp);
+
+        const int irow = och.wire + m_pad_nwires[plane];
+        for (int icol = 0; icol != ncols; icol++) {
+            const auto four = ch_elec.at(icol);
+            if (std::abs(four) != 0) {
+                corr(irow, icol) = elec.at(icol) / four;
+            }
+            else {
+                corr(irow, icol) = 0;
+            }
+        }
+    }
+    return corr;
 }
 
 void OmnibusSigProc::restore_baseline(Array::array_xxf& arr)
@@ -1012,7 +1122,7 @@ void OmnibusSigProc::rebase_waveform(Array::array_xxf& arr,const int& n_bins)
 
 
 
-void OmnibusSigProc::decon_2D_init(int plane)
+void OmnibusSigProc::decon_2D_init(int plane, bool filter_response)
 {
     // data part ...
     //Pad the data if needed.
@@ -1023,54 +1133,16 @@ void OmnibusSigProc::decon_2D_init(int plane)
     m_c_data[plane] = fwd_r2c(m_dft, m_r_data[plane], 1);
 
     // now apply the ch-by-ch response ...
-    if (!m_per_chan_resp.empty()) {
+    if (m_per_chan_resp_ptr) {
         log->debug("call={} applying ch-by-ch electronics response correction", m_count);
-        auto cr = Factory::find_tn<IChannelResponse>(m_per_chan_resp);
-        auto cr_bins = cr->channel_response_binning();
-        if (cr_bins.binsize() != m_period) {
-            log->critical("call={} decon_2D_init: channel response size mismatch", m_count);
-            THROW(ValueError() << errmsg{"OmnibusSigProc::decon_2D_init: channel response size mismatch"});
-        }
-
-        WireCell::Binning tbins(m_fft_nticks, cr_bins.min(), cr_bins.min() + m_fft_nticks * m_period);
-
-        auto ewave = (*m_elecresponse).waveform_samples(tbins);
-        const WireCell::Waveform::compseq_t elec = fwd_r2c(m_dft, ewave);
-
-        for (auto och : m_channel_range[plane]) {
-            // const auto& ch_resp = cr->channel_response(och.ident);
-            Waveform::realseq_t tch_resp = cr->channel_response(och.ident);
-            tch_resp.resize(m_fft_nticks, 0);
-            const WireCell::Waveform::compseq_t ch_elec = fwd_r2c(m_dft, tch_resp);
-
-            const int irow = och.wire + m_pad_nwires[plane];
-            for (int icol = 0; icol != m_c_data[plane].cols(); icol++) {
-                const auto four = ch_elec.at(icol);
-                if (std::abs(four) != 0) {
-                    m_c_data[plane](irow, icol) *= elec.at(icol) / four;
-                }
-                else {
-                    m_c_data[plane](irow, icol) = 0;
-                }
-            }
-        }
+        m_c_data[plane] *= channel_correction(plane, m_c_data[plane].rows(), m_c_data[plane].cols());
     }
 
     // second round of FFT on wire
     m_c_data[plane] = fwd(m_dft, m_c_data[plane], 0);
 
     // response part ...
-    Array::array_xxf r_resp = Array::array_xxf::Zero(m_r_data[plane].rows(), m_fft_nticks);
-    for (size_t i = 0; i != overall_resp[plane].size(); i++) {
-        for (int j = 0; j != m_fft_nticks; j++) {
-            r_resp(i, j) = overall_resp[plane].at(i).at(j);
-        }
-    }
-
-    // do first round FFT on the resposne on time
-    Array::array_xxc c_resp = fwd_r2c(m_dft, r_resp, 1);
-    // do second round FFT on the response on wire
-    c_resp = fwd(m_dft, c_resp, 0);
+    const Array::array_xxc& c_resp = response_spectrum(plane, m_r_data[plane].rows(), filter_response);
 
     // make ratio to the response and apply wire filter
     m_c_data[plane] = m_c_data[plane] / c_resp;
@@ -1484,7 +1556,11 @@ bool OmnibusSigProc::masked_neighbors(const std::string& cmname, OspChan& ochan,
         return false;
     }
 
-    auto& cm = m_wanmm[cmname];
+    auto cmit = m_wanmm.find(cmname);
+    if (cmit == m_wanmm.end()) {
+        return false;
+    }
+    const auto& cm = cmit->second;
     for (int och = lo_chan; och <= hi_chan; ++och) {
         if (cm.find(och) != cm.end()) {
             return true;
@@ -1562,6 +1638,39 @@ void OmnibusSigProc::decon_2D_charge(int plane)
     }
 }
 
+namespace {
+    // Output traces and their tagged indices.  Planes which are
+    // processed in parallel each fill their own and these are
+    // appended in plane order so the output does not depend on
+    // threading.
+    struct OspTraces {
+        ITrace::vector traces;
+        IFrame::trace_summary_t thresholds;  // for wiener
+        IFrame::trace_list_t wiener, gauss, decon_charge;
+        // debug mode
+        IFrame::trace_list_t tight_lf, loose_lf, cleanup_roi, break_roi_loop1, break_roi_loop2,
+            shrink_roi, extend_roi, mp2_roi, mp3_roi;
+
+        void append(const OspTraces& other)
+        {
+            static const std::vector<IFrame::trace_list_t OspTraces::*> lists = {
+                &OspTraces::wiener, &OspTraces::gauss, &OspTraces::decon_charge,
+                &OspTraces::tight_lf, &OspTraces::loose_lf, &OspTraces::cleanup_roi,
+                &OspTraces::break_roi_loop1, &OspTraces::break_roi_loop2, &OspTraces::shrink_roi,
+                &OspTraces::extend_roi, &OspTraces::mp2_roi, &OspTraces::mp3_roi};
+
+            const size_t offset = traces.size();
+            traces.insert(traces.end(), other.traces.begin(), other.traces.end());
+            thresholds.insert(thresholds.end(), other.thresholds.begin(), other.thresholds.end());
+            for (auto list : lists) {
+                for (size_t ind : other.*list) {
+                    (this->*list).push_back(ind + offset);
+                }
+            }
+        }
+    };
+}
+
 bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
 {
     out = nullptr;
@@ -1599,14 +1708,7 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
         }
     }
 
-    ITrace::vector* itraces = new ITrace::vector;  // will become shared_ptr.
-    IFrame::trace_summary_t thresholds;
-    IFrame::trace_list_t wiener_traces, gauss_traces;
-    // here are some trace lists for debug mode
-    IFrame::trace_list_t tight_lf_traces, loose_lf_traces, cleanup_roi_traces, break_roi_loop1_traces,
-        break_roi_loop2_traces, shrink_roi_traces, extend_roi_traces;
-    IFrame::trace_list_t mp2_roi_traces, mp3_roi_traces;
-    IFrame::trace_list_t decon_charge_traces;
+    OspTraces ot;
 
     // initialize the overall response function ...
     init_overall_response(in);
@@ -1623,27 +1725,35 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
     const std::vector<float>* perplane_thresholds[3] = {&roi_form.get_uplane_rms(), &roi_form.get_vplane_rms(),
                                                         &roi_form.get_wplane_rms()};
 
+    std::vector<int> planes;
     for (int iplane = 0; iplane != 3; ++iplane) {
         auto it = std::find(m_process_planes.begin(), m_process_planes.end(), iplane);
         if (it == m_process_planes.end()) continue;
+        planes.push_back(iplane);
+    }
+
+    // Per-plane traces, appended to the output in plane order.
+    OspTraces plane_traces[3];
+
+    // Call func(iplane) on each plane, possibly in parallel.  The
+    // function may only touch per-plane data.
+    auto for_each_plane = [&](std::function<void(int)> func) {
+        Parallel::for_each(planes.size(), [&](size_t ind) { func(planes[ind]); }, m_nthreads);
+        for (int iplane : planes) {
+            ot.append(plane_traces[iplane]);
+            plane_traces[iplane] = OspTraces();
+        }
+    };
+
+    for_each_plane([&](int iplane) {
+        auto& pt = plane_traces[iplane];
         const std::vector<float>& perwire_rmses = *perplane_thresholds[iplane];
 
         // load data into EIGEN matrices ...
         load_data(in, iplane);  // load into a large matrix
-        // initial decon ...
-                
-        // additional filters for overall resposne
-        if (!m_filter_resps_tn.empty()) {
-            for (size_t i = 0; i != overall_resp[iplane].size(); i++) {
-                auto fltresp = Factory::find_tn<IChannelResponse>(m_filter_resps_tn[iplane]);
-                const Waveform::realseq_t& flt = fltresp->channel_response(i); // filter at wire: i
-                for (int j = 0; j != std::min<int>(m_fft_nticks, flt.size()); j++) {
-                    overall_resp[iplane].at(i).at(j) *= flt.at(j); 
-                }
-            }
-        }
-
-        decon_2D_init(iplane);  // decon in large matrix
+        // initial decon, with the additional filters for overall
+        // response if any.
+        decon_2D_init(iplane, !m_filter_resps_tn.empty());  // decon in large matrix
         check_data(iplane, "after 2D init");
 
         // Form tight ROIs
@@ -1666,7 +1776,7 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
         std::vector<double> dummy;
         // [wgu] save decon result after tight LF
         if (m_use_roi_debug_mode and !m_tight_lf_tag.empty()) {
-            save_data(*itraces, tight_lf_traces, iplane, perwire_rmses, dummy, "tight_lf", true);
+            save_data(pt.traces, pt.tight_lf, iplane, perwire_rmses, dummy, "tight_lf", true);
         }
 
         // Form loose ROIs
@@ -1675,7 +1785,7 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
             if (m_use_roi_debug_mode) {
                 decon_2D_looseROI_debug_mode(iplane);
                 if (!m_loose_lf_tag.empty()) {
-                    save_data(*itraces, loose_lf_traces, iplane, perwire_rmses, dummy, "loose_lf", true);
+                    save_data(pt.traces, pt.loose_lf, iplane, perwire_rmses, dummy, "loose_lf", true);
                 }
             }
 
@@ -1690,38 +1800,39 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
         // but save something to be consistent
         if (m_use_roi_debug_mode and iplane == 2) {
             if (!m_loose_lf_tag.empty()) {
-                save_data(*itraces, loose_lf_traces, iplane, perwire_rmses, dummy, "loose_lf", true);
+                save_data(pt.traces, pt.loose_lf, iplane, perwire_rmses, dummy, "loose_lf", true);
             }
         }
 
         check_data(iplane, "after 2D ROI refine");
 
-        // Refine ROIs
-        if (m_use_roi_refinement) roi_refine.load_data(iplane, m_r_data[iplane], roi_form);
-        else {
+        if (!m_use_roi_refinement) {
             /// TODO: streamline the logics
             // special case to dump decon without needs of ROIs
             if (m_use_roi_debug_mode and !m_decon_charge_tag.empty()) {
                 decon_2D_charge(iplane);
-                save_data(*itraces, decon_charge_traces, iplane, perwire_rmses, dummy, "decon", true);
+                save_data(pt.traces, pt.decon_charge, iplane, perwire_rmses, dummy, "decon", true);
             }
             m_c_data[iplane].resize(0, 0);  // clear memory
             m_r_data[iplane].resize(0, 0);  // clear memory
         }
-    }
+    });
 
     if (m_use_roi_refinement) {
-        for (int iplane = 0; iplane != 3; ++iplane) {
-            auto it = std::find(m_process_planes.begin(), m_process_planes.end(), iplane);
-            if (it == m_process_planes.end()) continue;
+        // Refine ROIs.  ROI_refinement is shared by all planes so
+        // from here to the final decon planes are done in order.
+        for (int iplane : planes) {
+            roi_refine.load_data(iplane, m_r_data[iplane], roi_form);
+        }
 
+        for (int iplane : planes) {
             // roi_refine.refine_data(iplane, roi_form);
 
             roi_refine.CleanUpROIs(iplane);
             roi_refine.generate_merge_ROIs(iplane);
 
             if (m_use_roi_debug_mode and !m_cleanup_roi_tag.empty()) {
-                save_roi(*itraces, cleanup_roi_traces, iplane, roi_refine.get_rois_by_plane(iplane));
+                save_roi(ot.traces, ot.cleanup_roi, iplane, roi_refine.get_rois_by_plane(iplane));
             }
 
             if (m_use_multi_plane_protection) {
@@ -1733,8 +1844,8 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
                     // mp2: 2 plane protection based on cleaup ROI
                     roi_refine.MP2ROI(iplane, m_anode, f, m_roi_ch_ch_ident, roi_form, m_mp_th1, m_mp_th2, m_mp_tick_resolution, 2, 2, m_plane2layer, m_MP_feature_val_method);
                 }
-                save_mproi(*itraces, mp3_roi_traces, iplane, roi_refine.get_mp3_rois());
-                save_mproi(*itraces, mp2_roi_traces, iplane, roi_refine.get_mp2_rois());
+                save_mproi(ot.traces, ot.mp3_roi, iplane, roi_refine.get_mp3_rois());
+                save_mproi(ot.traces, ot.mp2_roi, iplane, roi_refine.get_mp2_rois());
                 if (m_do_not_mp_protect_traditional) {
                     // clear mp after saving to itraces
                     roi_refine.get_mp3_rois().clear();
@@ -1743,11 +1854,8 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
             }
         }
 
-        for (int iplane = 0; iplane != 3; ++iplane) {
-            auto it = std::find(m_process_planes.begin(), m_process_planes.end(), iplane);
-            if (it == m_process_planes.end()) continue;
-
-            const std::vector<float>& perwire_rmses = *perplane_thresholds[iplane];
+        for (int iplane : planes) {
+            auto& pt = plane_traces[iplane];
 
             for (int qx = 0; qx != m_r_break_roi_loop; qx++) {
                 roi_refine.BreakROIs(iplane, roi_form);
@@ -1755,10 +1863,10 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
                 roi_refine.CleanUpROIs(iplane);
                 if (m_use_roi_debug_mode) {
                     if (qx == 0 and !m_break_roi_loop1_tag.empty()) {
-                        save_roi(*itraces, break_roi_loop1_traces, iplane, roi_refine.get_rois_by_plane(iplane));
+                        save_roi(pt.traces, pt.break_roi_loop1, iplane, roi_refine.get_rois_by_plane(iplane));
                     }
                     if (qx == 1 and !m_break_roi_loop2_tag.empty()) {
-                        save_roi(*itraces, break_roi_loop2_traces, iplane, roi_refine.get_rois_by_plane(iplane));
+                        save_roi(pt.traces, pt.break_roi_loop2, iplane, roi_refine.get_rois_by_plane(iplane));
                     }
                 }
             }
@@ -1769,7 +1877,7 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
             check_data(iplane, "after roi refine check");
             roi_refine.CleanUpROIs(iplane);
             if (m_use_roi_debug_mode and !m_shrink_roi_tag.empty()) {
-                save_roi(*itraces, shrink_roi_traces, iplane, roi_refine.get_rois_by_plane(iplane));
+                save_roi(pt.traces, pt.shrink_roi, iplane, roi_refine.get_rois_by_plane(iplane));
             }
 
             if (iplane == 2) {
@@ -1784,8 +1892,14 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
             check_data(iplane, "after roi refine extend");
 
             if (m_use_roi_debug_mode and !m_extend_roi_tag.empty()) {
-                save_ext_roi(*itraces, extend_roi_traces, iplane, roi_refine.get_rois_by_plane(iplane));
+                save_ext_roi(pt.traces, pt.extend_roi, iplane, roi_refine.get_rois_by_plane(iplane));
             }
+        }
+
+        // The final decon only reads the refined ROIs.
+        for_each_plane([&](int iplane) {
+            auto& pt = plane_traces[iplane];
+            const std::vector<float>& perwire_rmses = *perplane_thresholds[iplane];
 
             // merge results ...
             decon_2D_hits(iplane);
@@ -1794,38 +1908,30 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
             check_data(iplane, "after roi refine apply");
             // roi_form.apply_roi(iplane, m_r_data[plane],1);
             if (!m_wiener_tag.empty()) {
-                // We only use an intermediate index list here to give
-                // some clarity to log msg about range added
-                IFrame::trace_list_t perframe;
-                save_data(*itraces, perframe, iplane, perwire_rmses, thresholds, "wiener", m_save_negative_charge);
-                wiener_traces.insert(wiener_traces.end(), perframe.begin(), perframe.end());
+                save_data(pt.traces, pt.wiener, iplane, perwire_rmses, pt.thresholds, "wiener", m_save_negative_charge);
             }
 
             if (!m_filter_resps_tn.empty()) {
-                // reload data and field response
-                init_overall_response(in);
+                // reload data and redo decon without the additional
+                // response filters
                 load_data(in, iplane); 
-                decon_2D_init(iplane);  // decon in large matrix
+                decon_2D_init(iplane, false);  // decon in large matrix
             }
 
             decon_2D_charge(iplane);
             std::vector<double> dummy_thresholds;
             if (m_use_roi_debug_mode and !m_decon_charge_tag.empty()) {
-                save_data(*itraces, decon_charge_traces, iplane, perwire_rmses, dummy_thresholds, "decon", true);
+                save_data(pt.traces, pt.decon_charge, iplane, perwire_rmses, dummy_thresholds, "decon", true);
             }
             roi_refine.apply_roi(iplane, m_r_data[iplane]);
             // roi_form.apply_roi(iplane, m_r_data[plane],1);
             if (!m_gauss_tag.empty()) {
-                // We only use an intermediate index list here to give
-                // some clarity to log msg about range added
-                IFrame::trace_list_t perframe;
-                save_data(*itraces, perframe, iplane, perwire_rmses, dummy_thresholds, "gauss", m_save_negative_charge);
-                gauss_traces.insert(gauss_traces.end(), perframe.begin(), perframe.end());
+                save_data(pt.traces, pt.gauss, iplane, perwire_rmses, dummy_thresholds, "gauss", m_save_negative_charge);
             }
 
             m_c_data[iplane].resize(0, 0);  // clear memory
             m_r_data[iplane].resize(0, 0);  // clear memory
-        } // loop over planes
+        }); // loop over planes
     } // m_use_roi_refinement
 
     // clear the overall response
@@ -1833,7 +1939,9 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
     //     overall_resp[i].clear();
     // }
 
-    auto sframe = new Aux::SimpleFrame(in->ident(), in->time(), ITrace::shared_vector(itraces), in->tick(), in->masks());
+    const size_t nout = ot.traces.size();
+    auto sframe = new Aux::SimpleFrame(in->ident(), in->time(), std::make_shared<ITrace::vector>(std::move(ot.traces)),
+                                       in->tick(), in->masks());
     sframe->tag_frame(m_frame_tag);
 
     // this assumes save_data produces itraces in OSP channel order
@@ -1852,52 +1960,52 @@ bool OmnibusSigProc::operator()(const input_pointer& in, output_pointer& out)
 
     if (m_use_roi_refinement) {
         if (!m_wiener_tag.empty()) {
-            sframe->tag_traces(m_wiener_tag, wiener_traces, thresholds);
+            sframe->tag_traces(m_wiener_tag, ot.wiener, ot.thresholds);
         }
         if (!m_gauss_tag.empty()) {
-            sframe->tag_traces(m_gauss_tag, gauss_traces);
+            sframe->tag_traces(m_gauss_tag, ot.gauss);
         }
     }
 
     if (m_use_roi_debug_mode) {
         if (!m_loose_lf_tag.empty()) {
-            sframe->tag_traces(m_loose_lf_tag, loose_lf_traces);
+            sframe->tag_traces(m_loose_lf_tag, ot.loose_lf);
         }
         if(!m_decon_charge_tag.empty()) {
-            sframe->tag_traces(m_decon_charge_tag, decon_charge_traces);
+            sframe->tag_traces(m_decon_charge_tag, ot.decon_charge);
         }
         if(!m_tight_lf_tag.empty()) {
-            sframe->tag_traces(m_tight_lf_tag, tight_lf_traces);
+            sframe->tag_traces(m_tight_lf_tag, ot.tight_lf);
         }
         if (!m_cleanup_roi_tag.empty()) {
-            sframe->tag_traces(m_cleanup_roi_tag, cleanup_roi_traces);
+            sframe->tag_traces(m_cleanup_roi_tag, ot.cleanup_roi);
         }
         if(!m_break_roi_loop1_tag.empty()) {
-            sframe->tag_traces(m_break_roi_loop1_tag, break_roi_loop1_traces);
+            sframe->tag_traces(m_break_roi_loop1_tag, ot.break_roi_loop1);
         }
         if (!m_break_roi_loop2_tag.empty()) {
-            sframe->tag_traces(m_break_roi_loop2_tag, break_roi_loop2_traces);
+            sframe->tag_traces(m_break_roi_loop2_tag, ot.break_roi_loop2);
         }
         if (!m_shrink_roi_tag.empty()) {
-            sframe->tag_traces(m_shrink_roi_tag, shrink_roi_traces);
+            sframe->tag_traces(m_shrink_roi_tag, ot.shrink_roi);
         }
         if (!m_extend_roi_tag.empty()) {
-            sframe->tag_traces(m_extend_roi_tag, extend_roi_traces);
+            sframe->tag_traces(m_extend_roi_tag, ot.extend_roi);
         }
     }
 
     if (m_use_multi_plane_protection) {
-        sframe->tag_traces(m_mp3_roi_tag, mp3_roi_traces);
-        sframe->tag_traces(m_mp2_roi_tag, mp2_roi_traces);
+        sframe->tag_traces(m_mp3_roi_tag, ot.mp3_roi);
+        sframe->tag_traces(m_mp2_roi_tag, ot.mp2_roi);
     }
 
     log->debug("call={} produce {} "
                "traces: {} {}, {} {}, {} {}, frame tag: {}",
                m_count,
-               itraces->size(),
-               wiener_traces.size(), m_wiener_tag,
-               decon_charge_traces.size(), m_decon_charge_tag,
-               gauss_traces.size(), m_gauss_tag,
+               nout,
+               ot.wiener.size(), m_wiener_tag,
+               ot.decon_charge.size(), m_decon_charge_tag,
+               ot.gauss.size(), m_gauss_tag,
                m_frame_tag);
 
     out = IFrame::pointer(sframe);
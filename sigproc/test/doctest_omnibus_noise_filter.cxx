@@ -0,0 +1,132 @@
+#include "WireCellSigProc/OmnibusNoiseFilter.h"
+#include "WireCellSigProc/SimpleChannelNoiseDB.h"
+#include "WireCellAux/SimpleFrame.h"
+#include "WireCellAux/SimpleTrace.h"
+#include "WireCellAux/FrameTools.h"
+#include "WireCellUtil/NamedFactory.h"
+#include "WireCellUtil/PluginManager.h"
+#include "WireCellUtil/doctest.h"
+
+#include <map>
+#include <random>
+
+using namespace WireCell;
+
+namespace {
+
+    // Subtract the group mean waveform and mask the first bins of
+    // the noisiest channel, much like a coherent noise filter.
+    class TestGroupFilter : public IChannelFilter {
+      public:
+        virtual ~TestGroupFilter() {}
+
+        Waveform::ChannelMaskMap apply(int, signal_t&) const { return Waveform::ChannelMaskMap(); }
+
+        Waveform::ChannelMaskMap apply(channel_signals_t& chansig) const
+        {
+            const size_t nticks = chansig.begin()->second.size();
+            signal_t mean(nticks, 0);
+            for (const auto& [ch, sig] : chansig) {
+                for (size_t ind = 0; ind < nticks; ++ind) {
+                    mean[ind] += sig[ind] / chansig.size();
+                }
+            }
+            int noisiest = 0;
+            double most = -1;
+            for (auto& [ch, sig] : chansig) {
+                double sum2 = 0;
+                for (size_t ind = 0; ind < nticks; ++ind) {
+                    sig[ind] -= mean[ind];
+                    sum2 += sig[ind] * sig[ind];
+                }
+                if (sum2 > most) {
+                    most = sum2;
+                    noisiest = ch;
+                }
+            }
+            Waveform::ChannelMaskMap ret;
+            ret["noisy"][noisiest].push_back(Waveform::BinRange(0, 10));
+            return ret;
+        }
+    };
+}
+
+WIRECELL_FACTORY(TestGroupFilter, TestGroupFilter, WireCell::IChannelFilter)
+
+static IFrame::pointer make_frame(int nchans, int nticks)
+{
+    std::mt19937 rng(1234);
+    std::normal_distribution<float> noise(0, 10);
+    ITrace::vector traces;
+    for (int ch = 0; ch < nchans; ++ch) {
+        ITrace::ChargeSequence charge(nticks);
+        for (auto& q : charge) {
+            q = 2048 + noise(rng);
+        }
+        traces.push_back(std::make_shared<Aux::SimpleTrace>(ch, 0, charge));
+    }
+    auto sframe = std::make_shared<Aux::SimpleFrame>(0, 0, traces);
+    IFrame::trace_list_t indices(traces.size());
+    for (size_t ind = 0; ind < indices.size(); ++ind) {
+        indices[ind] = ind;
+    }
+    sframe->tag_traces("orig", indices);
+    return sframe;
+}
+
+static IFrame::pointer run_filter(const IFrame::pointer& inframe, int ngroups, int groupsize, int nthreads)
+{
+    SigProc::OmnibusNoiseFilter onf;
+    auto cfg = onf.default_configuration();
+    cfg["channel_filters"] = Json::arrayValue;
+    cfg["channel_status_filters"] = Json::arrayValue;
+    cfg["grouped_filters"] = Json::arrayValue;
+    cfg["noisedb"] = "testChannelNoiseDB";
+    for (int igrp = 0; igrp < ngroups; ++igrp) {
+        for (int ind = 0; ind < groupsize; ++ind) {
+            cfg["multigroup_chanfilters"][0]["channelgroups"][igrp][ind] = igrp * groupsize + ind;
+        }
+    }
+    cfg["multigroup_chanfilters"][0]["filters"][0] = "TestGroupFilter";
+    cfg["nthreads"] = nthreads;
+    onf.configure(cfg);
+
+    IFrame::pointer outframe;
+    REQUIRE(onf(inframe, outframe));
+    REQUIRE(outframe);
+    return outframe;
+}
+
+TEST_CASE("omnibus noise filter output does not depend on nthreads")
+{
+    PluginManager& pm = PluginManager::instance();
+    pm.add("WireCellSigProc");
+    // The test filter is not in a shared library.
+    make_TestGroupFilter_factory();
+    Factory::lookup<IChannelFilter>("TestGroupFilter");
+
+    // Only the bad channels of the noise DB are used.
+    auto ndb = Factory::lookup<IChannelNoiseDatabase>("testChannelNoiseDB");
+    auto sndb = std::dynamic_pointer_cast<SigProc::SimpleChannelNoiseDB>(ndb);
+    REQUIRE(sndb);
+    sndb->set_bad_channels({3});
+
+    const int ngroups = 16, groupsize = 8;
+    auto inframe = make_frame(ngroups * groupsize, 500);
+
+    auto one = run_filter(inframe, ngroups, groupsize, 1);
+    auto many = run_filter(inframe, ngroups, groupsize, 4);
+
+    std::map<int, ITrace::ChargeSequence> want;
+    for (const auto& trace : Aux::tagged_traces(one, "raw")) {
+        want[trace->channel()] = trace->charge();
+    }
+    auto got = Aux::tagged_traces(many, "raw");
+    REQUIRE(got.size() == want.size());
+    for (const auto& trace : got) {
+        CHECK(trace->charge() == want.at(trace->channel()));
+    }
+    CHECK(many->masks() == one->masks());
+    // Each group masks one channel, plus the bad channel.
+    CHECK(one->masks()["bad"].size() >= ngroups);
+}
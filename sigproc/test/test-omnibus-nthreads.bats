@@ -0,0 +1,47 @@
+#!/usr/bin/env bats
+
+# Check that OmnibusSigProc gives identical output regardless of how
+# many threads it uses to process planes.
+
+# bats file_tags=sigproc,PDSP
+
+bats_load_library wct-bats.sh
+
+cfg_file="${BATS_TEST_FILENAME%.bats}.jsonnet"
+adc_file="frames-adc.tar.gz"
+
+setup_file () {
+
+    skip_if_no_input
+
+    cd_tmp file
+
+    local in_file="$(input_file depos/many.tar.bz2)"
+    [[ -f "$in_file" ]]
+
+    run_idempotently -s "$cfg_file" -s "$in_file" -t "$adc_file" -- \
+                     wire-cell -l sim.log -L debug \
+                     -A input="$in_file" -A output="$adc_file" -A stage=sim \
+                     -c "$cfg_file"
+    file_larger_than "$adc_file" 32
+}
+
+@test "omnibus sigproc output does not depend on nthreads" {
+
+    cd_tmp file
+
+    local nt
+    for nt in 1 3
+    do
+        wire-cell -l sp-$nt.log -L debug \
+                  -A input="$adc_file" -A output="frames-sp-$nt.tar.gz" \
+                  -A stage=sp -A nthreads=$nt \
+                  -c "$cfg_file"
+        file_larger_than "frames-sp-$nt.tar.gz" 32
+    done
+
+    local one="$(unpack_frames frames-sp-1.tar.gz)"
+    local three="$(unpack_frames frames-sp-3.tar.gz)"
+    [[ -n "$(ls $one)" ]]
+    check diff -r "$one" "$three"
+}
@@ -11,9 +11,14 @@
 #include <boost/iostreams/filtering_stream.hpp>
 #pragma GCC diagnostic pop
 
+#include <memory>
 #include <string>
 #include <vector>
 
+namespace WireCell::Stream {
+    class parallel_compressor;
+}
+
 namespace WireCell::Sio {
 
     class FrameFileSink : public Aux::Logger, public IFrameSink, public IConfigurable, public ITerminal {
@@ -74,14 +79,46 @@ namespace WireCell::Sio {
         /// to 16 bit int.
         bool m_digitize{false};
 
+        /// If true, each tag is written zero-suppressed.  In place
+        /// of the 2D "frame" array, a "rois" array of shape (N,3)
+        /// holds one (row, tbin begin, tbin end) triple for each run
+        /// of contiguous non-zero samples, where row indexes the
+        /// "channels" array and tbin is absolute.  A 1D "samples"
+        /// array holds the transformed samples of all runs
+        /// concatenated.  Samples outside of runs are not saved and
+        /// read back as zero so only "scale" may be applied: a
+        /// nonzero "baseline" or "offset" is an error.  Exclusive
+        /// with "dense".
+        bool m_sparse{false};
+
         bool m_dense{false};
         int m_chbeg{0}, m_chend{0}, m_tbbeg{0}, m_tbend{0};
 
+        /// Number of threads compressing .gz or .bz2 output off of
+        /// the calling thread.  Each block is written as a separate
+        /// compressed member.  Zero compresses in the calling thread.
+        size_t m_nthreads{0};
+
+        /// If true, also write a sidecar index "<outname>.index.json"
+        /// giving the file offset at which each frame starts so that
+        /// FrameFileSource may seek to selected frames.  Requires .tar
+        /// output or .tar.gz/.tar.bz2 output which is then written
+        /// with at least one compression thread so each frame starts a
+        /// new compressed member.
+        bool m_index{false};
+
         // The output stream
         boost::iostreams::filtering_ostream m_out;
 
+        // Handle on the device at the end of m_out when indexing and
+        // the (ident, member) at the start of each frame.
+        std::unique_ptr<Stream::parallel_compressor> m_compressor;
+        std::vector<std::pair<int, size_t>> m_members;
+
         void one_tag(const IFrame::pointer& frame,
                      const std::string& tag);
+        void sparse(const IFrame::pointer& frame, const std::string& tag,
+                    const ITrace::vector& traces, std::vector<int>& channels);
         void masks(const IFrame::pointer& frame);
 
         size_t m_count{0};
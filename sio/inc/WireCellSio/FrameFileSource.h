@@ -4,6 +4,7 @@
 #include "WireCellIface/IFrameSource.h"
 #include "WireCellIface/IConfigurable.h"
 #include "WireCellAux/Logger.h"
+#include "WireCellUtil/Array.h"
 #include "WireCellUtil/custard/pigenc.hpp"
 
 #pragma GCC diagnostic push
@@ -12,6 +13,7 @@
 #pragma GCC diagnostic pop
 
 #include <string>
+#include <map>
 #include <vector>
 
 namespace WireCell::Sio {
@@ -39,6 +41,10 @@ namespace WireCell::Sio {
             will be streamed.
         
             Frames are read from the tar stream as Numpy .npy files.
+            A framelet may be held as a dense 2D "frame" array or in the
+            zero-suppressed "rois" and "samples" arrays (see
+            FrameFileSink "sparse").  The latter produces one trace per
+            channel spanning its first to last run of samples.
         */
         std::string m_inname{""};
 
@@ -68,11 +74,35 @@ namespace WireCell::Sio {
         */
         std::vector<std::string> m_frame_tags;        
 
+        /** Config: "idents".
+
+            If given, produce only frames with these idents.  If the
+            input has a sidecar index (see FrameFileSink "index") the
+            frames are produced in the given order by seeking to each.
+            Otherwise the input is scanned and matching frames are
+            produced in file order.
+        */
+        std::vector<int> m_idents;
+
         // The output stream
         boost::iostreams::filtering_istream m_in;
 
+        // Offset of each ident from the sidecar index, if any, and
+        // the index into m_idents of the next frame to produce.
+        std::map<int, size_t> m_offsets;
+        size_t m_next_ident{0};
+
         IFrame::pointer load();
 
+        // Append one trace per channel from zero-suppressed arrays.
+        void sparse_traces(const std::vector<int>& channels, int tbin0,
+                           const Array::array_xxi& rois,
+                           const std::vector<float>& samples,
+                           ITrace::vector& traces);
+
+        // Load the next frame respecting any ident selection.
+        IFrame::pointer next();
+
         // Classify a <tag> label from a framelet array name. 
         bool is_tagged(const std::string& tag);
         bool is_untagged(const std::string& tag);
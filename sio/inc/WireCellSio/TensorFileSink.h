@@ -12,6 +12,13 @@
 #include <boost/iostreams/filtering_stream.hpp>
 #pragma GCC diagnostic pop
 
+#include <memory>
+#include <vector>
+
+namespace WireCell::Stream {
+    class parallel_compressor;
+}
+
 namespace WireCell::Sio {
 
     class TensorFileSink : public Aux::Logger, public ITensorSetSink,
@@ -83,12 +90,37 @@ namespace WireCell::Sio {
         // if true, disable writing to file which makes it faster to debug
         bool m_dump_mode{false};
 
+        /** Config: "nthreads"
+
+            Number of threads compressing .gz or .bz2 output off of
+            the calling thread.  Each block is written as a separate
+            compressed member which TensorFileSource reads as usual.
+            Zero compresses in the calling thread.
+        */
+        size_t m_nthreads{0};
+
+        /** Config: "index"
+
+            If true, also write a sidecar index "<outname>.index.json"
+            giving the file offset at which each tensor set starts so
+            that TensorFileSource may seek to selected tensor sets.
+            Requires .tar output or .tar.gz/.tar.bz2 output which is
+            then written with at least one compression thread so each
+            tensor set starts a new compressed member.
+        */
+        bool m_index{false};
+
       private:
         
         using ostream_t = boost::iostreams::filtering_ostream;
         ostream_t m_out;
         size_t m_count{0};
 
+        // Handle on the device at the end of m_out when indexing and
+        // the (ident, member) at the start of each tensor set.
+        std::unique_ptr<Stream::parallel_compressor> m_compressor;
+        std::vector<std::pair<int, size_t>> m_members;
+
         void numpyify(ITensor::pointer ten, const std::string& fname);
         void jsonify(const Configuration& cfg, const std::string& fname);
 
@@ -12,6 +12,9 @@
 #include <boost/iostreams/filtering_stream.hpp>
 #pragma GCC diagnostic pop
 
+#include <map>
+#include <vector>
+
 namespace WireCell::Sio {
 
     class TensorFileSource : public Aux::Logger, public ITensorSetSource,
@@ -72,6 +75,16 @@ namespace WireCell::Sio {
         */
         std::string m_prefix{""};
 
+        /** Config: "idents"
+
+            If given, produce only tensor sets with these idents.  If
+            the input has a sidecar index (see TensorFileSink "index")
+            the tensor sets are produced in the given order by seeking
+            to each.  Otherwise the input is scanned and matching
+            tensor sets are produced in file order.
+        */
+        std::vector<int> m_idents;
+
       private:
         
         using istream_t = boost::iostreams::filtering_istream;
@@ -79,7 +92,15 @@ namespace WireCell::Sio {
         size_t m_count{0};
         bool m_eos_sent{false};
 
+        // Offset of each ident from the sidecar index, if any, and
+        // the index into m_idents of the next tensor set to produce.
+        std::map<int, size_t> m_offsets;
+        size_t m_next_ident{0};
+
         ITensorSet::pointer load();
+
+        // Load the next tensor set respecting any ident selection.
+        ITensorSet::pointer next();
         bool read_head();
         void clear();
 
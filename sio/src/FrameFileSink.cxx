@@ -32,6 +32,16 @@ void Sio::FrameFileSink::finalize()
     log->debug("closing {} after {} calls",
                m_outname, m_count);
     m_out.pop();
+
+    if (m_compressor) {
+        const auto offsets = m_compressor->offsets();
+        index_entries_t entries;
+        for (const auto& [ident, member] : m_members) {
+            entries.emplace_back(ident, offsets.at(member));
+        }
+        save_index(m_outname, entries);
+        log->debug("indexed {} frames in {}", entries.size(), index_name(m_outname));
+    }
 }
 
 WireCell::Configuration Sio::FrameFileSink::default_configuration() const
@@ -61,6 +71,17 @@ WireCell::Configuration Sio::FrameFileSink::default_configuration() const
 
     cfg["masks"] = true;
 
+    // Number of background threads compressing .gz or .bz2 output.
+    // Zero compresses in the calling thread.
+    cfg["nthreads"] = (int)m_nthreads;
+
+    // If true, write a sidecar index of frame offsets.
+    cfg["index"] = m_index;
+
+    // If true, write each tag zero-suppressed as "rois" and
+    // "samples" arrays instead of a 2D "frame" array.
+    cfg["sparse"] = m_sparse;
+
     // If the "dense" option is given the frame array will be extended
     // and padded prior to output.  The value of "dense" should be an
     // object with keys "chbeg" and "chend" which give half-inclusive
@@ -78,11 +99,26 @@ void Sio::FrameFileSink::configure(const WireCell::Configuration& cfg)
 
     m_masks = get(cfg, "masks", m_masks);
 
+    const int nthreads = get<int>(cfg, "nthreads", m_nthreads);
+    if (nthreads < 0) {
+        THROW(ValueError() << errmsg{"FrameFileSink: nthreads must not be negative"});
+    }
+    m_nthreads = nthreads;
+    m_index = get<bool>(cfg, "index", m_index);
     m_out.clear();
-    output_filters(m_out, m_outname);
+    parallel_output_filters(m_out, m_outname, m_index ? std::max<size_t>(m_nthreads, 1) : m_nthreads);
     if (m_out.size() < 1) {
         THROW(ValueError() << errmsg{"FrameFileSink: unsupported outname: " + m_outname});
     }
+    m_compressor.reset();
+    m_members.clear();
+    if (m_index) {
+        auto* pc = m_out.component<parallel_compressor>(m_out.size() - 1);
+        if (!pc) {
+            THROW(ValueError() << errmsg{"FrameFileSink: can not index outname: " + m_outname});
+        }
+        m_compressor = std::make_unique<parallel_compressor>(*pc);
+    }
 
     m_tags.clear();
     for (auto jtag : cfg["tags"]) {
@@ -102,12 +138,21 @@ void Sio::FrameFileSink::configure(const WireCell::Configuration& cfg)
     m_baseline = get(cfg, "baseline", m_baseline);
     m_scale = get(cfg, "scale", m_scale);
     m_offset = get(cfg, "offset", m_offset);
+    m_sparse = get<bool>(cfg, "sparse", m_sparse);
+    if (m_sparse and (m_baseline != 0.0 or m_offset != 0.0)) {
+        // Suppressed samples are implicitly zero and would not see
+        // the transform.
+        THROW(ValueError() << errmsg{"FrameFileSink: \"sparse\" requires zero \"baseline\" and \"offset\""});
+    }
 
     if (cfg["dense"].isNull() or cfg["dense"].empty()) {
-        log->debug("save {} with baseline={} scale={} offset={} digitize={} to {}",
-                   stags, m_baseline, m_scale, m_offset, m_digitize, m_outname);
+        log->debug("save {} with baseline={} scale={} offset={} digitize={} sparse={} to {}",
+                   stags, m_baseline, m_scale, m_offset, m_digitize, m_sparse, m_outname);
         return;
     }
+    if (m_sparse) {
+        THROW(ValueError() << errmsg{"FrameFileSink: \"sparse\" and \"dense\" are exclusive"});
+    }
     m_dense = true;
     auto dense = cfg["dense"];
     m_chbeg = dense["chbeg"].asInt();
@@ -164,11 +209,14 @@ void Sio::FrameFileSink::one_tag(const IFrame::pointer& frame,
     const size_t ncols = tbinmm.second - tbinmm.first;
     const size_t nrows = std::distance(channels.begin(), channels.end());
 
-    Array::array_xxf arr = Array::array_xxf::Zero(nrows, ncols) + m_baseline;
-    Aux::fill(arr, traces, channels.begin(), channels.end(), tbinmm.first);
-    arr = arr * m_scale + m_offset;
+    if (m_sparse) {
+        sparse(frame, tag, traces, channels);
+    }
+    else {  // the 2D frame array
+        Array::array_xxf arr = Array::array_xxf::Zero(nrows, ncols) + m_baseline;
+        Aux::fill(arr, traces, channels.begin(), channels.end(), tbinmm.first);
+        arr = arr * m_scale + m_offset;
 
-    {  // the 2D frame array
         const std::string aname = String::format("frame_%s_%d.npy", tag.c_str(), frame->ident());
         if (m_digitize) {
             Array::array_xxs sarr = arr.cast<short>();
@@ -207,6 +255,40 @@ void Sio::FrameFileSink::one_tag(const IFrame::pointer& frame,
 
 }
 
+void Sio::FrameFileSink::sparse(const IFrame::pointer& frame, const std::string& tag,
+                                const ITrace::vector& traces, std::vector<int>& channels)
+{
+    auto rl = Aux::rois(traces, channels.begin(), channels.end());
+    for (auto& val : rl.samples) {
+        val = (val + m_baseline) * m_scale + m_offset;
+    }
+
+    {  // the (row, tbin begin, tbin end) runs
+        const size_t nrois = rl.size();
+        Eigen::Array<int, Eigen::Dynamic, 3> arr(nrois, 3);
+        for (size_t iroi = 0; iroi < nrois; ++iroi) {
+            for (size_t icol = 0; icol < 3; ++icol) {
+                arr(iroi, icol) = rl.rois[3 * iroi + icol];
+            }
+        }
+        const std::string aname = String::format("rois_%s_%d.npy", tag.c_str(), frame->ident());
+        write(m_out, aname, arr);
+    }
+
+    {  // the concatenated samples of the runs
+        const std::string aname = String::format("samples_%s_%d.npy", tag.c_str(), frame->ident());
+        if (m_digitize) {
+            std::vector<short> svec(rl.samples.begin(), rl.samples.end());
+            write(m_out, aname, svec);
+        }
+        else {
+            write(m_out, aname, rl.samples);
+        }
+    }
+    log->debug("call={} frame={} tag=\"{}\" {} rois with {} samples",
+               m_count, frame->ident(), tag, rl.size(), rl.samples.size());
+}
+
 static
 size_t cms_size(const ChannelMasks& cms)
 {
@@ -267,6 +349,11 @@ bool Sio::FrameFileSink::operator()(const IFrame::pointer& frame)
 
     log->debug("input frame: {}", Aux::taginfo(frame));
 
+    if (m_compressor) {
+        m_out.flush();
+        m_members.emplace_back(frame->ident(), m_compressor->restart());
+    }
+
     for (auto tag : m_tags) {
         one_tag(frame, tag);
     }
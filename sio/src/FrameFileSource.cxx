@@ -42,6 +42,9 @@ WireCell::Configuration FrameFileSource::default_configuration() const
 
     cfg["frame_tags"] = Json::arrayValue;
 
+    // Select frames by ident.  Empty means all.
+    cfg["idents"] = Json::arrayValue;
+
     return cfg;
 }
 
@@ -64,6 +67,18 @@ void FrameFileSource::configure(const WireCell::Configuration& cfg)
     for (auto jtag : cfg["frame_tags"]) {
         m_frame_tags.push_back(jtag.asString());
     }
+
+    m_idents.clear();
+    for (auto jident : cfg["idents"]) {
+        m_idents.push_back(jident.asInt());
+    }
+    m_next_ident = 0;
+    m_offsets.clear();
+    if (m_idents.size()) {
+        m_offsets = load_index(m_inname);
+        log->debug("selecting {} frames {}", m_idents.size(),
+                   m_offsets.empty() ? "by scanning" : "with index");
+    }
 }
 
 bool FrameFileSource::is_excluded(const std::string& tag)
@@ -132,6 +147,10 @@ IFrame::pointer FrameFileSource::load()
         std::vector<double> tickinfo, summary;
         std::vector<int> channels;
         trace_array_t trace_array;
+        // Zero-suppressed alternative to trace_array.
+        Array::array_xxi rois;
+        std::vector<float> samples;
+        bool sparse{false};
         std::string tag{""};
     };
     std::vector<framelet_t> framelets; // ordered
@@ -255,6 +274,44 @@ IFrame::pointer FrameFileSource::load()
             continue;
         }
 
+        if (m_cur.type == "rois") {
+            auto& framelet = get_framelet(m_cur.tag);
+            framelet.tag = m_cur.tag;
+            framelet.sparse = true;
+            bool ok = pigenc::eigen::load(m_cur.pig, framelet.rois);
+            if (!ok or (framelet.rois.size() and framelet.rois.cols() != 3)) {
+                log->error("call={}, rois load failed tag=\"{}\" file={}",
+                           m_count, m_cur.tag, m_inname);
+                THROW(IOError() << errmsg{"rois load error with file " + m_inname});
+            }
+            log->trace("call={}, load {} rois with tag=\"{}\" have {}",
+                       m_count, framelet.rois.rows(), m_cur.tag, framelets.size());
+            clear();
+            continue;
+        }
+
+        if (m_cur.type == "samples") {
+            auto& framelet = get_framelet(m_cur.tag);
+            framelet.sparse = true;
+            auto dtype = m_cur.pig.header().dtype();
+            bool ok = false;
+            if (dtype == "<i2" or dtype == "i2") { // ADC short ints
+                std::vector<short> svec;
+                ok = pigenc::stl::load(m_cur.pig, svec);
+                framelet.samples.assign(svec.begin(), svec.end());
+            }
+            else {
+                ok = pigenc::stl::load(m_cur.pig, framelet.samples);
+            }
+            if (!ok) {
+                log->error("call={}, samples load failed tag=\"{}\" file={}",
+                           m_count, m_cur.tag, m_inname);
+                THROW(IOError() << errmsg{"samples load error with file " + m_inname});
+            }
+            clear();
+            continue;
+        }
+
         if (m_cur.type == "channels") {
             auto& framelet = get_framelet(m_cur.tag);
             bool ok = pigenc::stl::load(m_cur.pig, framelet.channels);
@@ -312,6 +369,14 @@ IFrame::pointer FrameFileSource::load()
     ITrace::vector all_traces;
     for (auto& framelet : framelets) {
 
+        if (framelet.sparse) {
+            sparse_traces(framelet.channels, (int)framelet.tickinfo[2],
+                          framelet.rois, framelet.samples, all_traces);
+            log->trace("call={}, add {} sparse traces from \"{}\" to total {}",
+                       m_count, framelet.channels.size(), framelet.tag, all_traces.size());
+            continue;
+        }
+
         const size_t nrows = framelet.trace_array.rows();
         const size_t ncols = framelet.trace_array.cols();
 
@@ -371,6 +436,82 @@ IFrame::pointer FrameFileSource::load()
     return sframe;
 }
 
+void FrameFileSource::sparse_traces(const std::vector<int>& channels, int tbin0,
+                                    const Array::array_xxi& rois,
+                                    const std::vector<float>& samples,
+                                    ITrace::vector& traces)
+{
+    // One trace per channel spans its first to last run with zeros
+    // between runs so that traces keep a one-to-one correspondence
+    // with channels and summary values.
+    const int nrows = channels.size();
+    const int nrois = rois.rows();
+    size_t isample = 0;
+    int iroi = 0;
+    for (int irow = 0; irow < nrows; ++irow) {
+        const int first = iroi;
+        while (iroi < nrois and rois(iroi, 0) == irow) {
+            ++iroi;
+        }
+        if (first == iroi) {    // channel with nothing above threshold
+            traces.push_back(std::make_shared<Aux::SimpleTrace>(channels[irow], tbin0, (size_t)0));
+            continue;
+        }
+        const int tbin = rois(first, 1);
+        ITrace::ChargeSequence charges(rois(iroi - 1, 2) - tbin, 0);
+        for (int ind = first; ind < iroi; ++ind) {
+            const int beg = rois(ind, 1), end = rois(ind, 2);
+            if (end < beg or isample + (end - beg) > samples.size()) {
+                THROW(IOError() << errmsg{"rois and samples mismatch with file " + m_inname});
+            }
+            std::copy(samples.begin() + isample, samples.begin() + isample + (end - beg),
+                      charges.begin() + (beg - tbin));
+            isample += end - beg;
+        }
+        traces.push_back(std::make_shared<Aux::SimpleTrace>(channels[irow], tbin, charges));
+    }
+    if (iroi != nrois or isample != samples.size()) {
+        log->error("call={}, rois not ordered by channel row or samples mismatch file={}",
+                   m_count, m_inname);
+        THROW(IOError() << errmsg{"rois and samples mismatch with file " + m_inname});
+    }
+}
+
+IFrame::pointer FrameFileSource::next()
+{
+    if (m_idents.empty()) {
+        return load();
+    }
+
+    if (m_offsets.empty()) {
+        while (auto frame = load()) {
+            if (std::find(m_idents.begin(), m_idents.end(), frame->ident()) != m_idents.end()) {
+                return frame;
+            }
+            log->debug("call={}, skipping frame ident={}", m_count, frame->ident());
+        }
+        return nullptr;
+    }
+
+    while (m_next_ident < m_idents.size()) {
+        const int ident = m_idents[m_next_ident++];
+        auto it = m_offsets.find(ident);
+        if (it == m_offsets.end()) {
+            log->warn("call={}, no frame ident={} in index of {}", m_count, ident, m_inname);
+            continue;
+        }
+        clear();
+        m_in.reset();
+        input_filters(m_in, m_inname, it->second);
+        auto frame = load();
+        if (frame && frame->ident() == ident) {
+            return frame;
+        }
+        log->warn("call={}, index of {} is inconsistent at frame ident={}", m_count, m_inname, ident);
+    }
+    return nullptr;
+}
+
 void FrameFileSource::clear()
 {
     m_cur.pig.clear();
@@ -384,7 +525,7 @@ bool FrameFileSource::operator()(IFrame::pointer& frame)
         return false;
     }
 
-    frame = load();             // throws
+    frame = next();             // throws
 
     if (frame) {
         log->debug("call={} load frame: {}", m_count++, Aux::taginfo(frame));
@@ -2,6 +2,7 @@
 
 #include "WireCellAux/FrameTools.h"
 #include "WireCellUtil/NamedFactory.h"
+#include "WireCellUtil/Exceptions.h"
 #include "WireCellUtil/NumpyHelper.h"
 
 #include <string>
@@ -43,6 +44,12 @@ WireCell::Configuration Sio::NumpyFrameSaver::default_configuration() const
     // casting to dtype.
     cfg["offset"] = 0.0;
 
+    // If true, save each tag zero-suppressed as "rois" and "samples"
+    // arrays instead of a 2D "frame" array.  See FrameFileSink.
+    // Suppressed samples read back as zero so this requires zero
+    // baseline and offset.
+    cfg["sparse"] = false;
+
     // The frame tags to consider for saving.  If null or empty then all traces are used.
     cfg["frame_tags"] = Json::arrayValue;
     // The summary tags to consider for saving
@@ -59,7 +66,14 @@ WireCell::Configuration Sio::NumpyFrameSaver::default_configuration() const
     return cfg;
 }
 
-void Sio::NumpyFrameSaver::configure(const WireCell::Configuration& config) { m_cfg = config; }
+void Sio::NumpyFrameSaver::configure(const WireCell::Configuration& config)
+{
+    if (get<bool>(config, "sparse", false) and
+        (get<double>(config, "baseline", 0.0) != 0.0 or get<double>(config, "offset", 0.0) != 0.0)) {
+        THROW(ValueError() << errmsg{"NumpyFrameSaver: \"sparse\" requires zero \"baseline\" and \"offset\""});
+    }
+    m_cfg = config;
+}
 
 bool Sio::NumpyFrameSaver::operator()(const IFrame::pointer& inframe, IFrame::pointer& outframe)
 {
@@ -77,6 +91,7 @@ bool Sio::NumpyFrameSaver::operator()(const IFrame::pointer& inframe, IFrame::po
     const float scale = m_cfg["scale"].asFloat();
     const float offset = m_cfg["offset"].asFloat();
     const bool digitize = m_cfg["digitize"].asBool();
+    const bool sparse = m_cfg["sparse"].asBool();
 
     const std::string fname = m_cfg["filename"].asString();
 
@@ -123,11 +138,30 @@ bool Sio::NumpyFrameSaver::operator()(const IFrame::pointer& inframe, IFrame::po
         const size_t nrows = std::distance(chbeg, chend);
         l->debug("NumpyFrameSaver: saving ncols={} nrows={}", ncols, nrows);
 
-        Array::array_xxf arr = Array::array_xxf::Zero(nrows, ncols) + baseline;
-        Aux::fill(arr, traces, channels.begin(), chend, tbinmm.first);
-        arr = arr * scale + offset;
+        if (sparse) {
+            auto rl = Aux::rois(traces, channels.begin(), chend);
+            for (auto& val : rl.samples) {
+                val = (val + baseline) * scale + offset;
+            }
+            const std::string rname = String::format("rois_%s_%d", tag.c_str(), m_save_count);
+            cnpy::npz_save(fname, rname, rl.rois.data(), {rl.size(), 3}, mode);
+
+            const std::string aname = String::format("samples_%s_%d", tag.c_str(), m_save_count);
+            if (digitize) {
+                std::vector<short> svec(rl.samples.begin(), rl.samples.end());
+                cnpy::npz_save(fname, aname, svec.data(), {svec.size()}, mode);
+            }
+            else {
+                cnpy::npz_save(fname, aname, rl.samples.data(), {rl.samples.size()}, mode);
+            }
+            l->debug("NumpyFrameSaver: saved {} rois with {} samples over {} channels {} ticks @t={} ms",
+                     rl.size(), rl.samples.size(), nrows, ncols, inframe->time() / units::ms);
+        }
+        else {  // the 2D frame array
+            Array::array_xxf arr = Array::array_xxf::Zero(nrows, ncols) + baseline;
+            Aux::fill(arr, traces, channels.begin(), chend, tbinmm.first);
+            arr = arr * scale + offset;
 
-        {  // the 2D frame array
             const std::string aname = String::format("frame_%s_%d", tag.c_str(), m_save_count);
             if (digitize) {
                 Array::array_xxs sarr = arr.cast<short>();
@@ -26,19 +26,40 @@ WireCell::Configuration TensorFileSink::default_configuration() const
     Configuration cfg;
     cfg["outname"] = m_outname;
     cfg["prefix"] = m_prefix;
+    cfg["nthreads"] = (int)m_nthreads;
+    cfg["index"] = m_index;
     return cfg;
 }
 
 void TensorFileSink::configure(const WireCell::Configuration& cfg)
 {
     m_outname = get(cfg, "outname", m_outname);
+    const int nthreads = get<int>(cfg, "nthreads", m_nthreads);
+    if (nthreads < 0) {
+        const std::string msg = "TensorFileSink: nthreads must not be negative";
+        log->critical(msg);
+        THROW(ValueError() << errmsg{msg});
+    }
+    m_nthreads = nthreads;
+    m_index = get<bool>(cfg, "index", m_index);
     m_out.clear();
-    custard::output_filters(m_out, m_outname);
+    Stream::parallel_output_filters(m_out, m_outname, m_index ? std::max<size_t>(m_nthreads, 1) : m_nthreads);
     if (m_out.empty()) {
         const std::string msg = "ClusterFileSink: unsupported outname: " + m_outname;
         log->critical(msg);
         THROW(ValueError() << errmsg{msg});
     }
+    m_compressor.reset();
+    m_members.clear();
+    if (m_index) {
+        auto* pc = m_out.component<Stream::parallel_compressor>(m_out.size() - 1);
+        if (!pc) {
+            const std::string msg = "TensorFileSink: can not index outname: " + m_outname;
+            log->critical(msg);
+            THROW(ValueError() << errmsg{msg});
+        }
+        m_compressor = std::make_unique<Stream::parallel_compressor>(*pc);
+    }
     m_prefix = get<std::string>(cfg, "prefix", m_prefix);
     log->debug("sink through {} filters to {} with prefix \"{}\"",
                m_out.size(), m_outname, m_prefix);
@@ -50,6 +71,16 @@ void TensorFileSink::finalize()
 {
     log->debug("closing {} after {} calls", m_outname, m_count);
     m_out.pop();
+
+    if (m_compressor) {
+        const auto offsets = m_compressor->offsets();
+        Stream::index_entries_t entries;
+        for (const auto& [ident, member] : m_members) {
+            entries.emplace_back(ident, offsets.at(member));
+        }
+        Stream::save_index(m_outname, entries);
+        log->debug("indexed {} tensor sets in {}", entries.size(), Stream::index_name(m_outname));
+    }
 }
 
 void TensorFileSink::numpyify(ITensor::pointer ten, const std::string& fname)
@@ -90,6 +121,11 @@ bool TensorFileSink::operator()(const ITensorSet::pointer &in)
         return true;
     }
 
+    if (m_compressor) {
+        m_out.flush();
+        m_members.emplace_back(in->ident(), m_compressor->restart());
+    }
+
     const std::string pre = m_prefix + "tensor";
     const std::string sident = std::to_string(in->ident());
     auto tens = in->tensors();
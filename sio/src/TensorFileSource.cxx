@@ -34,6 +34,7 @@ WireCell::Configuration TensorFileSource::default_configuration() const
     Configuration cfg;
     cfg["inname"] = m_inname;
     cfg["prefix"] = m_prefix;
+    cfg["idents"] = Json::arrayValue;
     return cfg;
 }
 
@@ -48,7 +49,21 @@ void TensorFileSource::configure(const WireCell::Configuration& cfg)
         THROW(ValueError() << errmsg{"TensorFileSource: unsupported inname: " + m_inname});
     }
 
+    m_idents.clear();
+    for (auto jident : cfg["idents"]) {
+        m_idents.push_back(jident.asInt());
+    }
+    m_next_ident = 0;
+    m_offsets.clear();
+    if (m_idents.size()) {
+        m_offsets = load_index(m_inname);
+    }
+
     log->debug("reading file={} with prefix={}", m_inname, m_prefix);
+    if (m_idents.size()) {
+        log->debug("selecting {} tensor sets {}", m_idents.size(),
+                   m_offsets.empty() ? "by scanning" : "with index");
+    }
 }
 
 void TensorFileSource::finalize()
@@ -290,6 +305,41 @@ ITensorSet::pointer TensorFileSource::load()
     return std::make_shared<SimpleTensorSet>(ident, setmd, sv);
 }
 
+ITensorSet::pointer TensorFileSource::next()
+{
+    if (m_idents.empty()) {
+        return load();
+    }
+
+    if (m_offsets.empty()) {
+        while (auto ts = load()) {
+            if (std::find(m_idents.begin(), m_idents.end(), ts->ident()) != m_idents.end()) {
+                return ts;
+            }
+            log->debug("call={}, skipping tensor set ident={}", m_count, ts->ident());
+        }
+        return nullptr;
+    }
+
+    while (m_next_ident < m_idents.size()) {
+        const int ident = m_idents[m_next_ident++];
+        auto it = m_offsets.find(ident);
+        if (it == m_offsets.end()) {
+            log->warn("call={}, no tensor set ident={} in index of {}", m_count, ident, m_inname);
+            continue;
+        }
+        clear();
+        m_in.reset();
+        input_filters(m_in, m_inname, it->second);
+        auto ts = load();
+        if (ts && ts->ident() == ident) {
+            return ts;
+        }
+        log->warn("call={}, index of {} is inconsistent at tensor set ident={}", m_count, m_inname, ident);
+    }
+    return nullptr;
+}
+
 void TensorFileSource::clear()
 {
     m_cur = header_t();
@@ -302,7 +352,7 @@ bool TensorFileSource::operator()(ITensorSet::pointer &out)
         log->debug("past EOS at call={}", m_count++);
         return false;
     }
-    out = load();
+    out = next();
     if (!out) {
         m_eos_sent = true;
     }
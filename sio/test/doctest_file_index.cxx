@@ -0,0 +1,184 @@
+#include "WireCellSio/FrameFileSink.h"
+#include "WireCellSio/FrameFileSource.h"
+#include "WireCellSio/TensorFileSink.h"
+#include "WireCellSio/TensorFileSource.h"
+#include "WireCellAux/SimpleFrame.h"
+#include "WireCellAux/SimpleTrace.h"
+#include "WireCellAux/SimpleTensor.h"
+#include "WireCellAux/SimpleTensorSet.h"
+#include "WireCellAux/FrameTools.h"
+#include "WireCellUtil/Persist.h"
+#include "WireCellUtil/Stream.h"
+#include "WireCellUtil/doctest.h"
+
+#include <cstring>
+#include <map>
+#include <vector>
+
+using namespace WireCell;
+
+static const std::vector<int> idents{0, 1, 2};
+
+static const std::vector<std::string> exts{".tar", ".tar.gz"};
+
+// Selected out of file order.  With an index they come back in this
+// order and without in file order.
+static const std::vector<int> selection{2, 0};
+static const std::vector<int> scanned{0, 2};
+
+static float sample(int ident, int ch, int ind) { return 100 * ident + 10 * ch + ind; }
+
+static IFrame::pointer make_frame(int ident)
+{
+    ITrace::vector traces;
+    for (int ch = 10; ch < 13; ++ch) {
+        ITrace::ChargeSequence charge;
+        for (int ind = 0; ind < 5; ++ind) {
+            charge.push_back(sample(ident, ch, ind));
+        }
+        traces.push_back(std::make_shared<Aux::SimpleTrace>(ch, 0, charge));
+    }
+    auto sframe = std::make_shared<Aux::SimpleFrame>(ident, 0, traces);
+    sframe->tag_traces("gauss", IFrame::trace_list_t{0, 1, 2});
+    return sframe;
+}
+
+static ITensorSet::pointer make_tensor_set(int ident)
+{
+    std::vector<float> data;
+    for (int ind = 0; ind < 6; ++ind) {
+        data.push_back(sample(ident, 0, ind));
+    }
+    Configuration md;
+    md["ident"] = ident;
+    auto ten = std::make_shared<Aux::SimpleTensor>(ITensor::shape_t{2, 3}, data.data(), md);
+    auto tens = std::make_shared<ITensor::vector>(ITensor::vector{ten});
+    return std::make_shared<Aux::SimpleTensorSet>(ident, md, tens);
+}
+
+static void write_frames(const std::string& fname)
+{
+    Sio::FrameFileSink sink;
+    auto cfg = sink.default_configuration();
+    cfg["outname"] = fname;
+    cfg["tags"][0] = "gauss";
+    cfg["index"] = true;
+    sink.configure(cfg);
+    for (int ident : idents) {
+        REQUIRE(sink(make_frame(ident)));
+    }
+    REQUIRE(sink(nullptr));
+    sink.finalize();
+}
+
+static void write_tensors(const std::string& fname)
+{
+    Sio::TensorFileSink sink;
+    auto cfg = sink.default_configuration();
+    cfg["outname"] = fname;
+    cfg["index"] = true;
+    sink.configure(cfg);
+    for (int ident : idents) {
+        REQUIRE(sink(make_tensor_set(ident)));
+    }
+    REQUIRE(sink(nullptr));
+    sink.finalize();
+}
+
+static void check_frames(const std::string& fname, const std::vector<int>& want)
+{
+    Sio::FrameFileSource source;
+    auto cfg = source.default_configuration();
+    cfg["inname"] = fname;
+    cfg["tags"][0] = "gauss";
+    for (int ident : selection) {
+        cfg["idents"].append(ident);
+    }
+    source.configure(cfg);
+
+    for (int ident : want) {
+        IFrame::pointer frame;
+        REQUIRE(source(frame));
+        REQUIRE(frame);
+        CHECK(frame->ident() == ident);
+        auto traces = Aux::tagged_traces(frame, "gauss");
+        REQUIRE(traces.size() == 3);
+        for (const auto& trace : traces) {
+            const int ch = trace->channel();
+            const auto& charge = trace->charge();
+            REQUIRE(charge.size() == 5);
+            for (int ind = 0; ind < 5; ++ind) {
+                CHECK(charge[ind] == sample(ident, ch, ind));
+            }
+        }
+    }
+    IFrame::pointer frame;
+    REQUIRE(source(frame));
+    CHECK(! frame);
+}
+
+static void check_tensors(const std::string& fname, const std::vector<int>& want)
+{
+    Sio::TensorFileSource source;
+    auto cfg = source.default_configuration();
+    cfg["inname"] = fname;
+    for (int ident : selection) {
+        cfg["idents"].append(ident);
+    }
+    source.configure(cfg);
+
+    for (int ident : want) {
+        ITensorSet::pointer ts;
+        REQUIRE(source(ts));
+        REQUIRE(ts);
+        CHECK(ts->ident() == ident);
+        auto tens = ts->tensors();
+        REQUIRE(tens->size() == 1);
+        auto ten = tens->at(0);
+        CHECK(ten->metadata()["ident"].asInt() == ident);
+        REQUIRE(ten->shape() == ITensor::shape_t{2, 3});
+        std::vector<float> data(6);
+        REQUIRE(ten->size() == data.size() * sizeof(float));
+        std::memcpy(data.data(), ten->data(), ten->size());
+        for (int ind = 0; ind < 6; ++ind) {
+            CHECK(data[ind] == sample(ident, 0, ind));
+        }
+    }
+    ITensorSet::pointer ts;
+    REQUIRE(source(ts));
+    CHECK(! ts);
+}
+
+TEST_CASE("sio frame file index and idents")
+{
+    Persist::TempDir tmp("doctest-file-index-%%%%", true);
+    for (const auto& ext : exts) {
+        const std::string fname = (tmp.path / ("frames" + ext)).string();
+        write_frames(fname);
+        const std::string iname = Stream::index_name(fname);
+        REQUIRE(Persist::exists(iname));
+
+        // Seek with the index.
+        check_frames(fname, selection);
+
+        // Scan without it.
+        boost::filesystem::remove(iname);
+        check_frames(fname, scanned);
+    }
+}
+
+TEST_CASE("sio tensor file index and idents")
+{
+    Persist::TempDir tmp("doctest-file-index-%%%%", true);
+    for (const auto& ext : exts) {
+        const std::string fname = (tmp.path / ("tensors" + ext)).string();
+        write_tensors(fname);
+        const std::string iname = Stream::index_name(fname);
+        REQUIRE(Persist::exists(iname));
+
+        check_tensors(fname, selection);
+
+        boost::filesystem::remove(iname);
+        check_tensors(fname, scanned);
+    }
+}
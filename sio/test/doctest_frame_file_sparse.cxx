@@ -0,0 +1,93 @@
+#include "WireCellSio/FrameFileSink.h"
+#include "WireCellSio/FrameFileSource.h"
+#include "WireCellAux/SimpleFrame.h"
+#include "WireCellAux/SimpleTrace.h"
+#include "WireCellAux/FrameTools.h"
+#include "WireCellUtil/Persist.h"
+#include "WireCellUtil/Exceptions.h"
+#include "WireCellUtil/doctest.h"
+
+#include <map>
+
+using namespace WireCell;
+
+// Channel 11 is all zero and channel 13 is empty so neither has runs.
+static IFrame::pointer make_frame()
+{
+    ITrace::vector traces{
+        std::make_shared<Aux::SimpleTrace>(10, 3, ITrace::ChargeSequence{0, 4, 5, 0}),
+        std::make_shared<Aux::SimpleTrace>(11, 0, ITrace::ChargeSequence{0, 0, 0}),
+        std::make_shared<Aux::SimpleTrace>(12, 5, ITrace::ChargeSequence{1, 2, 0, 0, 3}),
+        std::make_shared<Aux::SimpleTrace>(13, 0, ITrace::ChargeSequence{}),
+    };
+    auto sframe = std::make_shared<Aux::SimpleFrame>(42, 0, traces);
+    sframe->tag_traces("gauss", IFrame::trace_list_t{0, 1, 2, 3},
+                       IFrame::trace_summary_t{1.5, 2.5, 3.5, 4.5});
+    return sframe;
+}
+
+TEST_CASE("sio frame file sparse round trip")
+{
+    Persist::TempDir tmp("doctest-frame-file-sparse-%%%%", true);
+    const std::string fname = (tmp.path / "frames.tar").string();
+
+    {
+        Sio::FrameFileSink sink;
+        auto cfg = sink.default_configuration();
+        cfg["outname"] = fname;
+        cfg["tags"][0] = "gauss";
+        cfg["sparse"] = true;
+        sink.configure(cfg);
+        REQUIRE(sink(make_frame()));
+        REQUIRE(sink(nullptr));
+        sink.finalize();
+    }
+
+    Sio::FrameFileSource source;
+    auto cfg = source.default_configuration();
+    cfg["inname"] = fname;
+    cfg["tags"][0] = "gauss";
+    source.configure(cfg);
+    IFrame::pointer frame;
+    REQUIRE(source(frame));
+    REQUIRE(frame);
+    CHECK(frame->ident() == 42);
+
+    auto traces = Aux::tagged_traces(frame, "gauss");
+    auto summary = frame->trace_summary("gauss");
+    REQUIRE(traces.size() == 4);
+    REQUIRE(summary.size() == traces.size());
+
+    // Traces stay one per channel and aligned with the summary.
+    std::map<int, ITrace::pointer> bych;
+    for (size_t ind = 0; ind < traces.size(); ++ind) {
+        const int ch = traces[ind]->channel();
+        CHECK(ch == 10 + (int) ind);
+        CHECK(summary[ind] == doctest::Approx(1.5 + ind));
+        bych[ch] = traces[ind];
+    }
+
+    // Traces span from the first to last run of their channel.
+    CHECK(bych[10]->tbin() == 4);
+    CHECK(bych[10]->charge() == ITrace::ChargeSequence{4, 5});
+    CHECK(bych[11]->charge().empty());
+    CHECK(bych[12]->tbin() == 5);
+    CHECK(bych[12]->charge() == ITrace::ChargeSequence{1, 2, 0, 0, 3});
+    CHECK(bych[13]->charge().empty());
+
+    REQUIRE(source(frame));
+    CHECK(! frame);
+}
+
+TEST_CASE("sio frame file sparse rejects baseline and offset")
+{
+    Persist::TempDir tmp("doctest-frame-file-sparse-%%%%", true);
+    for (const std::string param : {"baseline", "offset"}) {
+        Sio::FrameFileSink sink;
+        auto cfg = sink.default_configuration();
+        cfg["outname"] = (tmp.path / "frames.tar").string();
+        cfg["sparse"] = true;
+        cfg[param] = 2048.0;
+        CHECK_THROWS_AS(sink.configure(cfg), ValueError);
+    }
+}
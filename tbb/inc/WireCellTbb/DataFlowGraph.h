@@ -40,6 +40,10 @@ namespace WireCellTbb {
 
         // if 0, no summary logged, else log at level 1=debug, 2=info
         int m_summary{1};
+
+        // If given, write a Chrome trace event JSON file profiling
+        // every node call.
+        std::string m_profile{""};
         std::unordered_set<WireCellTbb::Node> m_nodes;
     };
 
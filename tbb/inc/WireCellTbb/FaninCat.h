@@ -33,13 +33,15 @@ namespace WireCellTbb {
         {
             auto msg_vec = as_msg_vector(tup);
             any_vector in;
+            size_t payload = 0;
             for (auto& msg : msg_vec) {
                 in.push_back(msg.second);
+                payload += m_info.payload(msg.second);
             }
             wct_t out;
-            m_info.start();
+            m_info.start(in.size(), payload);
             bool ok = (*m_wcnode)(in, out);
-            m_info.stop();
+            m_info.stop(1);
             if (!ok) {
                 std::cerr << "TbbFlow: fanin node return false ignored\n";
             }
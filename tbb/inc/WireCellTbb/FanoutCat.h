@@ -37,9 +37,9 @@ namespace WireCellTbb {
         TupleType operator()(msg_t in) const
         {
             any_vector anyvec;
-            m_info.start();
+            m_info.start(1, m_info.payload(in.second));
             bool ok = (*m_wcnode)(in.second, anyvec);
-            m_info.stop();
+            m_info.stop(1);
             if (!ok ) {
                 std::cerr << "TbbFlow: fanout call fails\n";
             }
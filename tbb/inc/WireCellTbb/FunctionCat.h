@@ -26,9 +26,9 @@ namespace WireCellTbb {
         msg_t operator()(const msg_t& in) const
         {
             wct_t out;
-            m_info.start();
+            m_info.start(1, m_info.payload(in.second));
             bool ok = (*m_wcnode)(in.second, out);
-            m_info.stop();
+            m_info.stop(1);
             if (!ok) {
                 std::cerr << "TbbFlow: function node return false ignored\n";
             }
@@ -21,6 +21,8 @@
 #include "WireCellIface/IHydraNode.h"
 #include "WireCellUtil/Exceptions.h"
 
+#include <algorithm>
+
 namespace WireCellTbb {
 
     /// The "any" interface to IHydraNode acccepts this type for both
@@ -158,9 +160,14 @@ namespace WireCellTbb {
             size_t index = in.first;
             iqv[index].push_back(in.second.second);
 
-            m_info.start();
+            m_info.start(1, m_info.payload(in.second.second));
             bool ok = (*m_wcnode)(iqv, oqv);
-            m_info.stop();
+            // Output ports may differ, take the most.
+            size_t nout = 0;
+            for (const auto& oq : oqv) {
+                nout = std::max(nout, oq.size());
+            }
+            m_info.stop(nout);
             if (!ok) {
                 std::cerr << "TbbFlow: hydra body return false ignored\n";
             }
@@ -4,20 +4,22 @@
 #include "WireCellIface/INode.h"
 #include "WireCellIface/INamed.h"
 #include "WireCellUtil/TupleHelpers.h"
+#include "WireCellUtil/SharedAny.h"
+#include "WireCellAux/NodeProfiler.h"
 
 #include <tbb/flow_graph.h>
-#include <boost/any.hpp>
 #include <iostream>
 #include <utility>              // make_index_sequence
 #include <string>
 #include <memory>
 #include <chrono>
 #include <map>
+#include <atomic>
 
 namespace WireCellTbb {
 
     // Message type passed through WCT nodes
-    using wct_t = boost::any;
+    using wct_t = WireCell::SharedAny;
 
     // We combine WCT data with a sequence number to assure order.
     using seqno_t = size_t;
@@ -60,17 +62,53 @@ namespace WireCellTbb {
             return "(unknown)";
         }
 
-        // Start/stop the stop watch.
-        void start() {
+        // Start/stop the stop watch around one call of the node.
+        // The call consumes nin messages holding the given payload
+        // (see payload()) and sends nout messages on each output
+        // port.  These counts let a profiler estimate the depth of
+        // the messages waiting on the node's input.
+        void start(size_t nin = 0, size_t payload = 0) {
+            if (m_profiler) {
+                m_begin = m_profiler->stamp();
+                m_payload = payload;
+                m_in_depth = 0;
+                for (const auto* up : m_upstream) {
+                    m_in_depth += up->sent();
+                }
+                m_in_depth -= m_nrecv;
+                if (m_in_depth < 0) { // racing a sender
+                    m_in_depth = 0;
+                }
+            }
+            m_nrecv += nin;
             m_clock = std::chrono::high_resolution_clock::now();
         }
-        void stop() {
+        void stop(size_t nout = 0) {
             duration_t delta = std::chrono::high_resolution_clock::now() - m_clock;
             m_runtime += delta;
             if (delta > m_maxrt) {
                 m_maxrt = delta;
             }
             ++m_calls;
+            if (m_profiler) {
+                m_profiler->record(m_profile_index, m_begin, m_profiler->stamp(),
+                                   m_in_depth, -1, m_payload);
+            }
+            m_nsent += nout;
+        }
+
+        // Record each call to the profiler.
+        void set_profiler(std::shared_ptr<WireCell::Aux::NodeProfiler> profiler);
+
+        // Note a node that sends messages to this one.
+        void add_upstream(const NodeInfo* info) { m_upstream.push_back(info); }
+
+        // Number of messages sent on each output port so far.
+        size_t sent() const { return m_nsent.load(std::memory_order_relaxed); }
+
+        // The payload size of a datum, only counted when profiling.
+        size_t payload(const wct_t& datum) const {
+            return m_profiler ? WireCell::Aux::NodeProfiler::payload_size(datum) : 0;
         }
 
         //using duration_t = std::chrono::high_resolution_clock::duration;
@@ -97,6 +135,15 @@ namespace WireCellTbb {
         time_point_t m_clock;
 
         size_t m_calls{0};
+
+        std::shared_ptr<WireCell::Aux::NodeProfiler> m_profiler;
+        size_t m_profile_index{0};
+        WireCell::Aux::NodeProfiler::Stamp m_begin;
+        long m_in_depth{0};
+        size_t m_payload{0};
+        size_t m_nrecv{0};
+        std::atomic<size_t> m_nsent{0};
+        std::vector<const NodeInfo*> m_upstream;
     };
     std::ostream& operator<<(std::ostream& os, const NodeInfo& info);
 
@@ -114,6 +161,7 @@ namespace WireCellTbb {
         virtual void initialize() {}
 
         const NodeInfo& info() const { return m_info; };
+        NodeInfo& info() { return m_info; };
       protected:
         NodeInfo m_info;
     };
@@ -29,9 +29,9 @@ namespace WireCellTbb {
         void operator()(const msg_t& in, mfunc_port& out)
         {
             WireCell::IQueuedoutNodeBase::queuedany outq;
-            m_info.start();
+            m_info.start(1, m_info.payload(in.second));
             bool ok = (*m_wcnode)(in.second, outq);
-            m_info.stop();
+            m_info.stop(ok ? outq.size() : 0);
             if (!ok) {
                 std::cerr << "TbbFlow: queuedout node return false ignored\n";
                 return;
@@ -24,7 +24,7 @@ namespace WireCellTbb {
         }
         tbb::flow::continue_msg operator()(const msg_t& in)
         {
-            m_info.start();
+            m_info.start(1, m_info.payload(in.second));
             bool ok = (*m_wcnode)(in.second);
             m_info.stop();
             if (!ok) {
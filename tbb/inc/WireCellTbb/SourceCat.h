@@ -26,7 +26,7 @@ namespace WireCellTbb {
             wct_t out;
             m_info.start();
             bool ok = (*m_wcnode)(out);
-            m_info.stop();
+            m_info.stop(ok ? 1 : 0);
             if (ok) {
                 return msg_t(m_seqno++, out);
             }
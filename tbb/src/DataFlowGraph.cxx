@@ -27,6 +27,7 @@ Configuration DataFlowGraph::default_configuration() const
     Configuration cfg;
     cfg["max_threads"] = 0;
     cfg["summary"] = m_summary;
+    cfg["profile"] = m_profile;
     return cfg;
 }
 
@@ -36,6 +37,7 @@ void DataFlowGraph::configure(const Configuration& cfg)
         m_thread_limit = cfg["max_threads"].asInt();
     }
     m_summary = get(cfg, "summary", m_summary);
+    m_profile = get(cfg, "profile", m_profile);
 }
 
 bool DataFlowGraph::connect(INode::pointer tail, INode::pointer head, size_t sport, size_t rport)
@@ -102,6 +104,7 @@ bool DataFlowGraph::connect(INode::pointer tail, INode::pointer head, size_t spo
     }
 
     make_edge(*s, *r);
+    myhead->info().add_upstream(&mytail->info());
     m_nodes.insert(mytail);
     m_nodes.insert(myhead);
     return true;
@@ -109,6 +112,14 @@ bool DataFlowGraph::connect(INode::pointer tail, INode::pointer head, size_t spo
 
 bool DataFlowGraph::run()
 {
+    std::shared_ptr<Aux::NodeProfiler> profiler;
+    if (!m_profile.empty()) {
+        profiler = std::make_shared<Aux::NodeProfiler>();
+    }
+    for (auto& node : m_nodes) {
+        node->info().set_profiler(profiler);
+    }
+
     for (auto it : m_factory.seen()) {
         //log->debug("Initialize node of type: {}", demangle(it.first->signature()));
         it.second->initialize();
@@ -122,6 +133,11 @@ bool DataFlowGraph::run()
     }
     m_graph.wait_for_all();
 
+    if (profiler) {
+        log->debug("writing node profile to {}", m_profile);
+        profiler->write(m_profile);
+    }
+
     if (m_summary) {
         std::vector<WireCellTbb::Node> nodes(m_nodes.begin(), m_nodes.end());
         std::sort(nodes.begin(), nodes.end(),
@@ -20,3 +20,17 @@ std::ostream& WireCellTbb::operator<<(std::ostream& os, const WireCellTbb::NodeI
 
     return os;
 }
+
+void WireCellTbb::NodeInfo::set_profiler(std::shared_ptr<WireCell::Aux::NodeProfiler> profiler)
+{
+    m_profiler = profiler;
+    if (!m_profiler) {
+        return;
+    }
+    std::string name = WireCell::type(*m_inode);
+    auto inamed = std::dynamic_pointer_cast<WireCell::INamed>(m_inode);
+    if (inamed) {
+        name += ":" + inamed->get_name();
+    }
+    m_profile_index = m_profiler->add_node(name);
+}
@@ -13,6 +13,7 @@ using namespace WireCell;
 
 // message types
 using WireCellTbb::msg_t;
+using WireCellTbb::wct_t;
 using WireCellTbb::tagged_msg_t;
 
 // port types
@@ -49,7 +50,7 @@ class SourceBody {
             ss << "-> " << id << ": " << count
                << " " << (void*) this << "\n";
             std::cerr << ss.str();
-            boost::any aid = id;
+            wct_t aid = std::make_shared<const int>(id);
             return std::make_pair(count++, aid);
         }
         fc.stop();
@@ -68,7 +69,7 @@ struct SinkBody {
     {
         auto& [p,m] = in;
         auto& [n,aid] = m;
-        auto id = boost::any_cast<int>(aid);
+        auto id = *aid.as<std::shared_ptr<const int>>();
         std::stringstream ss;
         ss << "<- " << id << ": " << n << " " << p << "\n";
         std::cerr << ss.str();
@@ -156,6 +156,19 @@ function file_larger_than () {
     [[ "$fsize" -gt "$minsize" ]]
 }
 
+# unpack_frames <filename>
+#
+# Unpack a .tar.gz frame file into a fresh directory named after it
+# less the extension and echo the directory name.
+function unpack_frames () {
+    local ff="$1"; shift
+    local dir="${ff%.tar.gz}"
+    rm -rf "$dir"
+    mkdir -p "$dir"
+    tar -C "$dir" -xf "$ff"
+    echo "$dir"
+}
+
 
 # check <command line>
 #
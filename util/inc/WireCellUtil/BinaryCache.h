@@ -0,0 +1,63 @@
+/** A binary cache for large, read-only data files.
+ *
+ * Field response, wire geometry and noise spectra files are JSON,
+ * typically bzip2 compressed, and can take seconds to decompress and
+ * parse.  Their loaders may instead keep the numerical content in a
+ * compact Numpy .npz file placed in a cache directory.  The cache file
+ * name carries a hash of the source file content so a changed source
+ * never matches a stale cache.
+ *
+ * Caching is enabled by setting the WIRECELL_CACHE environment
+ * variable to a directory.  A loader that finds no cache file parses
+ * the source as usual and then writes the cache file for the next job.
+ * The wcbincache program may prepare cache files ahead of time.
+ */
+
+#ifndef WIRECELLUTIL_BINARYCACHE
+#define WIRECELLUTIL_BINARYCACHE
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace WireCell::BinaryCache {
+
+    /// Return the cache directory or empty string if caching is disabled.
+    std::string directory();
+
+    /// Return a hash of the content of the file as hexadecimal digits.
+    std::string content_hash(const std::string& filename);
+
+    /// Return a hash of the text as hexadecimal digits.
+    std::string text_hash(const std::string& text);
+
+    /// Return the path to the cache file for the source file holding
+    /// data of the given kind (eg "fr", "wires").  The source file is
+    /// resolved against WIRECELL_PATH.  If dir is empty, directory()
+    /// is used.  An empty string is returned if caching is disabled or
+    /// the source file can not be found.
+    std::string path(const std::string& filename, const std::string& kind,
+                     const std::string& dir = "");
+
+    /// The flat arrays of a cache file.
+    struct Arrays {
+        std::map<std::string, std::vector<double>> reals;
+        std::map<std::string, std::vector<int>> ints;
+
+        /// Return named array, throw KeyError if missing.
+        const std::vector<double>& real(const std::string& name) const;
+        const std::vector<int>& integer(const std::string& name) const;
+    };
+
+    /// Load arrays from a cache file.  Return false if the file does
+    /// not exist or can not be read.
+    bool load(const std::string& cpath, Arrays& arrays);
+
+    /// Save arrays to a cache file.  The file is written under a
+    /// temporary name and renamed so concurrent jobs never see a
+    /// partial file.  Return false if the file can not be written.
+    bool save(const std::string& cpath, const Arrays& arrays);
+
+}  // namespace WireCell::BinaryCache
+
+#endif
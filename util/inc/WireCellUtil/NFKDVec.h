@@ -8,7 +8,9 @@
 #include "WireCellUtil/Exceptions.h"
 #include "WireCellUtil/Point.h"
 #include "WireCellUtil/PointCloudDataset.h"
+#include "WireCellUtil/Spdlog.h"
 
+#include <atomic>
 #include <vector>
 #include <numeric>              // iota
 
@@ -105,6 +107,30 @@ namespace WireCell::NFKDVec {
         {
         }
 
+        // The point call counter is atomic so moves are spelled out.
+        // Any index is dropped and remade on the next query as it
+        // refers to the moved-from tree.
+        Tree(Tree&& other)
+            : m_points(std::move(other.m_points))
+            , m_nblocks(other.m_nblocks)
+            , m_major_indices(std::move(other.m_major_indices))
+            , m_minor_indices(std::move(other.m_minor_indices))
+            , m_point_calls(other.m_point_calls.load())
+        {
+            other.m_nfkdindex = nullptr;
+        }
+        Tree& operator=(Tree&& other)
+        {
+            m_points = std::move(other.m_points);
+            m_nblocks = other.m_nblocks;
+            m_nfkdindex = nullptr;
+            other.m_nfkdindex = nullptr;
+            m_major_indices = std::move(other.m_major_indices);
+            m_minor_indices = std::move(other.m_minor_indices);
+            m_point_calls = other.m_point_calls.load();
+            return *this;
+        }
+
         // Return the number of dimensions of the K-D space
         const size_t ndim() const { return m_points.size(); }
 
@@ -215,9 +241,18 @@ namespace WireCell::NFKDVec {
         }
 
         // Return the number calls made so far to resolve a point
-        // coordinate.  Mostly for debugging/perfing.
+        // coordinate.  Mostly for debugging/perfing.  The count is
+        // only kept when built with an SPDLOG_ACTIVE_LEVEL of DEBUG
+        // or lower as it sits in the innermost loop of a query.
         size_t point_calls() const { return m_point_calls; }        
 
+        // Build the k-d tree index now instead of on the first query.
+        // Queries on an unmodified tree are safe to make concurrently
+        // once this has been called.
+        void prepare() const {
+            this->prepquery<nfkdindex_type>();
+        }
+
 
         template<typename VectorLike>
         results_type knn(size_t kay, const VectorLike& query_point) const {
@@ -275,7 +310,9 @@ namespace WireCell::NFKDVec {
 
         // nanoflann API.  Value of a point's dimension coordinate.
         inline element_type kdtree_get_pt(size_t idx, size_t dim) const {
-            ++m_point_calls;
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+            m_point_calls.fetch_add(1, std::memory_order_relaxed);
+#endif
             return m_points.at(dim).at(idx);
         }
 
@@ -286,7 +323,7 @@ namespace WireCell::NFKDVec {
         mutable std::unique_ptr<nfkdindex_type> m_nfkdindex;
         block_indices_type m_major_indices, m_minor_indices;
 
-        mutable size_t m_point_calls{0};
+        mutable std::atomic<size_t> m_point_calls{0};
         
 
         // discovery idiom to figure out how to add points given the
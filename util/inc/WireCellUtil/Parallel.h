@@ -0,0 +1,34 @@
+/** Simple intra-node parallelism.
+
+    Components may use this to spread independent jobs of one call
+    over a few threads without requiring a particular threading
+    library.  Jobs are identified by index and callers should collect
+    results by index in order to merge them deterministically.
+ */
+
+#ifndef WIRECELL_PARALLEL
+#define WIRECELL_PARALLEL
+
+#include <cstddef>
+#include <functional>
+
+namespace WireCell::Parallel {
+
+    using job_function = std::function<void(size_t index)>;
+
+    /// Return the number of threads to use given a requested number.
+    /// As with the "nthreads" parameter of components, zero means
+    /// serial.  The result is at least 1.
+    size_t nthreads(size_t requested);
+
+    /// Call func(index) for each index in [0, njobs) using up to
+    /// nthreads threads (see above for zero).  Jobs run in an
+    /// unspecified order.  Returns when all jobs are done.  If one
+    /// or more jobs throw, remaining jobs are not started and the
+    /// first exception is rethrown here.  With one thread or one
+    /// job, all jobs run in the calling thread.
+    void for_each(size_t njobs, job_function func, size_t nthreads = 0);
+
+}  // namespace WireCell::Parallel
+
+#endif
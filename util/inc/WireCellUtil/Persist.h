@@ -37,6 +37,8 @@ extern "C" {
     struct JsonnetVm;
 }
 #include <boost/filesystem.hpp>
+#include <map>
+#include <set>
 #include <vector>
 #include <string>
 
@@ -163,6 +165,15 @@ namespace WireCell {
 
         // An class version of the above free functions which more
         // control over the load path.
+        //
+        // If a cache directory is set, by default from WIRECELL_CACHE,
+        // the JSON resulting from evaluating a Jsonnet file is saved
+        // there and later loads with identical input skip Jsonnet
+        // evaluation.  The cache key covers the content of the file,
+        // each import literal and the content of the file it resolves
+        // to and all external variables and top level arguments.  It
+        // holds no paths so a cache filled in one directory is used
+        // from any other.
         class Parser {
            public:
             typedef std::vector<std::string> pathlist_t;
@@ -193,10 +204,31 @@ namespace WireCell {
             // Resolve absolute path to a file against load path
             std::string resolve(const std::string& filename);
 
+            // Set directory in which to cache evaluated Jsonnet.  An
+            // empty string disables the cache.
+            void set_cache(const std::string& dir);
+
+            // Return the path of the cache file for evaluating the
+            // Jsonnet file or empty string if caching is disabled.
+            std::string cache_path(const std::string& filename);
+
            private:
             using JVM = struct JsonnetVm;
             JVM* m_jvm{nullptr};
             std::vector<boost::filesystem::path> m_load_paths;
+
+            // The variables and arguments bound into the VM, as part
+            // of the cache key.  Load paths matter only through the
+            // files they resolve and are not included.
+            std::string m_bound;
+            std::string m_cache_dir;
+
+            // Add to closure the files imported by the file,
+            // recursively, mapped to their content hash.  Add to edges
+            // each import literal keyed by the hash of the importing
+            // and imported file.
+            void imports(const std::string& fname, std::map<std::string, std::string>& closure,
+                         std::set<std::string>& edges);
         };
     }  // namespace Persist
 }  // namespace WireCell
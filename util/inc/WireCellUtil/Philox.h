@@ -0,0 +1,104 @@
+/** The Philox4x32-10 counter-based random number generator.
+
+    Salmon, Moraes, Dror and Shaw, "Parallel random numbers: as easy
+    as 1, 2, 3", SC11.
+
+    A counter-based generator produces the n'th block of random bits
+    as a pure function of a key and a counter.  Independent streams
+    are had by giving each a distinct key or a distinct range of
+    counters and any stream may be positioned anywhere in constant
+    time.
+
+    Here, the 64 bit key selects the sequence, the upper 64 bits of
+    the counter select a stream within that sequence and the lower 64
+    bits count blocks of four 32 bit words within the stream.
+
+    The Philox class satisfies the C++ UniformRandomBitGenerator
+    requirements and so may drive std::*_distribution.
+ */
+
+#ifndef WIRECELLUTIL_PHILOX
+#define WIRECELLUTIL_PHILOX
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace WireCell {
+
+    class Philox {
+      public:
+        using result_type = uint32_t;
+        using block_t = std::array<uint32_t, 4>;
+
+        /// Apply the ten round bijection to a counter under a key.
+        static block_t generate(block_t ctr, uint64_t key)
+        {
+            uint32_t k0 = key, k1 = key >> 32;
+            for (int round = 0; round < 10; ++round) {
+                const uint64_t p0 = uint64_t(0xD2511F53) * ctr[0];
+                const uint64_t p1 = uint64_t(0xCD9E8D57) * ctr[2];
+                ctr = {uint32_t(p1 >> 32) ^ ctr[1] ^ k0, uint32_t(p1),
+                       uint32_t(p0 >> 32) ^ ctr[3] ^ k1, uint32_t(p0)};
+                k0 += 0x9E3779B9;
+                k1 += 0xBB67AE85;
+            }
+            return ctr;
+        }
+
+        explicit Philox(uint64_t key = 0, uint64_t stream = 0)
+          : m_key(key)
+          , m_stream(stream)
+        {
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        /// Return the next 32 random bits.
+        result_type operator()()
+        {
+            if (m_used == 4) {
+                m_block = generate(counter(), m_key);
+                ++m_index;
+                m_used = 0;
+            }
+            return m_block[m_used++];
+        }
+
+        /// Return the next 64 random bits.
+        uint64_t next64()
+        {
+            const uint64_t lo = (*this)();
+            return (uint64_t((*this)()) << 32) | lo;
+        }
+
+        /// Return a uniform double in [0,1) with 53 random bits.
+        double uniform() { return (next64() >> 11) * 0x1.0p-53; }
+
+        /// Position the generator at the start of a block.
+        void seek(uint64_t index)
+        {
+            m_index = index;
+            m_used = 4;
+        }
+
+        uint64_t key() const { return m_key; }
+        uint64_t stream() const { return m_stream; }
+
+      private:
+        block_t counter() const
+        {
+            return {uint32_t(m_index), uint32_t(m_index >> 32),
+                    uint32_t(m_stream), uint32_t(m_stream >> 32)};
+        }
+
+        uint64_t m_key, m_stream;
+        uint64_t m_index{0};
+        block_t m_block{};
+        int m_used{4};
+    };
+
+}  // namespace WireCell
+
+#endif
@@ -0,0 +1,78 @@
+/** A type-erased shared pointer to a const object.
+
+    SharedAny holds a std::shared_ptr<const T> for any T along with
+    the type T.  It is used to pass IData pointers through the ports
+    of data flow graph nodes.
+
+    Unlike a boost::any holding a shared pointer, the pointer is held
+    in place and so constructing, copying and casting a SharedAny
+    never allocates.  Casting compares type_info and does not need
+    RTTI of the held object.
+
+    A null pointer retains its type so that end-of-stream markers may
+    be passed and cast as usual.
+ */
+
+#ifndef WIRECELLUTIL_SHAREDANY
+#define WIRECELLUTIL_SHAREDANY
+
+#include "WireCellUtil/Exceptions.h"
+#include "WireCellUtil/Type.h"
+
+#include <memory>
+#include <typeinfo>
+#include <type_traits>
+
+namespace WireCell {
+
+    class SharedAny {
+       public:
+        SharedAny() = default;
+
+        template <typename T>
+        SharedAny(std::shared_ptr<T> ptr)
+          : m_ptr(std::move(ptr))
+          , m_type(&typeid(std::remove_const_t<T>))
+        {
+        }
+
+        // True if no typed pointer, null or otherwise, is held.
+        bool empty() const { return m_type == nullptr; }
+
+        // The type of the object pointed to, void if empty.
+        const std::type_info& type() const { return m_type ? *m_type : typeid(void); }
+
+        // True if holding a (possibly null) pointer to T.
+        template <typename T>
+        bool is() const
+        {
+            return m_type and *m_type == typeid(std::remove_const_t<T>);
+        }
+
+        // Return the held pointer as a Pointer which must be a
+        // std::shared_ptr<const T> for the held T.  A TypeError is
+        // thrown on mismatch.
+        //
+        //     auto frame = sa.as<IFrame::pointer>();
+        template <typename Pointer>
+        Pointer as() const
+        {
+            using element_type = typename Pointer::element_type;
+            if (!is<element_type>()) {
+                raise<TypeError>("SharedAny holds %s, not %s", demangle(type().name()),
+                                 demangle(typeid(std::remove_const_t<element_type>).name()));
+            }
+            return std::static_pointer_cast<element_type>(m_ptr);
+        }
+
+        // The held pointer with its type erased.
+        const std::shared_ptr<const void>& pointer() const { return m_ptr; }
+
+       private:
+        std::shared_ptr<const void> m_ptr;
+        const std::type_info* m_type{nullptr};
+    };
+
+}  // namespace WireCell
+
+#endif
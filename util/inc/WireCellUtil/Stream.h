@@ -25,6 +25,8 @@
 
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -43,6 +45,74 @@ namespace WireCell::Stream {
     /// supported file types.
     using custard::output_filters;
 
+    /// A sink device which compresses the bytes it is given in blocks
+    /// on background threads and writes each block as one gzip or
+    /// bzip2 member to a file.  A file of concatenated members is a
+    /// valid .gz or .bz2 file as read by input_filters() and by the
+    /// usual command line tools.  At most nthreads blocks are in
+    /// flight.  Compression errors are rethrown by write() or close().
+    ///
+    /// With codec none, blocks are written as-is.  This is useful
+    /// only to learn member offsets (see restart()).
+    class parallel_compressor {
+      public:
+        typedef char char_type;
+        struct category :
+            public boost::iostreams::sink_tag,
+            public boost::iostreams::closable_tag
+        { };
+
+        enum class codec { none, gzip, bzip2 };
+
+        parallel_compressor(const std::string& outname, codec comp, int level,
+                            size_t nthreads, size_t block_size = 1 << 22);
+
+        std::streamsize write(const char* s, std::streamsize n);
+        void close();
+
+        /// End the current member so that the next bytes written
+        /// start a new one.  Return the index of that new member.
+        size_t restart();
+
+        /// Return the file offset at which each member starts
+        /// followed by the file size.  Only complete after close().
+        std::vector<size_t> offsets() const;
+
+      private:
+        // this class must be copyable so put non-copyable into shared ptr
+        struct impl;
+        std::shared_ptr<impl> m_impl;
+    };
+
+    /// As output_filters() but gzip or bzip2 compression, if wanted,
+    /// is done by a parallel_compressor with nthreads threads.  An
+    /// uncompressed tar file is also written through one, with codec
+    /// none.  With nthreads of zero or for other outnames this is
+    /// identical to output_filters().
+    void parallel_output_filters(boost::iostreams::filtering_ostream& out,
+                                 const std::string& outname, size_t nthreads,
+                                 int level = 1, size_t block_size = 1 << 22);
+
+    /// As input_filters() but start reading the file at the offset.
+    /// The offset must be the start of a member as given by
+    /// parallel_compressor::offsets() or a tar header of a plain tar.
+    void input_filters(boost::iostreams::filtering_istream& in,
+                       const std::string& inname, size_t offset);
+
+    /// An archive may have a sidecar index file named after it.  It
+    /// holds a JSON object with "offsets", an array of [ident, offset]
+    /// pairs giving the file offset where the entries for an ident
+    /// start.
+    inline std::string index_name(const std::string& archive) {
+        return archive + ".index.json";
+    }
+    using index_entries_t = std::vector<std::pair<int, size_t>>;
+    void save_index(const std::string& archive, const index_entries_t& entries);
+
+    /// Return the offset of the first entry of each ident in the
+    /// sidecar index or empty map if the archive has none.
+    std::map<int, size_t> load_index(const std::string& archive);
+
     /// Note, to use these practically, the ostreams need to end in a
     /// tar, zip or other container filter.
 
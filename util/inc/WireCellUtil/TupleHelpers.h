@@ -4,12 +4,15 @@
  * and run-time access of the collection tuple's.  Compile-time
  * elements are held as types in the tuple, run-time are held as
  * boost::any in a std::vector<boost::any> or other collection.
+ * Tuples of shared pointers may instead be held as SharedAny.
  *
  */
 
 #ifndef WIRECELLUTIL_TUPLEHELPERS
 #define WIRECELLUTIL_TUPLEHELPERS
 
+#include "WireCellUtil/SharedAny.h"
+
 #include <boost/any.hpp>
 
 #include <tuple>
@@ -119,6 +122,38 @@ namespace WireCell {
             return from_any_impl(anyv, std::make_index_sequence<std::tuple_size<tuple_type>::value>{});
         }
 
+        // The SharedAny variants require each tuple element to be a
+        // std::shared_ptr<const T>.
+        typedef std::vector<SharedAny> shared_any_vector_type;
+
+        // internal
+        template <std::size_t... Indices>
+        shared_any_vector_type as_shared_any_impl(const tuple_type& t, std::index_sequence<Indices...>)
+        {
+            return {SharedAny(std::get<Indices>(t))...};
+        }
+
+        /** Convert a tuple of shared pointers to a vector of SharedAny.
+         */
+        shared_any_vector_type as_shared_any(const tuple_type& t)
+        {
+            return as_shared_any_impl(t, std::make_index_sequence<std::tuple_size<tuple_type>::value>{});
+        }
+
+        // internal
+        template <std::size_t... Indices>
+        tuple_type from_shared_any_impl(const shared_any_vector_type& anyv, std::index_sequence<Indices...>)
+        {
+            return std::make_tuple(anyv[Indices].template as<Types>()...);
+        }
+
+        /** Return a tuple of shared pointers made from a vector of SharedAny.
+         */
+        tuple_type from_shared_any(const shared_any_vector_type& anyv)
+        {
+            return from_shared_any_impl(anyv, std::make_index_sequence<std::tuple_size<tuple_type>::value>{});
+        }
+
     };  // tuple_helpers
 
     template <typename T, std::size_t... Indices>
@@ -151,7 +186,7 @@ namespace WireCell {
             typedef std::tuple<Container<std::shared_ptr<const Types> >...> type;
         };
 
-        typedef std::deque<boost::any> any_queue_type;
+        typedef std::deque<SharedAny> any_queue_type;
 
         // This is a tuple<deque<shared_ptr<T1>>, deque<shared_ptr<T2>>, ...>
         typedef typename WrappedShared<std::deque>::type shared_queued_tuple_type;
@@ -171,17 +206,14 @@ namespace WireCell {
             return {as_any_queue_convert(std::get<Indices>(toq))...};
         }
 
-        /** Convert a tuple of queues of types to a vector of queues of boost::any.
+        /** Convert a tuple of queues of types to a vector of queues of SharedAny.
          *
          *     typedef typename tuple_helper<IFDCS>::Wrapped<std::deque>::type IFDCS_queues;
          *     IFDCS_queues qs;
          *     auto any_q = as_any_queue(qs);
          *     cerr << "First element from each queue:\n";
-         *     cerr << any_cast<int>(any_q[0][0]) << endl;
-         *     cerr << any_cast<float>(any_q[1][0]) << endl;
-         *     cerr << any_cast<double>(any_q[2][0]) << endl;
-         *     cerr << any_cast<char>(any_q[3][0]) << endl;
-         *     cerr << any_cast<std::string>(any_q[4][0]) << endl;
+         *     cerr << *any_q[0][0].as<std::shared_ptr<const int>>() << endl;
+         *     cerr << *any_q[4][0].as<std::shared_ptr<const std::string>>() << endl;
          */
         std::vector<any_queue_type> as_any_queue(const shared_queued_tuple_type& toq)
         {
@@ -194,7 +226,7 @@ namespace WireCell {
         {
             std::deque<std::shared_ptr<const Type> > ret;
             for (auto a : aq) {
-                ret.push_back(boost::any_cast<std::shared_ptr<const Type> >(a));
+                ret.push_back(a.template as<std::shared_ptr<const Type> >());
             }
             return ret;
         }
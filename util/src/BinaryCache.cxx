@@ -0,0 +1,183 @@
+#include "WireCellUtil/BinaryCache.h"
+#include "WireCellUtil/Persist.h"
+#include "WireCellUtil/Exceptions.h"
+#include "WireCellUtil/Logging.h"
+#include "WireCellUtil/String.h"
+#include "WireCellUtil/cnpy.h"
+
+#include <boost/filesystem.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+
+using namespace WireCell;
+using spdlog::debug;
+using spdlog::warn;
+
+// Bump when the layout of any cached arrays changes.
+static const std::string cache_format = "v1";
+
+std::string BinaryCache::directory()
+{
+    const char* dir = std::getenv("WIRECELL_CACHE");
+    if (!dir) {
+        return "";
+    }
+    return dir;
+}
+
+// 64 bit FNV-1a.
+static const uint64_t fnv_offset = 0xcbf29ce484222325ULL;
+static uint64_t fnv_update(uint64_t hash, const char* data, size_t size)
+{
+    for (size_t ind = 0; ind < size; ++ind) {
+        hash ^= static_cast<unsigned char>(data[ind]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static std::string fnv_digest(uint64_t hash)
+{
+    return String::format("%016llx", (unsigned long long) hash);
+}
+
+std::string BinaryCache::content_hash(const std::string& filename)
+{
+    uint64_t hash = fnv_offset;
+    std::ifstream fstr(filename, std::ios::binary);
+    if (!fstr) {
+        THROW(IOError() << errmsg{"failed to open " + filename});
+    }
+    std::vector<char> buf(1 << 16);
+    while (fstr) {
+        fstr.read(buf.data(), buf.size());
+        hash = fnv_update(hash, buf.data(), fstr.gcount());
+    }
+    return fnv_digest(hash);
+}
+
+std::string BinaryCache::text_hash(const std::string& text)
+{
+    return fnv_digest(fnv_update(fnv_offset, text.data(), text.size()));
+}
+
+std::string BinaryCache::path(const std::string& filename, const std::string& kind, const std::string& dir)
+{
+    const std::string cdir = dir.empty() ? directory() : dir;
+    if (cdir.empty()) {
+        return "";
+    }
+    const std::string source = Persist::resolve(filename);
+    if (source.empty()) {
+        return "";
+    }
+
+    // Strip all extensions, eg .json.bz2, for a recognizable name.
+    std::string stem = boost::filesystem::path(source).filename().string();
+    stem = stem.substr(0, stem.find('.'));
+
+    const auto name = String::format("%s-%s-%s-%s.npz", stem, kind, cache_format, content_hash(source));
+    return (boost::filesystem::path(cdir) / name).string();
+}
+
+const std::vector<double>& BinaryCache::Arrays::real(const std::string& name) const
+{
+    auto it = reals.find(name);
+    if (it == reals.end()) {
+        THROW(KeyError() << errmsg{"no real array in cache: " + name});
+    }
+    return it->second;
+}
+
+const std::vector<int>& BinaryCache::Arrays::integer(const std::string& name) const
+{
+    auto it = ints.find(name);
+    if (it == ints.end()) {
+        THROW(KeyError() << errmsg{"no integer array in cache: " + name});
+    }
+    return it->second;
+}
+
+bool BinaryCache::load(const std::string& cpath, Arrays& arrays)
+{
+    if (cpath.empty() || !boost::filesystem::exists(cpath)) {
+        return false;
+    }
+    cnpy::npz_t npz;
+    try {
+        npz = cnpy::npz_load(cpath);
+    }
+    catch (const std::runtime_error& err) {
+        warn("BinaryCache: failed to read {}: {}", cpath, err.what());
+        return false;
+    }
+    for (const auto& [name, arr] : npz) {
+        if (arr.word_size == sizeof(double)) {
+            auto& vec = arrays.reals[name];
+            if (arr.num_vals) {
+                vec = arr.as_vec<double>();
+            }
+        }
+        else if (arr.word_size == sizeof(int)) {
+            auto& vec = arrays.ints[name];
+            if (arr.num_vals) {
+                vec = arr.as_vec<int>();
+            }
+        }
+        else {
+            warn("BinaryCache: unexpected word size {} for {} in {}", arr.word_size, name, cpath);
+            return false;
+        }
+    }
+    debug("BinaryCache: loaded {}", cpath);
+    return true;
+}
+
+template <typename T>
+static void save_array(const std::string& fname, const std::string& name, const std::vector<T>& vec,
+                       std::string& mode)
+{
+    static const T empty{};
+    const T* data = vec.empty() ? &empty : vec.data();
+    cnpy::npz_save<T>(fname, name, data, {vec.size()}, mode);
+    mode = "a";
+}
+
+bool BinaryCache::save(const std::string& cpath, const Arrays& arrays)
+{
+    namespace bfs = boost::filesystem;
+    if (cpath.empty()) {
+        return false;
+    }
+    boost::system::error_code ec;
+    bfs::create_directories(bfs::path(cpath).parent_path(), ec);
+    const auto tmp = cpath + "." + bfs::unique_path().string();
+    if (!std::ofstream(tmp, std::ios::binary)) {  // cnpy does not check
+        warn("BinaryCache: failed to write {}", tmp);
+        return false;
+    }
+    try {
+        std::string mode = "w";
+        for (const auto& [name, vec] : arrays.reals) {
+            save_array(tmp, name, vec, mode);
+        }
+        for (const auto& [name, vec] : arrays.ints) {
+            save_array(tmp, name, vec, mode);
+        }
+    }
+    catch (const std::runtime_error& err) {
+        warn("BinaryCache: failed to write {}: {}", tmp, err.what());
+        bfs::remove(tmp, ec);
+        return false;
+    }
+    bfs::rename(tmp, cpath, ec);
+    if (ec) {
+        warn("BinaryCache: failed to write {}: {}", cpath, ec.message());
+        bfs::remove(tmp, ec);
+        return false;
+    }
+    debug("BinaryCache: saved {}", cpath);
+    return true;
+}
@@ -40,16 +40,17 @@ std::vector<size_t> WireCell::ElasticNetModel::Fit()
     int nbeta = beta.size();
     _active_beta = vector<bool>(nbeta, true);
 
-    // use alias for easy notation
-    Eigen::VectorXd y = Gety();
-    Eigen::MatrixXd X = GetX();
+    // The design matrix is typically very sparse (eg, blob-wire
+    // incidence) so work with a sparse copy.
+    const Eigen::VectorXd& y = Gety();
+    const Eigen::SparseMatrix<double> X = GetX().sparseView();
 
     // cooridate decsent
 
     // int N = y.size();
-    VectorXd norm(nbeta);
+    VectorXd norm(nbeta), sqnorm(nbeta);
     for (int j = 0; j < nbeta; j++) {
-        norm(j) = X.col(j).squaredNorm();
+        sqnorm(j) = norm(j) = X.col(j).squaredNorm();
         if (norm(j) < 1e-6) {
             // cerr << "warning: the " << j << "th variable is not used, please consider removing it." << endl;
             below_threshold.push_back(j);
@@ -58,6 +59,10 @@ std::vector<size_t> WireCell::ElasticNetModel::Fit()
     }
     double tol2 = TOL * TOL * nbeta;
 
+    // The residual y - X*beta is kept up to date as each coordinate
+    // changes instead of being remade for each coordinate.
+    VectorXd resid = y - X * beta;
+
     int double_check = 0;
     for (int i = 0; i < max_iter; i++) {
         VectorXd betalast = beta;
@@ -65,23 +70,29 @@ std::vector<size_t> WireCell::ElasticNetModel::Fit()
             if (!_active_beta[j]) {
                 continue;
             }
-            VectorXd X_j = X.col(j);
-            VectorXd beta_tmp = beta;
-            beta_tmp(j) = 0;
-            VectorXd r_j = (y - X * beta_tmp);
-            double delta_j = X_j.dot(r_j);
+            // Correlation of column j with the residual excluding
+            // column j's own contribution.
+            const double beta_j = beta(j);
+            double delta_j = sqnorm(j) * beta_j;
+            for (SparseMatrix<double>::InnerIterator it(X, j); it; ++it) {
+                delta_j += it.value() * resid(it.row());
+            }
             //            beta(j) = _soft_thresholding(delta_j, N*lambda*alpha*lambda_weight(j)) / (1+lambda*(1-alpha))
             //            / norm(j);
             beta(j) =
                 _soft_thresholding(delta_j / norm(j), lambda * alpha * lambda_weight(j)) / (1 + lambda * (1 - alpha));
 
+            const double change = beta(j) - beta_j;
+            if (change != 0) {
+                for (SparseMatrix<double>::InnerIterator it(X, j); it; ++it) {
+                    resid(it.row()) -= it.value() * change;
+                }
+            }
+
             // cout << i << " " << j << " " << beta(j) << std::endl;
             if (fabs(beta(j)) < 1e-6) {
                 _active_beta[j] = false;
             }
-            // else { cout << beta(j) << endl;}
-            // beta(j) = _soft_thresholding(delta_j, N*lambda*alpha, j) / (1+lambda*(1-alpha)) / norm(j);
-            // if (j==0) cout << beta(j) << ", " << arg1 << endl;
         }
         double_check++;
         // cout << endl;
@@ -90,6 +101,7 @@ std::vector<size_t> WireCell::ElasticNetModel::Fit()
         // std::cout << i << " " << diff.squaredNorm() << " " << tol2 << std::endl;
         if (diff.squaredNorm() < tol2) {
             if (double_check != 1) {
+                // Converged on the active set, now check all.
                 double_check = 0;
                 for (int k = 0; k < nbeta; k++) {
                     _active_beta[k] = true;
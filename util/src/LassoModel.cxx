@@ -42,8 +42,10 @@ std::vector<size_t> WireCell::LassoModel::Fit()
     int nbeta = beta.size();
     _active_beta = vector<bool>(nbeta, true);
 
-    Eigen::VectorXd y = Gety();
-    Eigen::MatrixXd X = GetX();
+    // The design matrix is typically very sparse (eg, blob-wire
+    // incidence) so work with a sparse copy.
+    const Eigen::VectorXd& y = Gety();
+    const Eigen::SparseMatrix<double> X = GetX().sparseView();
 
     // cooridate decsent
     // int N = y.size();
@@ -58,20 +60,11 @@ std::vector<size_t> WireCell::LassoModel::Fit()
     }
     double tol2 = TOL * TOL * nbeta;
 
-    // calculate the inner product
-    Eigen::VectorXd ydX(nbeta);
-    Eigen::SparseMatrix<double> XdX(nbeta, nbeta);
-    for (int i = 0; i != nbeta; i++) {
-        ydX(i) = y.dot(X.col(i));
-        // beta(i) = ydX(i) / norm(i); // first time result saved here ...
-        for (int j = 0; j != nbeta; j++) {
-            double value = X.col(i).dot(X.col(j));
-            if (value != 0) XdX.insert(i, j) = value;
-            // std::cout << i << " " << j << " " << value << " " << XdX.coeffRef(i,j) << std::endl;
-        }
-        // std::cout << ydX(i) << " " << norm(i) << std::endl;
-    }
-    //  std::cout << "Xin " << nbeta << std::endl;
+    // calculate the inner products.  The Gram matrix is made as a
+    // sparse product which costs of order the number of its nonzero
+    // elements instead of nbeta^2 dense dot products.
+    const Eigen::VectorXd ydX = X.transpose() * y;
+    const Eigen::SparseMatrix<double> XdX = Eigen::SparseMatrix<double>(X.transpose() * X).pruned();
 
     // start interation ...
     int double_check = 0;
@@ -0,0 +1,63 @@
+#include "WireCellUtil/Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace WireCell;
+
+size_t Parallel::nthreads(size_t requested)
+{
+    return std::max<size_t>(1, requested);
+}
+
+void Parallel::for_each(size_t njobs, job_function func, size_t nthreads)
+{
+    nthreads = std::min(Parallel::nthreads(nthreads), njobs);
+    if (nthreads <= 1) {
+        for (size_t ind = 0; ind < njobs; ++ind) {
+            func(ind);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next{0};
+    std::atomic<bool> failed{false};
+    std::exception_ptr err;
+    std::mutex err_mutex;
+
+    auto work = [&]() {
+        while (!failed) {
+            const size_t ind = next++;
+            if (ind >= njobs) {
+                return;
+            }
+            try {
+                func(ind);
+            }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(err_mutex);
+                if (!err) {
+                    err = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    };
+
+    // The calling thread works too.
+    std::vector<std::thread> threads;
+    for (size_t ind = 1; ind < nthreads; ++ind) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& th : threads) {
+        th.join();
+    }
+    if (err) {
+        std::rethrow_exception(err);
+    }
+}
@@ -1,4 +1,5 @@
 #include "WireCellUtil/Persist.h"
+#include "WireCellUtil/BinaryCache.h"
 #include "WireCellUtil/String.h"
 #include "WireCellUtil/Logging.h"
 #include "WireCellUtil/Exceptions.h"
@@ -17,6 +18,7 @@
 #include <string>
 #include <sstream>
 #include <fstream>
+#include <regex>
 
 // see #239 for why this is here.
 extern "C" {
@@ -298,21 +300,25 @@ void WireCell::Persist::Parser::add_load_path(const std::string& path)
 void WireCell::Persist::Parser::bind_ext_var(const std::string& key,
                                              const std::string& val)
 {
+    m_bound += "extvar\n" + key + "\n" + val + "\n";
     jsonnet_ext_var(m_jvm, to_chars(key), to_chars(val));
 }
 void WireCell::Persist::Parser::bind_ext_code(const std::string& key,
                                               const std::string& val)
 {
+    m_bound += "extcode\n" + key + "\n" + val + "\n";
     jsonnet_ext_code(m_jvm, to_chars(key), to_chars(val));
 }
 void WireCell::Persist::Parser::bind_tla_var(const std::string& key,
                                              const std::string& val)
 {
+    m_bound += "tlavar\n" + key + "\n" + val + "\n";
     jsonnet_tla_var(m_jvm, to_chars(key), to_chars(val));
 }
 void WireCell::Persist::Parser::bind_tla_code(const std::string& key,
                                               const std::string& val)
 {
+    m_bound += "tlacode\n" + key + "\n" + val + "\n";
     jsonnet_tla_code(m_jvm, to_chars(key), to_chars(val));
 }
 
@@ -320,6 +326,7 @@ WireCell::Persist::Parser::Parser(const std::vector<std::string>& load_paths, co
                                   const externalvars_t& extcode, const externalvars_t& tlavar,
                                   const externalvars_t& tlacode)
     : m_jvm{jsonnet_make()}
+    , m_cache_dir{BinaryCache::directory()}
 {
 
     // Loading: 1) cwd, 2) passed in paths 3) environment
@@ -378,6 +385,103 @@ std::string WireCell::Persist::Parser::resolve(const std::string& filename)
     return "";
 }
 
+void WireCell::Persist::Parser::set_cache(const std::string& dir)
+{
+    m_cache_dir = dir;
+}
+
+void WireCell::Persist::Parser::imports(const std::string& fname, std::map<std::string, std::string>& closure,
+                                        std::set<std::string>& edges)
+{
+    // Jsonnet requires import paths to be string literals.
+    static const std::regex import_re(R"re(\bimport(str|bin)?\s*@?(?:"([^"]*)"|'([^']*)'))re");
+
+    const std::string text = slurp(fname);
+    const auto base = boost::filesystem::path(fname).parent_path();
+    for (std::sregex_iterator it(text.begin(), text.end(), import_re), end; it != end; ++it) {
+        const auto& match = *it;
+        const std::string rel = match[2].matched ? match[2].str() : match[3].str();
+        const std::string edge = closure[fname] + "\nimport" + match[1].str() + "\n" + rel + "\n";
+
+        // Jsonnet looks first relative to the importing file.
+        std::string found;
+        if (boost::filesystem::exists(base / rel)) {
+            found = boost::filesystem::canonical(base / rel).string();
+        }
+        else {
+            found = resolve(rel);
+        }
+        if (found.empty() || !boost::filesystem::exists(found)) {
+            // Possibly in a comment.  Keep it in the key in case it later appears.
+            edges.insert(edge + "missing");
+            continue;
+        }
+        auto known = closure.find(found);
+        if (known != closure.end()) {
+            edges.insert(edge + known->second);
+            continue;
+        }
+        closure[found] = BinaryCache::content_hash(found);
+        edges.insert(edge + closure[found]);
+        if (!match[1].matched) {  // importstr and importbin are not Jsonnet
+            imports(found, closure, edges);
+        }
+    }
+}
+
+std::string WireCell::Persist::Parser::cache_path(const std::string& filename)
+{
+    if (m_cache_dir.empty()) {
+        return "";
+    }
+    const std::string fname = resolve(filename);
+    if (fname.empty()) {
+        return "";
+    }
+
+    // Absolute paths only find the files.  The key is made from their
+    // content and the import literals.
+    std::map<std::string, std::string> closure;
+    closure[fname] = BinaryCache::content_hash(fname);
+    std::set<std::string> edges;
+    imports(fname, closure, edges);
+
+    std::string key = m_bound + "main\n" + closure[fname] + "\n";
+    for (const auto& edge : edges) {
+        key += edge + "\n";
+    }
+
+    std::string stem = boost::filesystem::path(fname).filename().string();
+    stem = stem.substr(0, stem.find('.'));
+    const auto name = String::format("%s-cfg-%s.json", stem, BinaryCache::text_hash(key));
+    return (boost::filesystem::path(m_cache_dir) / name).string();
+}
+
+// Write text to file via a temporary so concurrent jobs never read a partial file.
+static void save_cache(const std::string& cpath, const std::string& text)
+{
+    namespace bfs = boost::filesystem;
+    boost::system::error_code ec;
+    bfs::create_directories(bfs::path(cpath).parent_path(), ec);
+    const auto tmp = cpath + "." + bfs::unique_path().string();
+    {
+        std::ofstream out(tmp);
+        out << text;
+        if (!out) {
+            spdlog::warn("failed to write configuration cache {}", tmp);
+            bfs::remove(tmp, ec);
+            return;
+        }
+    }
+    bfs::rename(tmp, cpath, ec);
+    if (ec) {
+        spdlog::warn("failed to write configuration cache {}: {}", cpath, ec.message());
+        bfs::remove(tmp, ec);
+        return;
+    }
+    debug("saved configuration cache {}", cpath);
+}
+
 Json::Value WireCell::Persist::Parser::load(const std::string& filename)
 {
     std::string fname = resolve(filename);
@@ -387,6 +491,12 @@ Json::Value WireCell::Persist::Parser::load(const std::string& filename)
     string ext = file_extension(filename);
 
     if (ext == ".jsonnet" or ext.empty()) {  // use libjsonnet++ file interface
+        const std::string cpath = cache_path(fname);
+        if (!cpath.empty() && exists(cpath)) {
+            info("loading cached evaluation of {}: {}", fname, cpath);
+            return json2object(slurp(cpath));
+        }
+
         int rc=0;
         char* jtext = jsonnet_evaluate_file(m_jvm, to_chars(fname), &rc);
         if (rc) {
@@ -395,6 +505,9 @@ Json::Value WireCell::Persist::Parser::load(const std::string& filename)
         }
         std::string output(jtext);
         jsonnet_realloc(m_jvm, jtext, 0);
+        if (!cpath.empty()) {
+            save_cache(cpath, output);
+        }
         return json2object(output);
     }
 
@@ -1,4 +1,5 @@
 #include "WireCellUtil/Persist.h"
+#include "WireCellUtil/BinaryCache.h"
 #include "WireCellUtil/ExecMon.h"
 #include "WireCellUtil/Response.h"
 #include "WireCellUtil/Logging.h"
@@ -29,16 +30,12 @@ Response::Schema::PathResponse::~PathResponse() {}
  ['shape', 'elements']
 
  */
-WireCell::Response::Schema::FieldResponse WireCell::Response::Schema::load(const char* filename)
+static Response::Schema::FieldResponse load_json(const char* filename)
 {
-    if (!filename) {
-        error("Response::Schema::load(): empty field response file name");
-        return FieldResponse();
-    }
     Json::Value top = WireCell::Persist::load(filename);
     if (top.isNull()) {
         error("Response::Schema::load(): failed to load {}", filename);
-        return FieldResponse();
+        return Response::Schema::FieldResponse();
     }
     Json::Value fr = top["FieldResponse"];
 
@@ -71,6 +68,80 @@ WireCell::Response::Schema::FieldResponse WireCell::Response::Schema::load(const
     return ret;
 }
 
+// The field response as flat arrays for the binary cache.
+static BinaryCache::Arrays to_arrays(const Response::Schema::FieldResponse& fr)
+{
+    BinaryCache::Arrays arrays;
+    arrays.reals["meta"] = {fr.axis.x(), fr.axis.y(), fr.axis.z(), fr.origin, fr.tstart, fr.period, fr.speed};
+    auto& plane_ids = arrays.ints["plane_ids"];
+    auto& plane_offsets = arrays.ints["plane_offsets"];
+    auto& plane_geom = arrays.reals["plane_geom"];
+    auto& path_pos = arrays.reals["path_pos"];
+    auto& current_offsets = arrays.ints["current_offsets"];
+    auto& currents = arrays.reals["currents"];
+    plane_offsets.push_back(0);
+    current_offsets.push_back(0);
+    for (const auto& plane : fr.planes) {
+        plane_ids.push_back(plane.planeid);
+        plane_geom.push_back(plane.location);
+        plane_geom.push_back(plane.pitch);
+        for (const auto& path : plane.paths) {
+            path_pos.push_back(path.pitchpos);
+            path_pos.push_back(path.wirepos);
+            currents.insert(currents.end(), path.current.begin(), path.current.end());
+            current_offsets.push_back(currents.size());
+        }
+        plane_offsets.push_back(path_pos.size() / 2);
+    }
+    return arrays;
+}
+
+static Response::Schema::FieldResponse from_arrays(const BinaryCache::Arrays& arrays)
+{
+    using namespace WireCell::Response::Schema;
+
+    const auto& meta = arrays.real("meta");
+    const auto& plane_ids = arrays.integer("plane_ids");
+    const auto& plane_offsets = arrays.integer("plane_offsets");
+    const auto& plane_geom = arrays.real("plane_geom");
+    const auto& path_pos = arrays.real("path_pos");
+    const auto& current_offsets = arrays.integer("current_offsets");
+    const auto& currents = arrays.real("currents");
+
+    std::vector<PlaneResponse> planes;
+    for (size_t iplane = 0; iplane < plane_ids.size(); ++iplane) {
+        std::vector<PathResponse> paths;
+        for (int ipath = plane_offsets[iplane]; ipath < plane_offsets[iplane + 1]; ++ipath) {
+            WireCell::Waveform::realseq_t current(currents.begin() + current_offsets[ipath],
+                                                  currents.begin() + current_offsets[ipath + 1]);
+            paths.emplace_back(current, path_pos[2 * ipath], path_pos[2 * ipath + 1]);
+        }
+        planes.emplace_back(paths, plane_ids[iplane], plane_geom[2 * iplane], plane_geom[2 * iplane + 1]);
+    }
+    const WireCell::Vector axis(meta[0], meta[1], meta[2]);
+    return FieldResponse(planes, axis, meta[3], meta[4], meta[5], meta[6]);
+}
+
+WireCell::Response::Schema::FieldResponse WireCell::Response::Schema::load(const char* filename)
+{
+    if (!filename) {
+        error("Response::Schema::load(): empty field response file name");
+        return FieldResponse();
+    }
+
+    const auto cpath = BinaryCache::path(filename, "fr");
+    BinaryCache::Arrays arrays;
+    if (BinaryCache::load(cpath, arrays)) {
+        return from_arrays(arrays);
+    }
+
+    auto fr = load_json(filename);
+    if (!cpath.empty() && !fr.planes.empty()) {
+        BinaryCache::save(cpath, to_arrays(fr));
+    }
+    return fr;
+}
+
 void Response::Schema::dump(const char* filename, const Response::Schema::FieldResponse& fr) {}
 
 /// Warning!  this function is NOT GENERAL.  It is actually specific
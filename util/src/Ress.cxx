@@ -12,11 +12,12 @@ Ress::vector_t Ress::solve(Ress::matrix_t matrix, Ress::vector_t measured, const
 
     if (params.model == Ress::lasso) {
         WireCell::LassoModel model(params.lambda, params.max_iter, params.tolerance, params.non_negative);
-        if (params.set_init) {
-	  model.Setbeta(initial);
-	}
         // FIXME: SetData overwrites SetLambdaWeight
         model.SetData(matrix, measured);
+        // SetData zeros beta so any initial source must come after.
+        if (params.set_init) {
+            model.Setbeta(initial);
+        }
         if (weights.size()) {
             model.SetLambdaWeight(weights);
         }
@@ -27,10 +28,10 @@ Ress::vector_t Ress::solve(Ress::matrix_t matrix, Ress::vector_t measured, const
     if (params.model == Ress::elnet) {
         WireCell::ElasticNetModel model(params.lambda, params.alpha, params.max_iter, params.tolerance,
                                         params.non_negative);
-	if (params.set_init) {
-	  model.Setbeta(initial);
-        }
         model.SetData(matrix, measured);
+        if (params.set_init) {
+            model.Setbeta(initial);
+        }
 	if (weights.size()) {
             model.SetLambdaWeight(weights);
         }
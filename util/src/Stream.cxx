@@ -1,5 +1,18 @@
 #include "WireCellUtil/Stream.h"
+#include "WireCellUtil/Persist.h"
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filter/bzip2.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#pragma GCC diagnostic pop
+
+#include <deque>
+#include <fstream>
+#include <future>
+#include <regex>
 
 std::ostream& WireCell::Stream::write(
     std::ostream& so,
@@ -22,3 +35,213 @@ std::ostream& WireCell::Stream::write(
 }
 
 
+
+using WireCell::Stream::parallel_compressor;
+
+static std::string compress_block(parallel_compressor::codec comp, int level, const std::string& block)
+{
+    std::string out;
+    boost::iostreams::filtering_ostream fo;
+    if (comp == parallel_compressor::codec::gzip) {
+        fo.push(boost::iostreams::gzip_compressor(level));
+    }
+    else {
+        fo.push(boost::iostreams::bzip2_compressor(level));
+    }
+    fo.push(boost::iostreams::back_inserter(out));
+    fo.write(block.data(), block.size());
+    fo.reset();                 // closes, writing the member trailer
+    return out;
+}
+
+struct parallel_compressor::impl {
+    std::ofstream file;
+    codec comp;
+    int level;
+    size_t nthreads, block_size;
+    std::string block;
+    std::deque<std::future<std::string>> pending;
+    size_t nsubmitted{0}, nwritten{0};
+    std::vector<size_t> starts;
+
+    void write_member(const std::string& member)
+    {
+        starts.push_back(nwritten);
+        file.write(member.data(), member.size());
+        if (!file) {
+            throw std::runtime_error("parallel_compressor: write failed");
+        }
+        nwritten += member.size();
+    }
+
+    // Write out finished members in order, waiting until fewer than
+    // nkeep are in flight.
+    void drain(size_t nkeep)
+    {
+        while (pending.size()) {
+            auto& front = pending.front();
+            const bool ready = front.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            if (!ready && pending.size() < nkeep) {
+                break;
+            }
+            const auto member = front.get();
+            pending.pop_front();
+            write_member(member);
+        }
+    }
+
+    void submit()
+    {
+        if (block.empty()) {
+            return;
+        }
+        ++nsubmitted;
+        if (comp == codec::none) {
+            write_member(block);
+        }
+        else {
+            pending.push_back(std::async(std::launch::async, compress_block, comp, level, std::move(block)));
+        }
+        block.clear();
+        block.reserve(block_size);
+        drain(nthreads);
+    }
+};
+
+parallel_compressor::parallel_compressor(const std::string& outname, codec comp, int level,
+                                         size_t nthreads, size_t block_size)
+    : m_impl(std::make_shared<impl>())
+{
+    m_impl->file.open(outname, std::ios::binary);
+    if (!m_impl->file) {
+        throw std::runtime_error("parallel_compressor: failed to open " + outname);
+    }
+    m_impl->comp = comp;
+    m_impl->level = level;
+    m_impl->nthreads = std::max<size_t>(nthreads, 1);
+    m_impl->block_size = std::max<size_t>(block_size, 1);
+    m_impl->block.reserve(m_impl->block_size);
+}
+
+std::streamsize parallel_compressor::write(const char* s, std::streamsize n)
+{
+    auto& im = *m_impl;
+    std::streamsize left = n;
+    while (left > 0) {
+        const size_t take = std::min<size_t>(left, im.block_size - im.block.size());
+        im.block.append(s, take);
+        s += take;
+        left -= take;
+        if (im.block.size() == im.block_size) {
+            im.submit();
+        }
+    }
+    return n;
+}
+
+void parallel_compressor::close()
+{
+    auto& im = *m_impl;
+    im.submit();
+    im.drain(0);
+    im.file.close();
+}
+
+size_t parallel_compressor::restart()
+{
+    m_impl->submit();
+    return m_impl->nsubmitted;
+}
+
+std::vector<size_t> parallel_compressor::offsets() const
+{
+    auto ret = m_impl->starts;
+    ret.push_back(m_impl->nwritten);
+    return ret;
+}
+
+void WireCell::Stream::parallel_output_filters(boost::iostreams::filtering_ostream& out,
+                                               const std::string& outname, size_t nthreads,
+                                               int level, size_t block_size)
+{
+    auto has = [&](const std::string& things) {
+        return std::regex_search(outname, std::regex("[_.]("+things+")\\b"));
+    };
+
+    const bool tar = has("tar|tar.gz|tgz|tar.bz2|tbz|tbz2|tar.xz|txz|tar.pixz|tix|tpxz");
+    auto comp = parallel_compressor::codec::none;
+    if (has("gz|tgz")) {
+        comp = parallel_compressor::codec::gzip;
+    }
+    else if (has("bz2|tbz|tbz2")) {
+        comp = parallel_compressor::codec::bzip2;
+    }
+    else if (has("xz|txz|pixz|tix|tpxz|zip|npz")) {
+        nthreads = 0;           // not supported here
+    }
+    else if (!tar) {
+        nthreads = 0;
+    }
+    if (!nthreads) {
+        output_filters(out, outname, level);
+        return;
+    }
+
+    custard::assuredir(outname);
+    if (tar) {
+        out.push(custard::tar_writer());
+    }
+    out.push(parallel_compressor(outname, comp, level, nthreads, block_size));
+}
+
+void WireCell::Stream::input_filters(boost::iostreams::filtering_istream& in,
+                                     const std::string& inname, size_t offset)
+{
+    auto has = [&](const std::string& things) {
+        return std::regex_search(inname, std::regex("[_.]("+things+")\\b"));
+    };
+
+    if (has("tar|tar.gz|tgz|tar.bz2|tbz|tbz2")) {
+        in.push(custard::tar_reader());
+    }
+    if (has("gz|tgz")) {
+        in.push(boost::iostreams::gzip_decompressor());
+    }
+    else if (has("bz2|tbz|tbz2")) {
+        in.push(boost::iostreams::bzip2_decompressor());
+    }
+    boost::iostreams::file_source src(inname, std::ios::binary);
+    if (!src.is_open()) {
+        throw std::runtime_error("failed to open " + inname);
+    }
+    boost::iostreams::seek(src, offset, std::ios_base::beg);
+    in.push(src);
+}
+
+void WireCell::Stream::save_index(const std::string& archive, const index_entries_t& entries)
+{
+    Json::Value joffsets = Json::arrayValue;
+    for (const auto& [ident, offset] : entries) {
+        Json::Value jentry = Json::arrayValue;
+        jentry.append(ident);
+        jentry.append((Json::UInt64) offset);
+        joffsets.append(jentry);
+    }
+    Json::Value jindex;
+    jindex["offsets"] = joffsets;
+    Persist::dump(index_name(archive), jindex);
+}
+
+std::map<int, size_t> WireCell::Stream::load_index(const std::string& archive)
+{
+    std::map<int, size_t> ret;
+    const auto iname = index_name(archive);
+    if (!Persist::exists(iname)) {
+        return ret;
+    }
+    const auto jindex = Persist::load(iname);
+    for (const auto& jentry : jindex["offsets"]) {
+        ret.emplace(jentry[0].asInt(), jentry[1].asUInt64());  // first wins
+    }
+    return ret;
+}
@@ -1,5 +1,6 @@
 #include "WireCellUtil/WireSchema.h"
 #include "WireCellUtil/Persist.h"
+#include "WireCellUtil/BinaryCache.h"
 #include "WireCellUtil/Configuration.h"
 #include "WireCellUtil/Logging.h"
 #include "WireCellUtil/Intersection.h"
@@ -27,7 +28,7 @@ Ray ray_pitch_approx(const Ray& r1, const Ray& r2)
 
 
 static
-void load_file(const std::string& path, StoreDB& store)
+void load_json_file(const std::string& path, StoreDB& store)
 {
     Json::Value jtop = WireCell::Persist::load(path);
     Json::Value jstore = jtop["Store"];
@@ -149,6 +150,92 @@ void load_file(const std::string& path, StoreDB& store)
     }
 }
 
+// Flatten objects holding an ident and a list of indices.
+template <typename Type, typename Member>
+static void to_arrays(const std::vector<Type>& objs, Member member, const std::string& name,
+                      BinaryCache::Arrays& arrays)
+{
+    auto& idents = arrays.ints[name + "_idents"];
+    auto& offsets = arrays.ints[name + "_offsets"];
+    auto& indices = arrays.ints[name + "_indices"];
+    offsets.push_back(0);
+    for (const auto& obj : objs) {
+        idents.push_back(obj.ident);
+        const auto& inds = obj.*member;
+        indices.insert(indices.end(), inds.begin(), inds.end());
+        offsets.push_back(indices.size());
+    }
+}
+
+template <typename Type, typename Member>
+static void from_arrays(const BinaryCache::Arrays& arrays, const std::string& name, Member member,
+                        std::vector<Type>& objs)
+{
+    const auto& idents = arrays.integer(name + "_idents");
+    const auto& offsets = arrays.integer(name + "_offsets");
+    const auto& indices = arrays.integer(name + "_indices");
+    const size_t nobjs = idents.size();
+    objs.resize(nobjs);
+    for (size_t ind = 0; ind < nobjs; ++ind) {
+        objs[ind].ident = idents[ind];
+        objs[ind].*member = std::vector<int>(indices.begin() + offsets[ind], indices.begin() + offsets[ind + 1]);
+    }
+}
+
+static BinaryCache::Arrays to_arrays(const StoreDB& store)
+{
+    BinaryCache::Arrays arrays;
+    auto& wire_ids = arrays.ints["wire_ids"];
+    auto& wire_ends = arrays.reals["wire_ends"];
+    for (const auto& wire : store.wires) {
+        wire_ids.insert(wire_ids.end(), {wire.ident, wire.channel, wire.segment});
+        wire_ends.insert(wire_ends.end(), {wire.tail.x(), wire.tail.y(), wire.tail.z(),
+                                           wire.head.x(), wire.head.y(), wire.head.z()});
+    }
+    to_arrays(store.planes, &Plane::wires, "planes", arrays);
+    to_arrays(store.faces, &Face::planes, "faces", arrays);
+    to_arrays(store.anodes, &Anode::faces, "anodes", arrays);
+    to_arrays(store.detectors, &Detector::anodes, "detectors", arrays);
+    return arrays;
+}
+
+static void from_arrays(const BinaryCache::Arrays& arrays, StoreDB& store)
+{
+    const auto& wire_ids = arrays.integer("wire_ids");
+    const auto& wire_ends = arrays.real("wire_ends");
+    const size_t nwires = wire_ids.size() / 3;
+    store.wires.resize(nwires);
+    for (size_t iwire = 0; iwire < nwires; ++iwire) {
+        Wire& wire = store.wires[iwire];
+        wire.ident = wire_ids[3 * iwire];
+        wire.channel = wire_ids[3 * iwire + 1];
+        wire.segment = wire_ids[3 * iwire + 2];
+        const double* ends = &wire_ends[6 * iwire];
+        wire.tail.set(ends[0], ends[1], ends[2]);
+        wire.head.set(ends[3], ends[4], ends[5]);
+    }
+    from_arrays(arrays, "planes", &Plane::wires, store.planes);
+    from_arrays(arrays, "faces", &Face::planes, store.faces);
+    from_arrays(arrays, "anodes", &Anode::faces, store.anodes);
+    from_arrays(arrays, "detectors", &Detector::anodes, store.detectors);
+}
+
+// Load from the binary cache if possible, else from JSON and fill the cache.
+static
+void load_file(const std::string& path, StoreDB& store)
+{
+    const auto cpath = BinaryCache::path(path, "wires");
+    BinaryCache::Arrays arrays;
+    if (BinaryCache::load(cpath, arrays)) {
+        from_arrays(arrays, store);
+        return;
+    }
+    load_json_file(path, store);
+    if (!cpath.empty() && !store.wires.empty()) {
+        BinaryCache::save(cpath, to_arrays(store));
+    }
+}
+
 // Return axis along which wire centers are ascending when in proper
 // wire-in-plane order.
 static int wire_order_axis(const StoreDB& store, const Plane& plane)
@@ -0,0 +1,74 @@
+/** Time the RESS elastic net solver against the original dense
+    coordinate descent on a synthetic charge-solving-like system.
+
+    Each measure (a wire "slice" channel group) sees a few sources
+    (blobs) with unit response whitened by a per-measure uncertainty,
+    as CS::solve() makes for ChargeSolving.
+
+    Usage: check_ress [nsource [nmeasure [seed]]]
+ */
+
+#include "WireCellUtil/Ress.h"
+
+#include "ress_reference.h"
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+using namespace WireCell;
+
+int main(int argc, char* argv[])
+{
+    size_t nsource = 500, nmeasure = 750, seed = 0;
+    if (argc > 1) nsource = std::stoul(argv[1]);
+    if (argc > 2) nmeasure = std::stoul(argv[2]);
+    if (argc > 3) seed = std::stoul(argv[3]);
+
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> pick(0, nsource - 1);
+    std::uniform_real_distribution<double> charge(1000, 10000);
+    std::uniform_real_distribution<double> sigma(300, 1000);
+    std::bernoulli_distribution ghost(0.3);
+
+    Ress::vector_t truth = Ress::vector_t::Zero(nsource);
+    for (size_t ind = 0; ind < nsource; ++ind) {
+        if (!ghost(rng)) truth(ind) = charge(rng);
+    }
+    // As in CS::solve(), response and measure are scaled and whitened.
+    const double scale = 1000;
+    Ress::matrix_t R = Ress::matrix_t::Zero(nmeasure, nsource);
+    Ress::vector_t m(nmeasure);
+    for (size_t row = 0; row < nmeasure; ++row) {
+        const double sig = sigma(rng);
+        for (size_t n = 0; n < 3; ++n) {
+            R(row, pick(rng)) = scale / sig;
+        }
+        m(row) = R.row(row).dot(truth) / scale;
+    }
+
+    Ress::Params params;
+    params.lambda = 3.0 / scale;
+    params.tolerance = 1e-3;
+
+    auto t0 = std::chrono::steady_clock::now();
+    const auto got = Ress::solve(R, m, params);
+    auto t1 = std::chrono::steady_clock::now();
+    const auto want = reference_elnet(R, m, params);
+    auto t2 = std::chrono::steady_clock::now();
+
+    const double dt_new = std::chrono::duration<double>(t1 - t0).count();
+    const double dt_old = std::chrono::duration<double>(t2 - t1).count();
+    const double diff = (got - want).norm() / (1 + want.norm());
+
+    std::cout << "ress: " << nsource << " sources, " << nmeasure << " measures: "
+              << "legacy " << dt_old << " s, current " << dt_new << " s, speedup " << dt_old / dt_new
+              << ", relative difference " << diff << std::endl;
+    if (diff > 1e-6) {
+        std::cerr << "check_ress: solutions differ" << std::endl;
+        return 1;
+    }
+    return 0;
+}
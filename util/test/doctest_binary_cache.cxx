@@ -0,0 +1,116 @@
+#include "WireCellUtil/BinaryCache.h"
+#include "WireCellUtil/Persist.h"
+#include "WireCellUtil/Response.h"
+#include "WireCellUtil/Logging.h"
+#include "WireCellUtil/doctest.h"
+
+#include <cstdlib>
+
+using spdlog::debug;
+using namespace WireCell;
+
+static void write_fr(const std::string& filename)
+{
+    Json::Value jplanes = Json::arrayValue;
+    for (int iplane = 0; iplane < 3; ++iplane) {
+        Json::Value jpaths = Json::arrayValue;
+        for (int ipath = 0; ipath < 4; ++ipath) {
+            Json::Value jcurrent = Json::arrayValue;
+            for (int ind = 0; ind < 10 + ipath; ++ind) {
+                jcurrent.append(0.1 * ind * (iplane + 1) + ipath);
+            }
+            Json::Value jpath;
+            jpath["PathResponse"]["current"]["array"]["elements"] = jcurrent;
+            jpath["PathResponse"]["pitchpos"] = 0.5 * ipath;
+            jpath["PathResponse"]["wirepos"] = 0.0;
+            jpaths.append(jpath);
+        }
+        Json::Value jplane;
+        jplane["PlaneResponse"]["paths"] = jpaths;
+        jplane["PlaneResponse"]["planeid"] = iplane;
+        jplane["PlaneResponse"]["location"] = 3.0 * iplane;
+        jplane["PlaneResponse"]["pitch"] = 5.0;
+        jplanes.append(jplane);
+    }
+    Json::Value jtop;
+    auto& jfr = jtop["FieldResponse"];
+    jfr["planes"] = jplanes;
+    jfr["axis"] = Json::arrayValue;
+    jfr["axis"].append(1.0);
+    jfr["axis"].append(0.0);
+    jfr["axis"].append(0.0);
+    jfr["origin"] = 100.0;
+    jfr["tstart"] = 0.0;
+    jfr["period"] = 0.1;
+    jfr["speed"] = 1.6;
+    Persist::dump(filename, jtop);
+}
+
+TEST_CASE("binary cache disabled")
+{
+    unsetenv("WIRECELL_CACHE");
+    CHECK(BinaryCache::directory().empty());
+    CHECK(BinaryCache::path("/etc/hosts", "test").empty());
+}
+
+TEST_CASE("binary cache arrays")
+{
+    Persist::TempDir td;
+    const std::string cdir = td.path.string();
+    const auto cpath = BinaryCache::path("/etc/hosts", "test", cdir);
+    CHECK(!cpath.empty());
+    CHECK(cpath == BinaryCache::path("/etc/hosts", "test", cdir));
+    CHECK(cpath != BinaryCache::path("/etc/hosts", "other", cdir));
+
+    BinaryCache::Arrays arrays;
+    CHECK(!BinaryCache::load(cpath, arrays));
+
+    arrays.reals["x"] = {1.5, 2.5};
+    arrays.reals["empty"] = {};
+    arrays.ints["i"] = {1, 2, 3};
+    CHECK(BinaryCache::save(cpath, arrays));
+
+    BinaryCache::Arrays got;
+    REQUIRE(BinaryCache::load(cpath, got));
+    CHECK(got.real("x") == arrays.reals["x"]);
+    CHECK(got.real("empty").empty());
+    CHECK(got.integer("i") == arrays.ints["i"]);
+    CHECK_THROWS(got.real("i"));
+}
+
+TEST_CASE("binary cache field response")
+{
+    Persist::TempDir td;
+    const std::string fname = (td.path / "fr.json").string();
+    write_fr(fname);
+
+    setenv("WIRECELL_CACHE", td.path.string().c_str(), 1);
+    const auto cpath = BinaryCache::path(fname, "fr");
+    CHECK(!Persist::exists(cpath));
+
+    auto want = Response::Schema::load(fname.c_str());
+    CHECK(Persist::exists(cpath));
+    auto got = Response::Schema::load(fname.c_str());
+    unsetenv("WIRECELL_CACHE");
+
+    CHECK(got.axis == want.axis);
+    CHECK(got.origin == want.origin);
+    CHECK(got.tstart == want.tstart);
+    CHECK(got.period == want.period);
+    CHECK(got.speed == want.speed);
+    REQUIRE(got.planes.size() == want.planes.size());
+    for (size_t iplane = 0; iplane < want.planes.size(); ++iplane) {
+        const auto& gpl = got.planes[iplane];
+        const auto& wpl = want.planes[iplane];
+        CHECK(gpl.planeid == wpl.planeid);
+        CHECK(gpl.location == wpl.location);
+        CHECK(gpl.pitch == wpl.pitch);
+        REQUIRE(gpl.paths.size() == wpl.paths.size());
+        for (size_t ipath = 0; ipath < wpl.paths.size(); ++ipath) {
+            CHECK(gpl.paths[ipath].pitchpos == wpl.paths[ipath].pitchpos);
+            CHECK(gpl.paths[ipath].wirepos == wpl.paths[ipath].wirepos);
+            CHECK(gpl.paths[ipath].current == wpl.paths[ipath].current);
+        }
+    }
+    debug("cached field response in {}", cpath);
+}
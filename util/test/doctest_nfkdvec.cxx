@@ -1,6 +1,7 @@
 #include "WireCellUtil/NFKDVec.h"
 #include "WireCellUtil/Exceptions.h"
 #include "WireCellUtil/Logging.h"
+#include "WireCellUtil/Parallel.h"
 
 // #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "WireCellUtil/doctest.h"
@@ -353,3 +354,31 @@ TEST_CASE("nfkdvec static")
     }    
 
 }
+
+TEST_CASE("nfkdvec prepared concurrent queries")
+{
+    nfkdtree_static kd(make_points(100));
+    kd.prepare();
+    const size_t calls = kd.point_calls();
+
+    const size_t nquery = 64;
+    std::vector<results_type> want(nquery), got(nquery);
+    for (size_t ind=0; ind<nquery; ++ind) {
+        want[ind] = kd.knn(3, kd.point(ind));
+    }
+    Parallel::for_each(nquery, [&](size_t ind) {
+        got[ind] = kd.knn(3, kd.point(ind));
+    }, 4);
+    for (size_t ind=0; ind<nquery; ++ind) {
+        CHECK(got[ind] == want[ind]);
+    }
+#if SPDLOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+    CHECK(kd.point_calls() > calls);
+#else
+    CHECK(kd.point_calls() == calls);
+#endif
+
+    // A moved tree remakes its index.
+    nfkdtree_static kd2(std::move(kd));
+    CHECK(kd2.knn(3, kd2.point(0)) == want[0]);
+}
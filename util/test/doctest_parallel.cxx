@@ -0,0 +1,54 @@
+#include "WireCellUtil/Parallel.h"
+#include "WireCellUtil/Exceptions.h"
+#include "WireCellUtil/doctest.h"
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace WireCell;
+
+TEST_CASE("parallel nthreads")
+{
+    CHECK(Parallel::nthreads(3) == 3);
+    CHECK(Parallel::nthreads(0) == 1);
+}
+
+TEST_CASE("parallel for each")
+{
+    for (size_t nthreads : {0, 1, 2, 4, 16}) {
+        const size_t njobs = 100;
+        std::vector<int> out(njobs, 0);
+        std::mutex mutex;
+        std::set<std::thread::id> tids;
+        Parallel::for_each(njobs, [&](size_t ind) {
+            out[ind] += ind;
+            std::lock_guard<std::mutex> lock(mutex);
+            tids.insert(std::this_thread::get_id());
+        }, nthreads);
+        for (size_t ind = 0; ind < njobs; ++ind) {
+            REQUIRE(out[ind] == (int)ind);
+        }
+        if (nthreads <= 1) {
+            CHECK(tids.size() == 1);
+            CHECK(*tids.begin() == std::this_thread::get_id());
+        }
+        CHECK(tids.size() <= Parallel::nthreads(nthreads));
+    }
+
+    Parallel::for_each(0, [](size_t) { FAIL("no jobs"); }, 4);
+}
+
+TEST_CASE("parallel for each throws")
+{
+    std::atomic<size_t> count{0};
+    CHECK_THROWS_AS(Parallel::for_each(1000, [&](size_t ind) {
+        ++count;
+        if (ind == 10) {
+            raise<ValueError>("job %d fails", ind);
+        }
+    }, 4), ValueError);
+    CHECK(count <= 1000);
+}
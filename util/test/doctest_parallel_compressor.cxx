@@ -0,0 +1,108 @@
+#include "WireCellUtil/Stream.h"
+#include "WireCellUtil/Persist.h"
+#include "WireCellUtil/Array.h"
+#include "WireCellUtil/String.h"
+#include "WireCellUtil/Logging.h"
+#include "WireCellUtil/doctest.h"
+
+using spdlog::debug;
+using namespace WireCell;
+using namespace WireCell::Stream;
+
+static void check_roundtrip(const std::string& fname, size_t nthreads)
+{
+    const int narrays = 10;
+    {
+        filtering_ostream so;
+        // Tiny blocks to make many members.
+        parallel_output_filters(so, fname, nthreads, 1, 1000);
+        REQUIRE(so.size() > 0);
+        for (int ind = 0; ind < narrays; ++ind) {
+            Array::array_xxf arr = Array::array_xxf::Constant(100, 20, ind);
+            write(so, String::format("arr_%d.npy", ind), arr);
+            std::vector<int> vec(ind + 1, ind);
+            write(so, String::format("vec_%d.npy", ind), vec);
+            so.flush();
+        }
+        so.pop();
+    }
+    debug("wrote {} with {} threads, {} bytes", fname, nthreads, boost::filesystem::file_size(fname));
+
+    filtering_istream si;
+    input_filters(si, fname);
+    for (int ind = 0; ind < narrays; ++ind) {
+        std::string aname;
+        Array::array_xxf arr;
+        read(si, aname, arr);
+        REQUIRE(si);
+        CHECK(aname == String::format("arr_%d.npy", ind));
+        CHECK(arr.rows() == 100);
+        CHECK(arr.cols() == 20);
+        CHECK((arr == ind).all());
+
+        std::vector<int> vec;
+        read(si, aname, vec);
+        REQUIRE(si);
+        CHECK(aname == String::format("vec_%d.npy", ind));
+        CHECK(vec == std::vector<int>(ind + 1, ind));
+    }
+}
+
+TEST_CASE("parallel compressor")
+{
+    Persist::TempDir td;
+    for (const std::string ext : {"tar", "tar.gz", "tar.bz2"}) {
+        for (size_t nthreads : {0, 1, 4}) {
+            const auto fname = (td.path / String::format("pc-%d.%s", nthreads, ext)).string();
+            check_roundtrip(fname, nthreads);
+        }
+    }
+}
+
+TEST_CASE("parallel compressor random access")
+{
+    Persist::TempDir td;
+    for (const std::string ext : {"tar", "tar.gz", "tar.bz2"}) {
+        const auto fname = (td.path / ("ra." + ext)).string();
+        const int ngroups = 5;
+        std::vector<size_t> members;
+        std::vector<size_t> offsets;
+        {
+            filtering_ostream so;
+            parallel_output_filters(so, fname, 2, 1, 1000);
+            auto* pc = so.component<parallel_compressor>(so.size() - 1);
+            REQUIRE(pc);
+            parallel_compressor handle = *pc;
+            for (int group = 0; group < ngroups; ++group) {
+                so.flush();
+                members.push_back(handle.restart());
+                for (int ind = 0; ind < 3; ++ind) {
+                    std::vector<int> vec(100 * (ind + 1), group);
+                    write(so, String::format("vec_%d_%d.npy", group, ind), vec);
+                }
+            }
+            so.pop();
+            offsets = handle.offsets();
+        }
+        index_entries_t entries;
+        for (int group = 0; group < ngroups; ++group) {
+            REQUIRE(members[group] < offsets.size());
+            entries.emplace_back(group, offsets[members[group]]);
+        }
+        save_index(fname, entries);
+        const auto index = load_index(fname);
+        REQUIRE(index.size() == ngroups);
+
+        // Read groups in reverse order starting from their offsets.
+        for (int group = ngroups - 1; group >= 0; --group) {
+            filtering_istream si;
+            input_filters(si, fname, index.at(group));
+            std::string aname;
+            std::vector<int> vec;
+            read(si, aname, vec);
+            REQUIRE(si);
+            CHECK(aname == String::format("vec_%d_0.npy", group));
+            CHECK(vec == std::vector<int>(100, group));
+        }
+    }
+}
@@ -125,3 +125,91 @@ TEST_CASE("persist json")
     }
     REQUIRE(! boost::filesystem::exists(path));
 }
+
+static void write_text(const boost::filesystem::path& path, const std::string& text)
+{
+    boost::filesystem::ofstream out(path);
+    out << text;
+}
+
+TEST_CASE("persist jsonnet cache")
+{
+    auto tdir = Persist::TempDir();
+    const auto path = tdir.path;
+    const auto cdir = (path / "cache").native();
+    unsetenv("WIRECELL_CACHE");
+    setenv("WIRECELL_PATH", path.c_str(), 1);
+
+    write_text(path / "lib.libsonnet", "{ x: 1 }");
+    write_text(path / "main.jsonnet",
+               "local lib = import \"lib.libsonnet\";\n"
+               "// import \"not-a-file.libsonnet\"\n"
+               "lib + { y: std.extVar(\"y\") }\n");
+    const std::string main = (path / "main.jsonnet").native();
+
+    Persist::Parser nocache({}, {{"y", "2"}});
+    CHECK(nocache.cache_path(main).empty());
+
+    Persist::Parser parser({}, {{"y", "2"}});
+    parser.set_cache(cdir);
+    const auto cpath = parser.cache_path(main);
+    CHECK(!cpath.empty());
+    CHECK(cpath == parser.cache_path(main));
+
+    // Any change to the input changes the key.
+    Persist::Parser other({}, {{"y", "3"}});
+    other.set_cache(cdir);
+    CHECK(cpath != other.cache_path(main));
+
+    write_text(path / "lib.libsonnet", "{ x: 2 }");
+    CHECK(cpath != parser.cache_path(main));
+    write_text(path / "lib.libsonnet", "{ x: 1 }");
+    CHECK(cpath == parser.cache_path(main));
+
+    // A cached evaluation is used without running Jsonnet.
+    Persist::assuredir(cpath);
+    write_text(cpath, "{\"cached\": true}");
+    auto jcached = parser.load(main);
+    CHECK(jcached["cached"].asBool());
+}
+
+TEST_CASE("persist jsonnet cache from another directory")
+{
+    auto tdir = Persist::TempDir();
+    const auto path = tdir.path;
+    const auto cdir = (path / "cache").native();
+    const auto cfgdir = path / "cfg";
+    const auto one = path / "one", two = path / "two";
+    for (const auto& dir : {cfgdir, one, two}) {
+        boost::filesystem::create_directories(dir);
+    }
+    unsetenv("WIRECELL_CACHE");
+    setenv("WIRECELL_PATH", cfgdir.c_str(), 1);
+
+    write_text(cfgdir / "lib.libsonnet", "{ x: 1 }");
+    write_text(cfgdir / "main.jsonnet",
+               "local lib = import \"lib.libsonnet\";\n"
+               "lib + { y: std.extVar(\"y\") }\n");
+    const auto cwd = boost::filesystem::current_path();
+
+    // Precompile from one directory.
+    boost::filesystem::current_path(one);
+    Persist::Parser first({}, {{"y", "2"}});
+    first.set_cache(cdir);
+    const auto cpath = first.cache_path("main.jsonnet");
+    REQUIRE(!cpath.empty());
+    auto jfirst = first.load("main.jsonnet");
+    CHECK(jfirst["y"].asString() == "2");
+    CHECK(boost::filesystem::exists(cpath));
+
+    // A job elsewhere with its own load path finds the same entry.
+    boost::filesystem::current_path(two);
+    Persist::Parser second({two.native()}, {{"y", "2"}});
+    second.set_cache(cdir);
+    CHECK(cpath == second.cache_path("main.jsonnet"));
+    write_text(cpath, "{\"cached\": true}");
+    auto jsecond = second.load("main.jsonnet");
+    CHECK(jsecond["cached"].asBool());
+
+    boost::filesystem::current_path(cwd);
+}
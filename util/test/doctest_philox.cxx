@@ -0,0 +1,44 @@
+#include "WireCellUtil/Philox.h"
+#include "WireCellUtil/doctest.h"
+
+#include <random>
+#include <vector>
+
+using namespace WireCell;
+
+TEST_CASE("philox known answers")
+{
+    // From the Random123 kat_vectors for philox4x32-10.
+    CHECK(Philox::generate({0, 0, 0, 0}, 0) ==
+          Philox::block_t{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+    CHECK(Philox::generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, 0xffffffffffffffffULL) ==
+          Philox::block_t{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+    CHECK(Philox::generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, 0x299f31d0a4093822ULL) ==
+          Philox::block_t{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("philox streams")
+{
+    Philox a(42, 0), b(42, 0), c(42, 1);
+    std::vector<uint32_t> va, vc;
+    for (int ind = 0; ind < 100; ++ind) {
+        va.push_back(a());
+        vc.push_back(c());
+    }
+    CHECK(va != vc);
+
+    // Seek directly to the middle of the sequence.
+    b.seek(10);
+    CHECK(b() == va[40]);
+
+    // Drives std distributions.
+    std::uniform_int_distribution<int> dist(0, 9);
+    for (int ind = 0; ind < 100; ++ind) {
+        const int val = dist(a);
+        CHECK(val >= 0);
+        CHECK(val <= 9);
+        const double u = a.uniform();
+        CHECK(u >= 0);
+        CHECK(u < 1);
+    }
+}
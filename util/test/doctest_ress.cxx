@@ -0,0 +1,102 @@
+#include "WireCellUtil/Ress.h"
+#include "WireCellUtil/ElasticNetModel.h"
+#include "WireCellUtil/LassoModel.h"
+#include "WireCellUtil/doctest.h"
+
+#include "ress_reference.h"
+
+#include <cmath>
+#include <random>
+
+using namespace WireCell;
+
+namespace {
+
+    // A small blob/wire-like system: each measure sees a few sources.
+    void make_system(size_t nsource, size_t nmeasure, size_t seed, Ress::matrix_t& R, Ress::vector_t& m,
+                     Ress::vector_t& s)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<size_t> pick(0, nsource - 1);
+        std::uniform_real_distribution<double> charge(100, 1000);
+        std::bernoulli_distribution ghost(0.3);
+
+        s = Ress::vector_t::Zero(nsource);
+        for (size_t ind = 0; ind < nsource; ++ind) {
+            if (!ghost(rng)) s(ind) = charge(rng);
+        }
+        R = Ress::matrix_t::Zero(nmeasure, nsource);
+        for (size_t row = 0; row < nmeasure; ++row) {
+            for (size_t n = 0; n < 3; ++n) {
+                R(row, pick(rng)) = 1.0;
+            }
+        }
+        m = R * s;
+    }
+}  // namespace
+
+TEST_CASE("ress elnet matches reference")
+{
+    for (size_t seed : {1, 2, 3}) {
+        Ress::matrix_t R;
+        Ress::vector_t m, s;
+        make_system(60, 90, seed, R, m, s);
+
+        Ress::Params params;
+        params.lambda = 0.1;
+        params.tolerance = 1e-3;
+        const auto got = Ress::solve(R, m, params);
+        const auto want = reference_elnet(R, m, params);
+        REQUIRE(got.size() == want.size());
+        for (int ind = 0; ind < got.size(); ++ind) {
+            CHECK(got(ind) == doctest::Approx(want(ind)).epsilon(1e-9));
+        }
+    }
+}
+
+TEST_CASE("ress lasso matches elnet")
+{
+    Ress::matrix_t R;
+    Ress::vector_t m, s;
+    make_system(60, 90, 42, R, m, s);
+
+    Ress::Params params;
+    params.lambda = 0.1;
+    params.tolerance = 1e-6;
+    const auto el = Ress::solve(R, m, params);
+    params.model = Ress::lasso;
+    const auto la = Ress::solve(R, m, params);
+    REQUIRE(el.size() == la.size());
+    for (int ind = 0; ind < el.size(); ++ind) {
+        CHECK(la(ind) == doctest::Approx(el(ind)).epsilon(1e-3).scale(1));
+    }
+}
+
+TEST_CASE("ress warm start")
+{
+    Ress::matrix_t R;
+    Ress::vector_t m, s;
+    make_system(60, 90, 7, R, m, s);
+
+    for (auto model : {Ress::elnet, Ress::lasso}) {
+        Ress::Params params;
+        params.model = model;
+        params.lambda = 0.1;
+
+        // With no iterations the initial source is returned as-is.
+        params.set_init = true;
+        params.max_iter = 0;
+        const auto init = s / 2;
+        const auto same = Ress::solve(R, m, params, init);
+        CHECK((same - init).norm() == 0);
+
+        // Starting near the answer reaches it.
+        params.max_iter = 100000;
+        params.tolerance = 1e-6;
+        params.set_init = false;
+        const auto cold = Ress::solve(R, m, params);
+        params.set_init = true;
+        const auto warm = Ress::solve(R, m, params, cold);
+        CHECK((warm - cold).norm() < 1e-3 * (1 + cold.norm()));
+    }
+}
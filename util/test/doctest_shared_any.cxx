@@ -0,0 +1,65 @@
+#include "WireCellUtil/SharedAny.h"
+#include "WireCellUtil/doctest.h"
+
+#include <string>
+#include <vector>
+
+using namespace WireCell;
+
+namespace {
+    struct Base {
+        virtual ~Base() {}
+    };
+    struct Derived : public Base {
+        int val{42};
+    };
+}  // namespace
+
+TEST_CASE("shared any basics")
+{
+    SharedAny empty;
+    CHECK(empty.empty());
+    CHECK(empty.type() == typeid(void));
+    CHECK_THROWS_AS(empty.as<std::shared_ptr<const int>>(), TypeError);
+
+    auto ip = std::make_shared<const int>(7);
+    SharedAny sa = ip;
+    CHECK(!sa.empty());
+    CHECK(sa.is<int>());
+    CHECK(sa.is<const int>());
+    CHECK(!sa.is<float>());
+    CHECK(*sa.as<std::shared_ptr<const int>>() == 7);
+    CHECK(ip.use_count() == 2);
+    CHECK_THROWS_AS(sa.as<std::shared_ptr<const float>>(), TypeError);
+
+    // copies share ownership
+    SharedAny sa2 = sa;
+    CHECK(ip.use_count() == 3);
+    sa = SharedAny();
+    CHECK(ip.use_count() == 2);
+    CHECK(sa2.as<std::shared_ptr<const int>>().get() == ip.get());
+
+    // non-const pointers are held as const
+    SharedAny ss = std::make_shared<std::string>("hello");
+    CHECK(*ss.as<std::shared_ptr<const std::string>>() == "hello");
+}
+
+TEST_CASE("shared any null keeps type")
+{
+    std::shared_ptr<const double> eos;
+    SharedAny sa = eos;
+    CHECK(!sa.empty());
+    CHECK(sa.is<double>());
+    CHECK(sa.as<std::shared_ptr<const double>>() == nullptr);
+}
+
+TEST_CASE("shared any is exact on type")
+{
+    // The type is that of the pointer given, as with boost::any.
+    std::shared_ptr<const Base> bp = std::make_shared<Derived>();
+    SharedAny sa = bp;
+    CHECK(sa.is<Base>());
+    CHECK(!sa.is<Derived>());
+    auto back = sa.as<std::shared_ptr<const Base>>();
+    CHECK(std::dynamic_pointer_cast<const Derived>(back)->val == 42);
+}
@@ -0,0 +1,54 @@
+// The original dense elastic net coordinate descent which remade the
+// full residual for each coordinate.  Tests compare Ress::solve() to
+// this reference.
+
+#ifndef WIRECELLUTIL_TEST_RESS_REFERENCE
+#define WIRECELLUTIL_TEST_RESS_REFERENCE
+
+#include "WireCellUtil/Ress.h"
+
+#include <cmath>
+#include <vector>
+
+inline WireCell::Ress::vector_t reference_elnet(const WireCell::Ress::matrix_t& X,
+                                                const WireCell::Ress::vector_t& y,
+                                                const WireCell::Ress::Params& params)
+{
+    using WireCell::Ress::vector_t;
+    const int nbeta = X.cols();
+    vector_t beta = vector_t::Zero(nbeta);
+    std::vector<bool> active(nbeta, true);
+    vector_t norm(nbeta);
+    for (int j = 0; j < nbeta; j++) {
+        norm(j) = X.col(j).squaredNorm();
+        if (norm(j) < 1e-6) norm(j) = 1;
+    }
+    const double tol2 = params.tolerance * params.tolerance * nbeta;
+    const double thresh = params.lambda * params.alpha;
+    int double_check = 0;
+    for (int i = 0; i < params.max_iter; i++) {
+        vector_t betalast = beta;
+        for (int j = 0; j < nbeta; j++) {
+            if (!active[j]) continue;
+            vector_t beta_tmp = beta;
+            beta_tmp(j) = 0;
+            const double delta = X.col(j).dot(y - X * beta_tmp) / norm(j);
+            const double soft = delta > thresh ? delta - thresh : 0;
+            beta(j) = soft / (1 + params.lambda * (1 - params.alpha));
+            if (std::abs(beta(j)) < 1e-6) active[j] = false;
+        }
+        double_check++;
+        if ((beta - betalast).squaredNorm() < tol2) {
+            if (double_check != 1) {
+                double_check = 0;
+                active.assign(nbeta, true);
+            }
+            else {
+                break;
+            }
+        }
+    }
+    return beta;
+}
+
+#endif